@@ -0,0 +1,144 @@
+#include "comfortzone_heatpump.h"
+#include "comfortzone_config.h"
+#include "comfortzone_frame.h"
+#include "comfortzone_capture_diff.h"
+
+#include "string.h"
+
+comfortzone_capture_diff::comfortzone_capture_diff()
+{
+	int i;
+
+	for(i = 0; i < 2; i++)
+	{
+		framer[i] = new comfortzone_heatpump(&bus[i]);
+		framer[i]->begin();
+		framer[i]->set_grab_buffer(grab_buffer[i], sizeof(grab_buffer[i]), &grab_frame_size[i]);
+	}
+}
+
+comfortzone_capture_diff::~comfortzone_capture_diff()
+{
+	int i;
+
+	for(i = 0; i < 2; i++)
+		delete framer[i];
+
+	for(i = 0; i < nb_registers; i++)
+		delete registers[i];
+}
+
+// add raw RS485 bytes of a capture
+bool comfortzone_capture_diff::feed(bool reference, const byte *data, int size)
+{
+	int side = reference ? 0 : 1;
+	comfortzone_heatpump::PROCESSED_FRAME_TYPE pft;
+	bool result = true;
+	int nb;
+
+	while(size > 0)
+	{
+		nb = bus[side].feed(data, size);
+		data += nb;
+		size -= nb;
+
+		while(bus[side].available())
+		{
+			pft = framer[side]->process();
+
+			if((pft == comfortzone_heatpump::PFT_NONE) || (pft == comfortzone_heatpump::PFT_CORRUPTED))
+				continue;
+
+			if(grab_frame_size[side] == 0)
+				continue;
+
+			if(add_frame(reference, grab_buffer[side]) == false)
+				result = false;
+		}
+	}
+
+	return result;
+}
+
+// find the entry of the register of a frame, create it if needed
+// output: NULL if there is no more room for a new register
+CZ_DIFF_REGISTER *comfortzone_capture_diff::find_register(const byte *frame)
+{
+	CZ_PACKET_HEADER *czph = (CZ_PACKET_HEADER *)frame;
+	CZ_DIFF_REGISTER *reg;
+	uint32_t key = cz_reg_key(czph->reg_num);
+	int i;
+
+	for(i = 0; i < nb_registers; i++)
+	{
+		reg = registers[i];
+
+		if((reg->cmd == czph->cmd) && (reg->frame_size == czph->packet_size) && (cz_same_reg(reg->reg_key, reg->reg_num, key, czph->reg_num)))
+			return reg;
+	}
+
+	if(nb_registers == CAPTURE_DIFF_MAX_REGISTERS)
+		return NULL;
+
+	reg = new CZ_DIFF_REGISTER;
+	if(reg == NULL)
+		return NULL;
+
+	memset(reg, 0, sizeof(CZ_DIFF_REGISTER));
+	reg->cmd = czph->cmd;
+	memcpy(reg->reg_num, czph->reg_num, 9);
+	reg->reg_key = key;
+	reg->frame_size = czph->packet_size;
+
+	registers[nb_registers++] = reg;
+
+	return reg;
+}
+
+// add a complete frame (header to crc) of a capture
+bool comfortzone_capture_diff::add_frame(bool reference, const byte *frame)
+{
+	CZ_DIFF_REGISTER *reg;
+	int i;
+
+	reg = find_register(frame);
+	if(reg == NULL)
+		return false;
+
+	if(reference)
+	{
+		if(reg->nb_reference_frames != 0)
+		{
+			for(i = 0; i < reg->frame_size; i++)
+			{
+				if(reg->reference[i] != frame[i])
+					reg->reference_volatile[i >> 3] |= (1 << (i & 7));
+			}
+		}
+
+		memcpy(reg->reference, frame, reg->frame_size);
+		reg->nb_reference_frames++;
+	}
+	else
+	{
+		// without reference, nothing to compare
+		if(reg->nb_reference_frames != 0)
+		{
+			for(i = 0; i < reg->frame_size; i++)
+			{
+				if(reg->reference[i] != frame[i])
+					reg->diff_count[i]++;
+			}
+		}
+
+		reg->nb_compared_frames++;
+	}
+
+	return true;
+}
+
+// true if the byte at the given offset changed inside reference capture
+bool comfortzone_capture_diff::is_volatile(const CZ_DIFF_REGISTER *reg, int offset)
+{
+	return (reg->reference_volatile[offset >> 3] & (1 << (offset & 7))) ? true : false;
+}
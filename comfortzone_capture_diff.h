@@ -0,0 +1,73 @@
+#ifndef _COMFORTZONE_CAPTURE_DIFF_H
+#define _COMFORTZONE_CAPTURE_DIFF_H
+
+#include "comfortzone_heatpump.h"
+#include "comfortzone_frame.h"
+#include "rs485_interface.h"
+
+// Compare 2 captures of RS485 traffic register by register
+//
+// Frames of the reference capture and of the compared capture can be given in any order
+// (one capture after the other or interleaved). For each register (command, register number
+// and frame size), the last frame of the reference capture is kept as reference. Each frame
+// of the compared capture is then compared byte per byte with it.
+// Bytes which change inside the reference capture itself (clock, sensors...) are flagged as volatile.
+//
+// Memory usage only depends on the number of registers, not on capture size.
+// Register entries are allocated dynamically, this class is intended for host tools.
+
+#define CAPTURE_DIFF_MAX_REGISTERS 256
+
+typedef struct
+{
+	byte cmd;							// 'R', 'W', 'r' or 'w'
+	byte reg_num[9];
+	uint32_t reg_key;				// cz_reg_key(reg_num)
+	byte frame_size;
+
+	uint32_t nb_reference_frames;	// #frames of reference capture
+	uint32_t nb_compared_frames;	// #frames of compared capture
+
+	byte reference[256];				// last frame of reference capture
+	byte reference_volatile[256 / 8];	// bitmap of offsets which changed inside reference capture
+	uint32_t diff_count[256];		// per offset, #compared frames different from reference
+} CZ_DIFF_REGISTER;
+
+class comfortzone_capture_diff
+{
+	public:
+	comfortzone_capture_diff();
+	~comfortzone_capture_diff();
+
+	// add raw RS485 bytes of a capture. Frames are extracted (and CRC checked) by a comfortzone_heatpump instance
+	// input: true = reference capture, false = compared capture
+	//        capture bytes
+	// output: false if there is no more room for a new register
+	bool feed(bool reference, const byte *data, int size);
+
+	// add a complete frame (header to crc) of a capture
+	// input: true = reference capture, false = compared capture
+	//        frame
+	// output: false if there is no more room for a new register
+	bool add_frame(bool reference, const byte *frame);
+
+	int get_nb_registers() { return nb_registers; }
+	const CZ_DIFF_REGISTER *get_register(int idx) { return registers[idx]; }
+
+	// true if the byte at the given offset changed inside reference capture
+	static bool is_volatile(const CZ_DIFF_REGISTER *reg, int offset);
+
+	private:
+	CZ_DIFF_REGISTER *registers[CAPTURE_DIFF_MAX_REGISTERS];
+	int nb_registers = 0;
+
+	// frame extraction (one per capture)
+	MemoryRS485Interface bus[2];
+	comfortzone_heatpump *framer[2];
+	byte grab_buffer[2][256];
+	uint16_t grab_frame_size[2];
+
+	CZ_DIFF_REGISTER *find_register(const byte *frame);
+};
+
+#endif
@@ -8,6 +8,62 @@
 #define HP_PROTOCOL_1_8 180
 #define HP_PROTOCOL_2_21 221
 
+// only compile register tables of HP_PROTOCOL (smaller build). begin() then only
+// accepts HP_PROTOCOL (or HP_PROTOCOL_AUTO, detecting it)
+//#define HP_SINGLE_PROTOCOL
+
+// number of supported protocol versions
+#ifdef HP_SINGLE_PROTOCOL
+#define HP_NB_PROTOCOLS 1
+#else
+#define HP_NB_PROTOCOLS 4
+#endif
+
+// maximum number of registers of a protocol version
+#define HP_MAX_REGISTERS 64
+
+// detect protocol version from RS485 traffic (see comfortzone_heatpump::begin())
+#define HP_PROTOCOL_AUTO 0
+
+// protocol detection: detected protocol version is selected when it has recognized
+// HP_PROTOCOL_DETECTION_MIN_FRAMES frames and no other protocol version recognized any frame,
+// or, when traffic is ambiguous, after HP_PROTOCOL_DETECTION_MAX_FRAMES frames
+#define HP_PROTOCOL_DETECTION_MIN_FRAMES 10
+#define HP_PROTOCOL_DETECTION_MAX_FRAMES 100
+
+// skip decoding of a reply frame when it is identical to the previous reply of the same register
+// (comment to decode every reply frame, for example to dump all of them in debug mode)
+// without HP_REPLY_STORE_SIZE, only a 32 bits hash of the previous reply is kept (4 bytes per register):
+// a changed reply having the same hash (unlikely but possible) is not decoded and its values are updated
+// by the next different reply. With HP_REPLY_STORE_SIZE, frames are compared byte per byte with the kept reply
+#define HP_SKIP_UNCHANGED_REPLIES
+
+// keep the last reply frame of each register to decode only status values whose bytes changed
+// (uncomment to enable, costs HP_REPLY_STORE_SIZE + 6 bytes per register, about 6.5KB per
+// comfortzone_heatpump object with 6144: too much for boards having 8KB of RAM or less)
+//#define HP_REPLY_STORE_SIZE 6144
+
+// lazy decoding: status values described by field tables are decoded from the kept reply frames
+// only when read using comfortzone_heatpump::get_status() (requires HP_REPLY_STORE_SIZE). Values having
+// a subscriber or reported by the status change callback are still decoded when frames are received
+//#define HP_LAZY_DECODING
+
+// keep the last value, timestamp and source of each register seen on the bus
+// (see comfortzone_heatpump::get_register_value(), uncomment to enable, costs 10 bytes per register
+// on AVR, 640 bytes per comfortzone_heatpump object)
+//#define HP_REGISTER_SHADOW
+
+// maximum number of registers added at runtime using comfortzone_heatpump::add_register()
+// (uncomment to enable, costs 20 bytes per register on AVR, 165 bytes per comfortzone_heatpump object with 8)
+//#define HP_MAX_EXTRA_REGISTERS 8
+
+// maximum number of subscribers of each comfortzone_status value (see Subscribable::subscribe())
+#define HP_MAX_SUBSCRIBERS 2
+
+#if defined(HP_LAZY_DECODING) && !defined(HP_REPLY_STORE_SIZE)
+#error "HP_LAZY_DECODING requires HP_REPLY_STORE_SIZE"
+#endif
+
 //#define HP_PROTOCOL HP_PROTOCOL_2_21
 
 #ifndef HP_PROTOCOL
@@ -16,6 +72,18 @@
 #define HP_PROTOCOL HP_PROTOCOL_1_6
 #endif
 
+#if defined(HP_SINGLE_PROTOCOL) && (HP_PROTOCOL != HP_PROTOCOL_1_6) && (HP_PROTOCOL != HP_PROTOCOL_1_7) \
+		&& (HP_PROTOCOL != HP_PROTOCOL_1_8) && (HP_PROTOCOL != HP_PROTOCOL_2_21)
+#error "HP_SINGLE_PROTOCOL requires a supported HP_PROTOCOL"
+#endif
+
+// keep tables of a protocol version (HP_SINGLE_PROTOCOL support)
+#if defined(HP_SINGLE_PROTOCOL)
+#define HP_WITH_PROTOCOL(p)	(HP_PROTOCOL == (p))
+#else
+#define HP_WITH_PROTOCOL(p)	1
+#endif
+
 #undef DEBUG
 // uncomment to enable debug mode
 //#define DEBUG
@@ -0,0 +1,3868 @@
+#ifndef _COMFORTZONE_CORPUS_H
+#define _COMFORTZONE_CORPUS_H
+
+#include "comfortzone_config.h"
+#include "comfortzone_status.h"
+
+// Golden frame corpus
+//
+// Frames were harvested from the hex dumps found in comfortzone_decoder.cpp comments
+// (only complete frames with a valid CRC are kept, duplicates are removed).
+// They are stored back to back, exactly as they appear on the RS485 bus
+// (frame size is byte 10 of each frame, see CZ_PACKET_HEADER.packet_size).
+//
+// For each frame, the corpus contains the expected PROCESSED_FRAME_TYPE returned by
+// comfortzone_heatpump::process() and the value of each COMFORTZONE_STATUS field
+// set by the decoder. Expected values were produced by replaying frames through the
+// library (version 1.4.1) and are used as reference to check any decoder modification.
+//
+// No dump is available for protocol 1.6, its corpus is empty.
+//
+// /!\ Increase COMFORTZONE_CORPUS_VERSION each time frames or expected values are modified
+// This file is only used by examples, it must not be included by the library itself.
+
+#define COMFORTZONE_CORPUS_VERSION 1
+
+typedef struct
+{
+	uint16_t frame_num;		// index of the frame in the corpus
+	byte field;					// COMFORTZONE_STATUS_FIELD
+	int32_t value;				// expected value after frame processing
+} COMFORTZONE_CORPUS_VALUE;
+
+typedef struct
+{
+	uint16_t protocol;		// HP_PROTOCOL_x_y of the frames
+
+	const byte *frames;		// frames, back to back
+	uint32_t frames_size;	// #bytes in frames
+	uint16_t nb_frames;		// #frames in frames
+
+	const byte *frame_types;	// expected PROCESSED_FRAME_TYPE of each frame
+
+	const COMFORTZONE_CORPUS_VALUE *values;	// expected COMFORTZONE_STATUS values
+	uint16_t nb_values;							// #entries in values
+} COMFORTZONE_CORPUS;
+
+#if HP_PROTOCOL == HP_PROTOCOL_1_7
+static const byte comfortzone_corpus_frames[] =
+	{
+		// #0 r 01 02 03 04 0B 08 00 14 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x14, 0x02, 0x05, 0x05, 0x05,
+		0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+		0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x0F, 0x0F, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x1E, 0x14, 0xA0, 0x0A, 0x0E,
+		0x01, 0x00, 0x2C, 0x01, 0x14, 0x2C, 0x01, 0x14, 0x05, 0x0F, 0x00, 0x00, 0x0A, 0x00, 0x3C, 0x00, 0xE8, 0x03, 0x0A, 0x00, 0x3C, 0x00, 0x00, 0x00,
+		0x0A, 0x00, 0x3C, 0x00, 0xE8, 0x03, 0x0A, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x01, 0x04, 0x03, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+		0x01, 0x00, 0x01, 0x00, 0xB4, 0x00, 0x14, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x02, 0x06, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x06, 0xFE,
+		0x00, 0x14, 0x00, 0x32, 0x00, 0xCE, 0xFF, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0E, 0x01, 0x3D, 0x01, 0x69, 0x01, 0x92, 0x01, 0xB9, 0x01, 0xDF,
+		0x01, 0x1E, 0x00, 0x28, 0x00, 0x1E, 0x00, 0x23,
+		// #1 r 01 02 03 04 0B 08 01 00 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x13, 0x1F, 0x39, 0x19, 0x0B, 0x17, 0x06, 0x00, 0x13, 0x1F, 0x39, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x38, 0x2A, 0x00, 0x00,
+		0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19, 0xFC, 0xE3,
+		0xFF, 0xE4, 0x01, 0x08, 0x01, 0xD5, 0x00, 0xF2, 0x02, 0xC0, 0x01, 0xED, 0xFF, 0xED, 0xFF, 0x22, 0xFC, 0x22, 0xFC, 0x05, 0x01, 0x22, 0xFC, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x0C,
+		0x02, 0x46, 0x00, 0x0C, 0x00, 0x4C, 0x01, 0xB7, 0x00, 0x00, 0x00, 0xE8, 0x03, 0xE8, 0x03, 0x00, 0x00, 0x46, 0x00, 0x81, 0x00, 0xA6, 0x00, 0xB7,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0xD8, 0x01, 0x08, 0x01, 0xD5, 0x00, 0xF0, 0x02, 0xC0, 0x01, 0xF0, 0xFF, 0xDD, 0x01, 0xF1,
+		0xFF, 0x22, 0xFC, 0x22, 0xFC, 0x05, 0x01, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0xC0,
+		// #2 r 01 02 03 04 0B 08 01 00 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x13, 0x20, 0x39, 0x19, 0x0B, 0x17, 0x06, 0x00, 0x13, 0x20, 0x39, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x38, 0x2A, 0x00, 0x00,
+		0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19, 0xFC, 0xE3,
+		0xFF, 0xBC, 0x01, 0x08, 0x01, 0xD5, 0x00, 0xAE, 0x02, 0xC1, 0x01, 0xF7, 0xFF, 0xF8, 0xFF, 0x22, 0xFC, 0x22, 0xFC, 0x05, 0x01, 0x22, 0xFC, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x0C,
+		0x02, 0x48, 0x00, 0x0C, 0x00, 0x3C, 0x01, 0xAB, 0x00, 0x00, 0x00, 0xE8, 0x03, 0xE8, 0x03, 0x00, 0x00, 0x48, 0x00, 0x7B, 0x00, 0x9E, 0x00, 0xAB,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0xB6, 0x01, 0x08, 0x01, 0xD5, 0x00, 0xA7, 0x02, 0xC3, 0x01, 0xF9, 0xFF, 0xDD, 0x01, 0xFA,
+		0xFF, 0x22, 0xFC, 0x22, 0xFC, 0x05, 0x01, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0xCE,
+		// #3 r 01 02 03 04 0B 08 03 15 0D
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x03, 0x15, 0x0D, 0x17, 0x0D, 0x0B,
+		0x17, 0x14, 0x36, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x0B, 0x17, 0x16, 0x1C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x12, 0x0B, 0x17, 0x11, 0x2A, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0B, 0x17, 0x0B, 0x2E, 0x2D, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0B, 0x17, 0x0D, 0x0F, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0B, 0x17, 0x0D,
+		0x26, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0B, 0x17, 0x0D, 0x27, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x13, 0x0B, 0x17, 0x0D, 0x33, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0B, 0x17, 0x0D, 0x35, 0x12, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x13, 0x0B, 0x17, 0x0D, 0x36, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0B, 0x17, 0x0D, 0x37, 0x27,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0B, 0x17, 0x0D, 0x39, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0B,
+		0x17, 0x16, 0x27, 0x26, 0x00, 0x00, 0x00, 0xC8,
+		// #4 r 01 02 03 04 0B 08 03 1E 0F
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x26, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x03, 0x1E, 0x0F, 0x09, 0x05, 0x00,
+		0x08, 0x09, 0x13, 0x00, 0x07, 0x0A, 0x06, 0x00, 0x08, 0x0A, 0x13, 0x00, 0x07, 0x12,
+		// #5 r 01 02 03 04 0B 08 03 79 0E
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x03, 0x79, 0x0E, 0x2D, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0B, 0x17, 0x16, 0x08, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0B, 0x17, 0x16,
+		0x1F, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0B, 0x17, 0x16, 0x20, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x0C, 0x0B, 0x17, 0x17, 0x08, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x05, 0x00, 0x08, 0x09, 0x13,
+		0x00, 0x07, 0x0A, 0x06, 0x00, 0x08, 0x0A, 0xC6,
+		// #6 r 01 02 03 04 0B 08 03 C7 0D
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x03, 0xC7, 0x0D, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x13, 0x0B, 0x17, 0x16, 0x2D, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0B, 0x17, 0x16, 0x2F, 0x10, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0B, 0x17, 0x13, 0x23, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0B, 0x17, 0x13,
+		0x2F, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0B, 0x17, 0x14, 0x06, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x15, 0x0B, 0x17, 0x12, 0x29, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0B, 0x17, 0x13, 0x22, 0x3A, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x15, 0x0B, 0x17, 0x13, 0x26, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0B, 0x17, 0x13, 0x27, 0x20,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0B, 0x17, 0x14, 0x31, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0B,
+		0x17, 0x0C, 0x18, 0x1A, 0x02, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0B, 0x17, 0x0C, 0x18, 0x1C, 0x03, 0x12, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x0C, 0x0B, 0x17, 0x16, 0x06, 0x6A,
+		// #7 r 01 02 03 04 0B 08 05 00 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x56, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x05, 0x00, 0x00, 0x59, 0x31, 0x19,
+		0x07, 0x25, 0x11, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x13, 0x47, 0x00, 0x00, 0xB1, 0x22, 0x00, 0x00, 0xF9, 0x14, 0x00,
+		0x00, 0x41, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x8F, 0x4C, 0x00, 0x3D, 0x22, 0x07,
+		0x00, 0x7F, 0x40, 0x0C, 0x00, 0x83, 0xC6, 0x10, 0x00, 0xEA, 0x1A, 0x31, 0x00, 0xA0,
+		// #8 r 01 02 03 04 0B 08 00 9D 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2D, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x9D, 0x02, 0x02, 0x06, 0x00,
+		0x00, 0xFF, 0x00, 0x00, 0xFF, 0x06, 0xD1, 0x00, 0x14, 0x00, 0x32, 0x00, 0xCE, 0xFF, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xFE,
+	};
+
+static const byte comfortzone_corpus_frame_types[9] =
+	{
+		4, 3, 3, 4, 4, 4, 4, 3, 3,
+	};
+
+static const COMFORTZONE_CORPUS_VALUE comfortzone_corpus_values[] =
+	{
+		{ 1, CZSF_SENSORS_TE0_OUTDOOR_TEMP, -29 },
+		{ 1, CZSF_SENSORS_TE1_FLOW_WATER, 484 },
+		{ 1, CZSF_SENSORS_TE2_RETURN_WATER, 264 },
+		{ 1, CZSF_SENSORS_TE3_INDOOR_TEMP, 213 },
+		{ 1, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 754 },
+		{ 1, CZSF_SENSORS_TE5_EXCHANGER_OUT, 448 },
+		{ 1, CZSF_SENSORS_TE6_EVAPORATOR_IN, -19 },
+		{ 1, CZSF_SENSORS_TE7_EXHAUST_AIR, -19 },
+		{ 1, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 524 },
+		{ 1, CZSF_FILTER_ALARM, 0 },
+		{ 1, CZSF_GENERAL_ALARM, 0 },
+		{ 1, CZSF_HOUR, 19 },
+		{ 1, CZSF_MINUTE, 31 },
+		{ 1, CZSF_SECOND, 57 },
+		{ 1, CZSF_DAY, 25 },
+		{ 1, CZSF_MONTH, 11 },
+		{ 1, CZSF_YEAR, 2023 },
+		{ 1, CZSF_DAY_OF_WEEK, 6 },
+		{ 2, CZSF_SENSORS_TE0_OUTDOOR_TEMP, -29 },
+		{ 2, CZSF_SENSORS_TE1_FLOW_WATER, 444 },
+		{ 2, CZSF_SENSORS_TE2_RETURN_WATER, 264 },
+		{ 2, CZSF_SENSORS_TE3_INDOOR_TEMP, 213 },
+		{ 2, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 686 },
+		{ 2, CZSF_SENSORS_TE5_EXCHANGER_OUT, 449 },
+		{ 2, CZSF_SENSORS_TE6_EVAPORATOR_IN, -9 },
+		{ 2, CZSF_SENSORS_TE7_EXHAUST_AIR, -8 },
+		{ 2, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 524 },
+		{ 2, CZSF_FILTER_ALARM, 0 },
+		{ 2, CZSF_GENERAL_ALARM, 0 },
+		{ 2, CZSF_HOUR, 19 },
+		{ 2, CZSF_MINUTE, 32 },
+		{ 2, CZSF_SECOND, 57 },
+		{ 2, CZSF_DAY, 25 },
+		{ 2, CZSF_MONTH, 11 },
+		{ 2, CZSF_YEAR, 2023 },
+		{ 2, CZSF_DAY_OF_WEEK, 6 },
+		{ 7, CZSF_COMPRESSOR_ENERGY, 5017395 },
+		{ 7, CZSF_ADD_ENERGY, 467517 },
+		{ 7, CZSF_HOT_WATER_ENERGY, 802943 },
+		{ 7, CZSF_COMPRESSOR_RUNTIME, 1099395 },
+		{ 7, CZSF_TOTAL_RUNTIME, 3218154 },
+		{ 8, CZSF_ROOM_HEATING_SETTING, 209 },
+	};
+
+static const COMFORTZONE_CORPUS comfortzone_corpus =
+	{
+		HP_PROTOCOL_1_7,
+		comfortzone_corpus_frames, sizeof(comfortzone_corpus_frames), 9,
+		comfortzone_corpus_frame_types,
+		comfortzone_corpus_values, sizeof(comfortzone_corpus_values) / sizeof(comfortzone_corpus_values[0])
+	};
+#endif
+
+#if HP_PROTOCOL == HP_PROTOCOL_1_8
+static const byte comfortzone_corpus_frames[] =
+	{
+		// #0 r 01 02 03 04 0B 09 00 00 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2C, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x00, 0x00, 0xCA, 0x8E, 0x72,
+		0x42, 0xAE, 0x34, 0x06, 0x1F, 0xFF, 0x00, 0x00, 0x11, 0x03, 0xC2, 0x51, 0x41, 0x2B, 0x01, 0x40, 0x61, 0x00, 0x00, 0xF8,
+		// #1 r 01 02 03 04 0B 09 00 00 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2C, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x00, 0x00, 0xCA, 0x8E, 0x72,
+		0x42, 0xAE, 0x34, 0x06, 0x1F, 0xFF, 0x00, 0x00, 0x11, 0x03, 0xC2, 0x52, 0x41, 0x2B, 0x01, 0x40, 0x61, 0x00, 0x00, 0x3D,
+		// #2 r 01 02 03 04 0B 09 00 00 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2C, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x00, 0x00, 0xCA, 0x8E, 0x72,
+		0x42, 0xAE, 0x34, 0x06, 0x1F, 0xFF, 0x00, 0x00, 0x11, 0x03, 0xC2, 0x53, 0x41, 0x2B, 0x01, 0x40, 0x61, 0x00, 0x00, 0x7E,
+		// #3 r 01 02 03 04 0B 09 00 14 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x14, 0x02, 0xE8, 0x03, 0x05,
+		0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+		0x2E, 0x2E, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x0F, 0x0F, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x1E, 0x14, 0xA0,
+		0x0A, 0x0E, 0x01, 0x00, 0x2C, 0x01, 0x14, 0x2C, 0x01, 0x14, 0x05, 0x0F, 0x00, 0x00, 0x0A, 0x00, 0x3C, 0x00, 0xE8, 0x03, 0x0A, 0x00, 0x3C, 0x00,
+		0x00, 0x00, 0x0A, 0x00, 0x3C, 0x00, 0xE8, 0x03, 0x0A, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x01, 0x04, 0x03, 0x01, 0x00, 0x00, 0x00,
+		0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xB4, 0x00, 0x14, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x01, 0x06, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+		0x46, 0xD2, 0x00, 0x1E, 0x00, 0x32, 0x00, 0xCE, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x19, 0x01, 0x4E, 0x01, 0x80, 0x01, 0xAF, 0x01, 0xDB,
+		0x01, 0x05, 0x02, 0x28, 0x00, 0x3C, 0x00, 0x11,
+		// #4 r 01 02 03 04 0B 09 00 2C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x2C, 0x03, 0x64, 0x00, 0x64,
+		0x00, 0xB4, 0x00, 0xBC, 0x02, 0xC8, 0x00, 0xF4, 0x01, 0x78, 0x00, 0x58, 0x02, 0x00, 0x00, 0x02, 0x64, 0x00, 0x05, 0x78, 0x00, 0x1E, 0x00, 0x52,
+		0x03, 0x2C, 0x01, 0x0C, 0xFE, 0xC8, 0x00, 0x0A, 0x00, 0x8C, 0x0A, 0x0C, 0xFE, 0x1E, 0x0C, 0xFE, 0x58, 0x02, 0xD0, 0x07, 0x58, 0x02, 0x9C, 0xFF,
+		0xAC, 0x0D, 0xFA, 0x00, 0x2C, 0x01, 0x5E, 0x01, 0x90, 0x01, 0x90, 0x01, 0x90, 0x01, 0x5E, 0x01, 0x2C, 0x01, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+		0x14, 0x14, 0x00, 0x00, 0x00, 0x12, 0x90, 0x01, 0xC8, 0x00, 0x14, 0x00, 0xDE, 0x00, 0xF9, 0x00, 0x10, 0x01, 0x27, 0x01, 0x3B, 0x01, 0x4E, 0x01,
+		0x00, 0x00, 0xFF, 0x1C, 0x02, 0x0F, 0x00, 0x92, 0xFF, 0x8D, 0xFF, 0x88, 0xFF, 0x83, 0xFF, 0x7E, 0xFF, 0x79, 0xFF, 0x74, 0xFF, 0x6F, 0xFF, 0x6A,
+		0xFF, 0x65, 0xFF, 0x60, 0xFF, 0x5B, 0xFF, 0x5B, 0xFF, 0x5B, 0xFF, 0x5B, 0xFF, 0xCE, 0xFF, 0xCE, 0xFF, 0xCE, 0xFF, 0xC9, 0xFF, 0xC4, 0xFF, 0xC4,
+		0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0xB5, 0xFF, 0xB5, 0xFF, 0xB5, 0xFF, 0xB5, 0xFF, 0xB5, 0xFF, 0xF1, 0xFF, 0xEC, 0xFF, 0xE7,
+		0xFF, 0xE2, 0xFF, 0xDD, 0xFF, 0xD8, 0xFF, 0xC3,
+		// #5 r 01 02 03 04 0B 09 00 2C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x2C, 0x03, 0x64, 0x00, 0x64,
+		0x00, 0xB4, 0x00, 0xBC, 0x02, 0xC8, 0x00, 0xF4, 0x01, 0x78, 0x00, 0x58, 0x02, 0x00, 0x00, 0x02, 0x64, 0x00, 0x05, 0x78, 0x00, 0x1E, 0x00, 0x52,
+		0x03, 0x2C, 0x01, 0x0C, 0xFE, 0xC8, 0x00, 0x0A, 0x00, 0x8C, 0x0A, 0x0C, 0xFE, 0x1E, 0x0C, 0xFE, 0x58, 0x02, 0xD0, 0x07, 0x58, 0x02, 0x9C, 0xFF,
+		0xAC, 0x0D, 0xFA, 0x00, 0x2C, 0x01, 0x5E, 0x01, 0x90, 0x01, 0x90, 0x01, 0x90, 0x01, 0x5E, 0x01, 0x2C, 0x01, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+		0x14, 0x14, 0x00, 0x00, 0x00, 0x12, 0x90, 0x01, 0xC8, 0x00, 0x14, 0x00, 0xDE, 0x00, 0xF9, 0x00, 0x10, 0x01, 0x27, 0x01, 0x3B, 0x01, 0x4E, 0x01,
+		0x00, 0x14, 0x05, 0x1C, 0x02, 0x0F, 0x00, 0x92, 0xFF, 0x8D, 0xFF, 0x88, 0xFF, 0x83, 0xFF, 0x7E, 0xFF, 0x79, 0xFF, 0x74, 0xFF, 0x6F, 0xFF, 0x6A,
+		0xFF, 0x65, 0xFF, 0x60, 0xFF, 0x5B, 0xFF, 0x5B, 0xFF, 0x5B, 0xFF, 0x5B, 0xFF, 0xCE, 0xFF, 0xCE, 0xFF, 0xCE, 0xFF, 0xC9, 0xFF, 0xC4, 0xFF, 0xC4,
+		0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0xB5, 0xFF, 0xB5, 0xFF, 0xB5, 0xFF, 0xB5, 0xFF, 0xB5, 0xFF, 0xF1, 0xFF, 0xEC, 0xFF, 0xE7,
+		0xFF, 0xE2, 0xFF, 0xDD, 0xFF, 0xD8, 0xFF, 0xDD,
+		// #6 r 01 02 03 04 0B 09 00 62 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x62, 0x01, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC,
+		0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC,
+		0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8,
+		0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8,
+		0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0x92,
+		// #7 r 01 02 03 04 0B 09 00 B1 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC7, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0xB1, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xFF, 0x03, 0xFF, 0x03, 0x99, 0x03, 0x99, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF,
+		0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0xE8, 0x03, 0xFF, 0x03, 0xE8, 0x03, 0xFE, 0x01, 0x6E,
+		0x00, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xFF, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x01, 0x2E, 0x3E, 0x3E, 0x2E, 0x2E, 0x2E, 0x2E, 0x40, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+		// #8 r 01 02 03 04 0B 09 00 BF 04
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xA1, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0xBF, 0x04, 0xB0, 0x04, 0xF4,
+		0x01, 0x96, 0x00, 0x58, 0x02, 0x00, 0x00, 0x50, 0x00, 0x19, 0x00, 0xC8, 0x00, 0x07, 0x00, 0xC8, 0x00, 0x40, 0x01, 0xB4, 0x00, 0x5E, 0x01, 0x05,
+		0x05, 0xF0, 0x0A, 0x09, 0x01, 0x60, 0x09, 0xAA, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x01, 0xC8, 0x00, 0xE8, 0x03, 0xE8, 0x03, 0x58, 0x02, 0x87,
+		0x00, 0x64, 0x00, 0x96, 0x00, 0x48, 0x03, 0x32, 0x1E, 0x00, 0x14, 0x14, 0x14, 0x00, 0xE8, 0x03, 0xE8, 0x03, 0x00, 0x05, 0x01, 0x64, 0x00, 0x00,
+		0x2D, 0x00, 0xBB, 0x03, 0x05, 0x1E, 0x2C, 0x01, 0x0A, 0xF4, 0x01, 0x3C, 0x00, 0x05, 0x46, 0x00, 0xFA, 0x00, 0x74, 0x04, 0x26, 0x02, 0x78, 0x00,
+		0x0A, 0xD2, 0x00, 0xF4, 0x01, 0x32, 0x00, 0xA0, 0x00, 0xD0, 0x07, 0x58, 0x02, 0x1A, 0xFF, 0x2C, 0x01, 0xDA, 0x02, 0x05, 0x50, 0x00, 0x78, 0xB0,
+		0x04, 0x78, 0xE8, 0x03, 0xE8, 0x03, 0x14, 0x01, 0x84, 0x03, 0x08, 0x07, 0x08, 0x07, 0x5A, 0x00, 0xD3,
+		// #9 r 01 02 03 04 0B 09 00 C6 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0xC6, 0x02, 0x1E, 0x00, 0x64,
+		0x00, 0x32, 0x00, 0xB0, 0x04, 0x5A, 0x00, 0xB0, 0x04, 0x5A, 0x00, 0x46, 0x00, 0xB4, 0x00, 0x50, 0x00, 0x78, 0x00, 0xFA, 0x00, 0x32, 0x00, 0x12,
+		0xFD, 0x1E, 0x00, 0xA8, 0xFD, 0x80, 0x0C, 0xE0, 0xFC, 0xA0, 0x0F, 0xDC, 0x05, 0x12, 0xFD, 0x1E, 0x00, 0xA8, 0xFD, 0x80, 0x0C, 0xE0, 0xFC, 0xA0,
+		0x0F, 0xDC, 0x05, 0x3C, 0x05, 0x0F, 0x0F, 0x0A, 0x06, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x2D, 0x00, 0x1E, 0x00, 0x19, 0x00, 0x19, 0x00, 0x19,
+		0x00, 0x05, 0x00, 0x06, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x6A, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x64, 0x00, 0x64, 0x00, 0xB4, 0x00, 0xBC, 0x02, 0xC8, 0x00, 0xF4, 0x01, 0x78, 0x00, 0x58, 0x02, 0x00, 0x00, 0x02, 0x64, 0x00,
+		0x05, 0x78, 0x00, 0x1E, 0x00, 0x52, 0x03, 0x2C, 0x01, 0x0C, 0xFE, 0xC8, 0x00, 0x0A, 0x00, 0x8C, 0x0A, 0x0C, 0xFE, 0x1E, 0x0C, 0xFE, 0x58, 0x02,
+		0xD0, 0x07, 0x58, 0x02, 0x9C, 0xFF, 0xAC, 0x0D, 0xFA, 0x00, 0x2C, 0x01, 0x5E, 0x01, 0x90, 0x01, 0x90, 0x01, 0x90, 0x01, 0x5E, 0x01, 0x2C, 0x01,
+		0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x92,
+		// #10 r 01 02 03 04 0B 09 00 DB 04
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xA3, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0xDB, 0x04, 0xF0, 0x0A, 0x09,
+		0x01, 0x60, 0x09, 0xAA, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x0A, 0x01, 0xC8, 0x00, 0xE8, 0x03, 0xE8, 0x03, 0x58, 0x02, 0x87, 0x00, 0x64, 0x00, 0x96,
+		0x00, 0x48, 0x03, 0x32, 0x1E, 0x00, 0x14, 0x14, 0x14, 0x00, 0xE8, 0x03, 0xE8, 0x03, 0x00, 0x05, 0x01, 0x64, 0x00, 0x00, 0x2D, 0x00, 0xBB, 0x03,
+		0x05, 0x1E, 0x2C, 0x01, 0x0A, 0xF4, 0x01, 0x3C, 0x00, 0x05, 0x46, 0x00, 0xFA, 0x00, 0x74, 0x04, 0x26, 0x02, 0x78, 0x00, 0x0A, 0xD2, 0x00, 0xF4,
+		0x01, 0x32, 0x00, 0xA0, 0x00, 0xD0, 0x07, 0x58, 0x02, 0x1A, 0xFF, 0x2C, 0x01, 0xDA, 0x02, 0x05, 0x50, 0x00, 0x78, 0xB0, 0x04, 0x78, 0xE8, 0x03,
+		0xE8, 0x03, 0x14, 0x01, 0x84, 0x03, 0x08, 0x07, 0x08, 0x07, 0x5A, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0x04, 0x56, 0x55, 0x4D,
+		// #11 r 01 02 03 04 0B 09 00 DE 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x8D, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0xDE, 0x03, 0xD3, 0xFF, 0xCE,
+		0xFF, 0xC9, 0xFF, 0xC4, 0xFF, 0xBF, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0x05, 0x1E, 0x14, 0x7E, 0xFF, 0x74, 0xFF, 0x92, 0xFF,
+		0x88, 0xFF, 0xCE, 0xFF, 0xC4, 0xFF, 0xF1, 0xFF, 0xE7, 0xFF, 0x2C, 0x01, 0x26, 0x02, 0x26, 0x02, 0x1E, 0x00, 0x8A, 0x02, 0xB4, 0x00, 0xDA, 0x02,
+		0x0A, 0x0A, 0x1E, 0x26, 0x02, 0x32, 0x00, 0x58, 0x02, 0x04, 0x0C, 0x03, 0xD4, 0xFE, 0x2C, 0x01, 0x00, 0x00, 0x2C, 0x01, 0x48, 0x03, 0x8A, 0x02,
+		0xEE, 0x02, 0x48, 0x03, 0xB6, 0x03, 0xE8, 0x03, 0xD4, 0xFE, 0xBC, 0x02, 0x00, 0x00, 0x32, 0x00, 0x58, 0x00, 0xA4, 0x06, 0x10, 0x0E, 0x88, 0x13,
+		0xD2, 0x00, 0x34, 0x03, 0x26, 0x02, 0xBC, 0x02, 0x34, 0x03, 0xFC, 0x03, 0x1A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59,
+		// #12 r 01 02 03 04 0B 09 00 DE 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x8D, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0xDE, 0x03, 0xD3, 0xFF, 0xCE,
+		0xFF, 0xC9, 0xFF, 0xC4, 0xFF, 0xBF, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0x05, 0x1E, 0x14, 0x7E, 0xFF, 0x74, 0xFF, 0x92, 0xFF,
+		0x88, 0xFF, 0xCE, 0xFF, 0xC4, 0xFF, 0xF1, 0xFF, 0xE7, 0xFF, 0x2C, 0x01, 0x26, 0x02, 0x26, 0x02, 0x1E, 0x00, 0x8A, 0x02, 0xB4, 0x00, 0xDA, 0x02,
+		0x0A, 0x0A, 0x1E, 0x26, 0x02, 0x32, 0x00, 0x58, 0x02, 0x04, 0x0C, 0x03, 0xD4, 0xFE, 0x2C, 0x01, 0x00, 0x00, 0x2C, 0x01, 0x48, 0x03, 0x8A, 0x02,
+		0xEE, 0x02, 0x48, 0x03, 0xB6, 0x03, 0xE8, 0x03, 0xD4, 0xFE, 0xBC, 0x02, 0x00, 0x00, 0x32, 0x00, 0x5A, 0x00, 0xA4, 0x06, 0x10, 0x0E, 0x88, 0x13,
+		0xD2, 0x00, 0x34, 0x03, 0x26, 0x02, 0xBC, 0x02, 0x34, 0x03, 0xFC, 0x03, 0x1A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31,
+		// #13 r 01 02 03 04 0B 09 01 00 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x16, 0x33, 0x37, 0x0C, 0x01, 0x17, 0x04, 0x00, 0x16, 0x33, 0x37, 0x00, 0x00, 0x40, 0x00, 0x44, 0x00, 0x00, 0x20, 0x0B, 0x5E, 0x00, 0x01,
+		0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x2E, 0x00, 0x10, 0x01, 0x1D, 0x01, 0xE1, 0x00, 0x19, 0x01, 0x14, 0x01, 0x2C, 0x00, 0x08, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0x04, 0x01, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0xD0, 0x01, 0x4B, 0x00, 0x1F, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x93, 0x03, 0x00, 0x00, 0x4B, 0x00, 0x85, 0x00, 0xAC,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x2E, 0x00, 0x10, 0x01, 0x62, 0x01, 0xE1, 0x00, 0x1B, 0x01, 0x24, 0x01, 0x2F, 0x00, 0x94,
+		0x01, 0x08, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0x04, 0x01, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x57,
+		// #14 r 01 02 03 04 0B 09 01 17 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x18, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x17, 0x00, 0x08, 0x4D, 0x11,
+		// #15 r 01 02 03 04 0B 09 01 17 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x18, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x17, 0x00, 0x08, 0x4C, 0x4F,
+		// #16 r 01 02 03 04 0B 09 01 17 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x18, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x17, 0x00, 0x0A, 0x5C, 0x43,
+		// #17 r 01 02 03 04 0B 09 01 17 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x18, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x17, 0x00, 0x0B, 0x6C, 0x39,
+		// #18 r 01 02 03 04 0B 09 01 17 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x18, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x17, 0x00, 0x0A, 0x6C, 0xFD,
+		// #19 r 01 02 03 04 0B 09 01 24 04
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xBF, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x24, 0x04, 0x00, 0x00, 0x00,
+		0x00, 0x10, 0x12, 0x00, 0x01, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x14, 0x14, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xB4, 0x00, 0x14,
+		0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0xE0, 0x2E, 0x35, 0x0D, 0x2C, 0x01, 0x05, 0x78, 0x78, 0x14, 0x08, 0x07, 0x08, 0x07, 0x18, 0x15,
+		0x05, 0xB0, 0x04, 0x8C, 0x0A, 0x1E, 0x00, 0x10, 0x0E, 0x10, 0x0E, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x8C, 0x0A, 0x23, 0x2C, 0x01,
+		0x80, 0x16, 0xC1, 0xA8, 0x0A, 0xC7, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xA8, 0x0A, 0x01, 0x64, 0x01, 0x83, 0x00, 0x00, 0x2C, 0x01, 0x18, 0x01, 0xC8,
+		0x00, 0x6C, 0x02, 0x2C, 0x01, 0x6A, 0xFF, 0x78, 0x00, 0x2C, 0x01, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x02, 0x00, 0x02, 0x06, 0x00, 0x05,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68,
+		// #20 r 01 02 03 04 0B 09 01 24 04
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xBF, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x24, 0x04, 0x00, 0x00, 0x00,
+		0x00, 0x10, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x14, 0x14, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xB4, 0x00, 0x14,
+		0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0xE0, 0x2E, 0x10, 0x0E, 0x2C, 0x01, 0x05, 0x78, 0x78, 0x14, 0x08, 0x07, 0x08, 0x07, 0x18, 0x15,
+		0x05, 0xB0, 0x04, 0x8C, 0x0A, 0x1E, 0x00, 0x10, 0x0E, 0x10, 0x0E, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x8C, 0x0A, 0x1F, 0x2C, 0x01,
+		0x80, 0x16, 0xC1, 0xA8, 0x0A, 0xC7, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xA8, 0x0A, 0x01, 0x64, 0x01, 0x83, 0x00, 0x00, 0x2C, 0x01, 0x18, 0x01, 0xC8,
+		0x00, 0x6C, 0x02, 0x2C, 0x01, 0x6A, 0xFF, 0x78, 0x00, 0x2C, 0x01, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x02, 0x00, 0x02, 0x06, 0x00, 0x05,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94,
+		// #21 r 01 02 03 04 0B 09 01 47 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x18, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x47, 0x01, 0x21, 0x21, 0xD7,
+		// #22 r 01 02 03 04 0B 09 01 47 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x18, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x47, 0x01, 0x20, 0x20, 0x4D,
+		// #23 r 01 02 03 04 0B 09 01 47 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x18, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x47, 0x01, 0x21, 0x01, 0xF4,
+		// #24 r 01 02 03 04 0B 09 01 47 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x18, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x47, 0x01, 0x21, 0x03, 0x48,
+		// #25 r 01 02 03 04 0B 09 01 47 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x18, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x47, 0x01, 0x21, 0x0B, 0x8A,
+		// #26 r 01 02 03 04 0B 09 01 47 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x18, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x47, 0x01, 0x21, 0x31, 0x4A,
+		// #27 r 01 02 03 04 0B 09 01 47 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x18, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x47, 0x01, 0x21, 0x41, 0xB2,
+		// #28 r 01 02 03 04 0B 09 01 47 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x18, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x47, 0x01, 0x21, 0x51, 0x2F,
+		// #29 r 01 02 03 04 0B 09 01 47 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x18, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x47, 0x01, 0x21, 0x61, 0x91,
+		// #30 r 01 02 03 04 0B 09 01 47 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x18, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x47, 0x01, 0xA1, 0x87, 0x8A,
+		// #31 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0x00, 0x00, 0x00,
+		0x1E, 0x00, 0x00, 0x00, 0x05, 0xC4, 0x0A, 0xFF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x95, 0x79, 0x04, 0x29, 0x00, 0x00, 0x07, 0x3D, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB,
+		// #32 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0x00, 0x00, 0x00,
+		0x1E, 0x00, 0x00, 0x00, 0x05, 0xC4, 0x0A, 0xFF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x95, 0x79, 0x04, 0x29, 0x00, 0x00, 0x07, 0x3D, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+		// #33 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0x00, 0x00, 0x00,
+		0x1E, 0x00, 0x00, 0x00, 0x05, 0xC4, 0x0A, 0xFF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x95, 0x79, 0x04, 0x29, 0x00, 0x00, 0x07, 0x3D, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96,
+		// #34 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0x00, 0x00, 0x00,
+		0x1E, 0x00, 0x00, 0x00, 0x05, 0xC4, 0x0A, 0xFF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x95, 0x79, 0x04, 0x29, 0x00, 0x00, 0x07, 0x3D, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+		// #35 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0x00, 0x00, 0x00,
+		0x1E, 0x00, 0x00, 0x00, 0x05, 0xC4, 0x0A, 0xFF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x95, 0x79, 0x04, 0x29, 0x00, 0x00, 0x07, 0x3D, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1,
+		// #36 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0x00, 0x00, 0x00,
+		0x1E, 0x00, 0x00, 0x00, 0x05, 0xC4, 0x0A, 0xFF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x95, 0x79, 0x04, 0x29, 0x00, 0x00, 0x07, 0x3D, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+		// #37 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0x00, 0x00, 0x00,
+		0x1E, 0x00, 0x00, 0x00, 0x05, 0xC4, 0x0A, 0xFF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x95, 0x79, 0x04, 0x29, 0x00, 0x00, 0x07, 0x3D, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8,
+		// #38 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0x00, 0x00, 0x00,
+		0x1E, 0x00, 0x00, 0x00, 0x05, 0xC4, 0x0A, 0xFF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x95, 0x79, 0x04, 0x29, 0x00, 0x00, 0x07, 0x3D, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C,
+		// #39 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xC4, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x14, 0x5B, 0x04, 0x29, 0x00, 0x00, 0x86, 0x1E, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3,
+		// #40 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xC5, 0x00, 0x04,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x40, 0x6E, 0x04, 0x29, 0x00, 0x00, 0xB2, 0x31, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31,
+		// #41 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xC5, 0x00, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x02, 0x8B, 0x04, 0x29, 0x00, 0x00, 0x74, 0x4E, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71,
+		// #42 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xC6, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0xB6, 0x37, 0x04, 0x29, 0x00, 0x00, 0xC8, 0x87, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+		// #43 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xC3, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4A, 0x83, 0x04, 0x29, 0x00, 0x00, 0xBC, 0x46, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39,
+		// #44 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xC3, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0xC4, 0x39, 0x04, 0x29, 0x00, 0x00, 0xD6, 0x89, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27,
+		// #45 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0x00, 0x00, 0x00,
+		0x1E, 0x00, 0x00, 0x00, 0x05, 0xC4, 0x0A, 0xFF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x95, 0x79, 0x04, 0x29, 0x00, 0x00, 0x07, 0x3D, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74,
+		// #46 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0x00, 0x00, 0x00,
+		0x1E, 0x00, 0x00, 0x00, 0x05, 0xC4, 0x0A, 0xFF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x95, 0x79, 0x04, 0x29, 0x00, 0x00, 0x07, 0x3D, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+		// #47 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0x00, 0x00, 0x00,
+		0x1E, 0x00, 0x00, 0x00, 0x05, 0xC4, 0x0A, 0xFF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x95, 0x79, 0x04, 0x29, 0x00, 0x00, 0x07, 0x3D, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD,
+		// #48 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0x00, 0x00, 0x00,
+		0x1E, 0x00, 0x00, 0x00, 0x05, 0xC4, 0x0A, 0xFF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x95, 0x79, 0x04, 0x29, 0x00, 0x00, 0x07, 0x3D, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D,
+		// #49 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0x00, 0x00, 0x00,
+		0x1E, 0x00, 0x00, 0x00, 0x05, 0xC4, 0x0A, 0xFF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x95, 0x79, 0x04, 0x29, 0x00, 0x00, 0x07, 0x3D, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5,
+		// #50 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0x00, 0x00, 0x00,
+		0x1E, 0x00, 0x00, 0x00, 0x05, 0xC4, 0x0A, 0xFF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x95, 0x79, 0x04, 0x29, 0x00, 0x00, 0x07, 0x3D, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A,
+		// #51 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0x00, 0x00, 0x00,
+		0x1E, 0x00, 0x00, 0x00, 0x05, 0xC4, 0x0A, 0xFF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x95, 0x79, 0x04, 0x29, 0x00, 0x00, 0x07, 0x3D, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+		// #52 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0x00, 0x00, 0x00,
+		0x1E, 0x00, 0x00, 0x00, 0x05, 0xC4, 0x0A, 0xFF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x95, 0x79, 0x04, 0x29, 0x00, 0x00, 0x07, 0x3D, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D,
+		// #53 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0x00, 0x00, 0x00,
+		0x1E, 0x00, 0x00, 0x00, 0x05, 0xC4, 0x0A, 0xFF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x95, 0x79, 0x04, 0x29, 0x00, 0x00, 0x07, 0x3D, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53,
+		// #54 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0x00, 0x00, 0x00,
+		0x1E, 0x00, 0x00, 0x00, 0x05, 0xC4, 0x0A, 0xFF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x95, 0x79, 0x04, 0x29, 0x00, 0x00, 0x07, 0x3D, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9E,
+		// #55 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0x00, 0x00, 0x00,
+		0x1E, 0x00, 0x00, 0x00, 0x05, 0xC4, 0x0A, 0xFF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x95, 0x79, 0x04, 0x29, 0x00, 0x00, 0x07, 0x3D, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+		// #56 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xCE, 0x00, 0x05,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x96, 0x1E, 0x04, 0x29, 0x00, 0x00, 0xA8, 0x6E, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42,
+		// #57 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xCE, 0x00, 0x02,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x58, 0x3B, 0x04, 0x29, 0x00, 0x00, 0x6A, 0x8B, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA,
+		// #58 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xCD, 0x00, 0x05,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x84, 0x4E, 0x04, 0x29, 0x00, 0x00, 0xF6, 0x11, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC,
+		// #59 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xCD, 0x00, 0x02,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x46, 0x6B, 0x04, 0x29, 0x00, 0x00, 0xB8, 0x2E, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D,
+		// #60 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xCD, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x08, 0x88, 0x04, 0x29, 0x00, 0x00, 0x7A, 0x4B, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE,
+		// #61 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xC3, 0x00, 0x04,
+		0x15, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0A, 0xEB, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x62, 0x21, 0x04, 0x29, 0x00, 0x00, 0x74, 0x71, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47,
+		// #62 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xD1, 0x00, 0x05,
+		0x11, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x96, 0x45, 0x04, 0x29, 0x00, 0x00, 0x08, 0x09, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1,
+		// #63 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xD1, 0x00, 0x02,
+		0x0E, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x58, 0x62, 0x04, 0x29, 0x00, 0x00, 0xCA, 0x25, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9E,
+		// #64 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xD1, 0x00, 0x00,
+		0x0B, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x1A, 0x7F, 0x04, 0x29, 0x00, 0x00, 0x8C, 0x42, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB,
+		// #65 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xD1, 0x00, 0x00,
+		0x09, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0xA6, 0x05, 0x04, 0x29, 0x00, 0x00, 0xB8, 0x55, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D,
+		// #66 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xD1, 0x00, 0x00,
+		0x06, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x68, 0x22, 0x04, 0x29, 0x00, 0x00, 0x7A, 0x72, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87,
+		// #67 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xD1, 0x00, 0x00,
+		0x03, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x2A, 0x3F, 0x04, 0x29, 0x00, 0x00, 0x9C, 0x02, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56,
+		// #68 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xD0, 0x00, 0x05,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0xEC, 0x5B, 0x04, 0x29, 0x00, 0x00, 0x5E, 0x1F, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D,
+		// #69 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xD0, 0x00, 0x02,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0xAE, 0x78, 0x04, 0x29, 0x00, 0x00, 0x20, 0x3C, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D,
+		// #70 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xCA, 0x00, 0x04,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0xD0, 0x08, 0x04, 0x29, 0x00, 0x00, 0xE2, 0x58, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
+		// #71 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xC7, 0x00, 0x05,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x28, 0x2F, 0x04, 0x29, 0x00, 0x00, 0x3A, 0x7F, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B,
+		// #72 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xC7, 0x00, 0x02,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0xEA, 0x4B, 0x04, 0x29, 0x00, 0x00, 0x5C, 0x0F, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45,
+		// #73 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xC7, 0x00, 0x05,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x64, 0x02, 0x04, 0x29, 0x00, 0x00, 0x76, 0x52, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6,
+		// #74 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xC6, 0x00, 0x05,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x52, 0x32, 0x04, 0x29, 0x00, 0x00, 0x64, 0x82, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2,
+		// #75 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xC6, 0x00, 0x02,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x14, 0x4F, 0x04, 0x29, 0x00, 0x00, 0x86, 0x12, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D,
+		// #76 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xC5, 0x00, 0x05,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x6C, 0x75, 0x04, 0x29, 0x00, 0x00, 0xDE, 0x38, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73,
+		// #77 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xC5, 0x00, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x24, 0x0F, 0x04, 0x29, 0x00, 0x00, 0x36, 0x5F, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+		// #78 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xCA, 0x00, 0x02,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x48, 0x15, 0x04, 0x29, 0x00, 0x00, 0x5A, 0x65, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92,
+		// #79 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xCA, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x74, 0x28, 0x04, 0x29, 0x00, 0x00, 0x86, 0x78, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1,
+		// #80 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xCA, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x36, 0x45, 0x04, 0x29, 0x00, 0x00, 0xA8, 0x08, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D,
+		// #81 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xCC, 0x00, 0x03,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x46, 0x05, 0x04, 0x29, 0x00, 0x00, 0x58, 0x55, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+		// #82 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xCC, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x08, 0x22, 0x04, 0x29, 0x00, 0x00, 0x1A, 0x72, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79,
+		// #83 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xCD, 0x00, 0x02,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0xCA, 0x3E, 0x04, 0x29, 0x00, 0x00, 0x3C, 0x02, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+		// #84 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xCD, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x22, 0x65, 0x04, 0x29, 0x00, 0x00, 0x94, 0x28, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39,
+		// #85 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xCE, 0x00, 0x04,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0xE4, 0x81, 0x04, 0x29, 0x00, 0x00, 0x56, 0x45, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4,
+		// #86 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xCE, 0x00, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x06, 0x12, 0x04, 0x29, 0x00, 0x00, 0x18, 0x62, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34,
+		// #87 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xC3, 0x00, 0x04,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x82, 0x5D, 0x04, 0x29, 0x00, 0x00, 0xF4, 0x20, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+		// #88 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xC3, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0xD0, 0x00, 0x04, 0x29, 0x00, 0x00, 0xE2, 0x50, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+		// #89 r 01 02 03 04 0B 09 01 85 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x68, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03, 0xC3, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0A, 0xDF, 0x00, 0x87, 0x00, 0x48, 0x03, 0x00, 0x00, 0x28, 0x27, 0x04, 0x29, 0x00, 0x00, 0x3A, 0x77, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57,
+		// #90 r 01 02 03 04 0B 09 01 B2 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC7, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xB2, 0x00, 0x22, 0xFC, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x03, 0x02, 0x00, 0x48, 0x80,
+		0x61, 0x42, 0xED, 0x22, 0x6F, 0x43, 0xBC, 0x88, 0xD9, 0x43, 0xDC, 0x98, 0x61, 0x43, 0x5C, 0x7D, 0xD4, 0x43, 0x23, 0x4E, 0xDB, 0x43, 0xC8, 0x7C,
+		0x34, 0x42, 0x48, 0xC1, 0xEA, 0x43, 0x6A, 0x6C, 0x5F, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x43, 0xEF, 0xF4,
+		0x61, 0x42, 0x8C, 0x3B, 0x6F, 0x43, 0x12, 0x68, 0xDA, 0x43, 0x91, 0x6F, 0x61, 0x43, 0xF7, 0x30, 0xD6, 0x43, 0xA8, 0x97, 0xDB, 0x43, 0x0D, 0xC0,
+		0x2B, 0x42, 0xB8, 0x93, 0xEA, 0x43, 0xC6, 0x33, 0x3F, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x43, 0x0D, 0x00,
+		0x7F, 0xC0, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x47, 0x00, 0x83, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xB1, 0x03, 0x87, 0x13,
+		0x1F, 0x16, 0xFC, 0x18, 0xEC, 0x15, 0x1A,
+		// #91 r 01 02 03 04 0B 09 01 B2 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC7, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xB2, 0x00, 0x22, 0xFC, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x09, 0x02, 0x01, 0x00, 0xCF, 0x7C,
+		0x62, 0x42, 0x11, 0x00, 0x6F, 0x43, 0x73, 0x90, 0xD3, 0x43, 0xEF, 0xFF, 0x61, 0x43, 0x1D, 0xFE, 0xB1, 0x43, 0x2A, 0xB3, 0xD5, 0x43, 0xA9, 0xA7,
+		0xC4, 0x42, 0x08, 0x79, 0xEC, 0x43, 0xFA, 0xB5, 0x14, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x43, 0x33, 0x8A,
+		0x62, 0x42, 0x11, 0x00, 0x6F, 0x43, 0x05, 0xC6, 0xD3, 0x43, 0xD4, 0xFF, 0x61, 0x43, 0x0E, 0x50, 0xB2, 0x43, 0x66, 0xDC, 0xD5, 0x43, 0x66, 0x97,
+		0xBF, 0x42, 0x2E, 0x65, 0xEC, 0x43, 0xBF, 0x32, 0x13, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x43, 0x0D, 0x00,
+		0x00, 0xC0, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x44, 0x00, 0x70, 0x00, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xB0, 0x03, 0x88, 0x13,
+		0x1F, 0x16, 0xD0, 0x18, 0xEC, 0x15, 0x27,
+		// #92 r 01 02 03 04 0B 09 01 B2 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC7, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xB2, 0x00, 0x22, 0xFC, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+		0x64, 0x42, 0x11, 0x00, 0x70, 0x43, 0xEC, 0xFB, 0xD8, 0x43, 0xEF, 0xFF, 0x60, 0x43, 0x33, 0x40, 0x2B, 0x44, 0xD3, 0x8D, 0xE8, 0x43, 0x3C, 0x00,
+		0xA0, 0xC0, 0x4F, 0xF6, 0xE4, 0x43, 0x61, 0x00, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x43, 0x11, 0x00,
+		0x64, 0x42, 0x11, 0x00, 0x70, 0x43, 0xEE, 0xED, 0xD8, 0x43, 0xD4, 0xFF, 0x60, 0x43, 0x4C, 0x41, 0x2B, 0x44, 0xD8, 0x85, 0xE8, 0x43, 0x9D, 0x02,
+		0xA0, 0xC0, 0xA8, 0xDD, 0xE4, 0x43, 0x08, 0x04, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x43, 0x0D, 0x00,
+		0x7F, 0xC0, 0x21, 0x21, 0x21, 0x21, 0x00, 0x00, 0x4B, 0x00, 0x65, 0x00, 0xA0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xAC, 0x03, 0x89, 0x13,
+		0x21, 0x16, 0xFD, 0x18, 0xEA, 0x15, 0x90,
+		// #93 r 01 02 03 04 0B 09 01 B3 04
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x20, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xB3, 0x04, 0x02, 0x06, 0x00,
+		0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7,
+		// #94 r 01 02 03 04 0B 09 01 C4 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC5, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xC4, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x22, 0xFC, 0xC8, 0x00, 0x1C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0A,
+		0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x26, 0x02, 0xAC, 0x01, 0x04, 0x01, 0x6B, 0x00, 0x18, 0x00, 0xCD, 0x00, 0x60, 0x00, 0x00, 0x00, 0x3C, 0x01,
+		0x00, 0x00, 0xCC, 0xFC, 0xCC, 0xFC, 0xCC, 0xFC, 0xCC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0x00, 0x00, 0x00, 0xD2, 0x00,
+		0x34, 0x03, 0xA4, 0x06, 0x88, 0x13, 0xEB, 0x00, 0x1D, 0x01, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x3B, 0x01, 0xFE, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x2C, 0x00, 0x5A, 0x00, 0x3C, 0x01, 0x00, 0x00, 0x00, 0x00, 0xB9, 0xFF, 0xB9, 0xFF, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC,
+		0x22, 0xFC, 0x22, 0xFC, 0x88,
+		// #95 r 01 02 03 04 0B 09 01 C4 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC5, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xC4, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x22, 0xFC, 0xC8, 0x00, 0x1C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0A,
+		0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x26, 0x02, 0xB7, 0x01, 0x0B, 0x01, 0x5B, 0x00, 0x1D, 0x00, 0xD2, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x3C, 0x01,
+		0x00, 0x00, 0xCC, 0xFC, 0xCC, 0xFC, 0xCC, 0xFC, 0xCC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0x00, 0x00, 0x00, 0xD2, 0x00,
+		0x34, 0x03, 0xA4, 0x06, 0x88, 0x13, 0xEB, 0x00, 0x1D, 0x01, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x3B, 0x01, 0xFE, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x85, 0x00, 0x5A, 0x00, 0x3C, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xF4, 0xFF, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC,
+		0x22, 0xFC, 0x22, 0xFC, 0xA5,
+		// #96 r 01 02 03 04 0B 09 01 C4 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC5, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xC4, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x22, 0xFC, 0xC8, 0x00, 0x1C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0A,
+		0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x26, 0x02, 0xDD, 0x01, 0x24, 0x01, 0x4F, 0x00, 0x24, 0x00, 0xE2, 0x00, 0xFB, 0xFF, 0x00, 0x00, 0x3C, 0x01,
+		0x3C, 0x01, 0x4E, 0xFF, 0x94, 0xFF, 0xB8, 0xFF, 0xFA, 0xFD, 0x00, 0x00, 0x3C, 0x01, 0x3C, 0x01, 0x3C, 0x01, 0xD2, 0x00, 0x00, 0x00, 0xE2, 0x00,
+		0x34, 0x03, 0x1F, 0x07, 0x88, 0x13, 0xEB, 0x00, 0x1D, 0x01, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x3B, 0x01, 0xFE, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x14, 0x00, 0x00, 0x96, 0x09, 0x00, 0x00, 0x00, 0x00, 0x96, 0x09, 0x00, 0x00, 0x96, 0x09, 0x00, 0x00,
+		0x73, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0xE7, 0x03, 0x00, 0x00, 0xDC, 0x00, 0x02, 0x00, 0xDC, 0x00, 0xDC, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC,
+		0x22, 0xFC, 0x22, 0xFC, 0x0C,
+		// #97 r 01 02 03 04 0B 09 01 CC 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xAD, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xCC, 0x02, 0x1C, 0x02, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0A, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x26, 0x02,
+		0xAB, 0x01, 0x04, 0x01, 0x6C, 0x00, 0x18, 0x00, 0xCD, 0x00, 0x62, 0x00, 0x00, 0x00, 0x3C, 0x01, 0x00, 0x00, 0xCC, 0xFC, 0xCC, 0xFC, 0xCC, 0xFC,
+		0xCC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0x00, 0x00, 0x00, 0xD2, 0x00, 0x34, 0x03, 0xA4, 0x06, 0x88, 0x13, 0xEB, 0x00,
+		0x1D, 0x01, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x3B, 0x01, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x14,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x0B, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A, 0x24, 0x00, 0x5A, 0x00, 0x3C, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0xB7, 0xFF, 0x81,
+		// #98 r 01 02 03 04 0B 09 01 CC 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xAD, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xCC, 0x02, 0x1C, 0x02, 0x00,
+		0x00, 0x05, 0x05, 0xA8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0A, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x26, 0x02,
+		0xF0, 0x01, 0x31, 0x01, 0x52, 0x00, 0x25, 0x00, 0xEA, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3C, 0x01, 0x3C, 0x01, 0x65, 0xFF, 0x8B, 0xFF, 0xBA, 0xFF,
+		0xE1, 0xFD, 0x00, 0x00, 0x3C, 0x01, 0x3C, 0x01, 0x3C, 0x01, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x34, 0x03, 0x5C, 0x07, 0x88, 0x13, 0xEB, 0x00,
+		0x1D, 0x01, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x3B, 0x01, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x14,
+		0x00, 0x00, 0x96, 0x09, 0x00, 0x00, 0x00, 0x00, 0x96, 0x09, 0x00, 0x00, 0x96, 0x09, 0x00, 0x00, 0x9D, 0x04, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x01,
+		0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0xDC, 0x00,
+		0xD9, 0xFF, 0xB5, 0x00, 0xC1,
+		// #99 r 01 02 03 04 0B 09 01 CC 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xAD, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xCC, 0x02, 0x1C, 0x02, 0x00,
+		0x00, 0x6C, 0x05, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0A, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x26, 0x02,
+		0xEB, 0x01, 0x2D, 0x01, 0x54, 0x00, 0x23, 0x00, 0xE8, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3C, 0x01, 0x3C, 0x01, 0x5F, 0xFF, 0x84, 0xFF, 0xB5, 0xFF,
+		0xDC, 0xFD, 0x00, 0x00, 0x3C, 0x01, 0x3C, 0x01, 0x3C, 0x01, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x34, 0x03, 0x4D, 0x07, 0x88, 0x13, 0xEB, 0x00,
+		0x1D, 0x01, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x3B, 0x01, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x14,
+		0x00, 0x00, 0x96, 0x09, 0x00, 0x00, 0x00, 0x00, 0x96, 0x09, 0x00, 0x00, 0x96, 0x09, 0x00, 0x00, 0x92, 0x04, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x02,
+		0x0D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x6E, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0xDC, 0x00,
+		0xE0, 0xFF, 0xB6, 0x00, 0x75,
+		// #100 r 01 02 03 04 0B 09 01 CC 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xAD, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xCC, 0x02, 0x1C, 0x02, 0x00,
+		0x00, 0x7D, 0x05, 0x20, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0A, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x26, 0x02,
+		0xEA, 0x01, 0x2D, 0x01, 0x55, 0x00, 0x23, 0x00, 0xE8, 0x00, 0x11, 0x00, 0x00, 0x00, 0x3C, 0x01, 0x3C, 0x01, 0x5E, 0xFF, 0x83, 0xFF, 0xB5, 0xFF,
+		0xE2, 0xFD, 0x00, 0x00, 0x3C, 0x01, 0x3C, 0x01, 0x3C, 0x01, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x34, 0x03, 0x4D, 0x07, 0x88, 0x13, 0xEB, 0x00,
+		0x1D, 0x01, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x3B, 0x01, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x14,
+		0x00, 0x00, 0x96, 0x09, 0x00, 0x00, 0x00, 0x00, 0x96, 0x09, 0x00, 0x00, 0x96, 0x09, 0x00, 0x00, 0x8F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x02,
+		0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7F, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0xDC, 0x00,
+		0xE7, 0xFF, 0xBC, 0x00, 0xED,
+		// #101 r 01 02 03 04 0B 09 01 CC 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xAD, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xCC, 0x02, 0x1C, 0x02, 0x00,
+		0x00, 0x88, 0x06, 0x2B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0A, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x26, 0x02,
+		0xCD, 0x01, 0x19, 0x01, 0x74, 0x00, 0x18, 0x00, 0xDA, 0x00, 0x78, 0x00, 0x00, 0x00, 0x3C, 0x01, 0x3C, 0x01, 0x3A, 0xFF, 0x36, 0xFF, 0x9A, 0xFF,
+		0x2F, 0xFD, 0x00, 0x00, 0x3C, 0x01, 0x3C, 0x01, 0x3C, 0x01, 0x00, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x34, 0x03, 0xE2, 0x06, 0x88, 0x13, 0xEB, 0x00,
+		0x1D, 0x01, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x3B, 0x01, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x14,
+		0x00, 0x00, 0x96, 0x09, 0x00, 0x00, 0x00, 0x00, 0x96, 0x09, 0x00, 0x00, 0x96, 0x09, 0x00, 0x00, 0x4F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x57, 0x03,
+		0x0C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x8A, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0xDC, 0x00,
+		0x6E, 0xFF, 0x4A, 0x00, 0x4E,
+		// #102 r 01 02 03 04 0B 09 01 CC 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xAD, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xCC, 0x02, 0x1C, 0x02, 0x00,
+		0x00, 0xA6, 0x04, 0x49, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0A, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x26, 0x02,
+		0xF1, 0x01, 0x31, 0x01, 0x50, 0x00, 0x26, 0x00, 0xEB, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3C, 0x01, 0x3C, 0x01, 0x67, 0xFF, 0x8E, 0xFF, 0xBD, 0xFF,
+		0xF8, 0xFD, 0x00, 0x00, 0x3C, 0x01, 0x3C, 0x01, 0x3C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x34, 0x03, 0xFD, 0x07, 0x88, 0x13, 0x1D, 0x01,
+		0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x01, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x14,
+		0x00, 0x00, 0x96, 0x09, 0x00, 0x00, 0x00, 0x00, 0x96, 0x09, 0x00, 0x00, 0x96, 0x09, 0x00, 0x00, 0x9F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x75, 0x01,
+		0x0A, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xA8, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A, 0x00, 0x00, 0xE7, 0x03, 0x00, 0x00, 0xDC, 0x00,
+		0xEB, 0xFF, 0xC7, 0x00, 0x9D,
+		// #103 r 01 02 03 04 0B 09 01 CC 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xAD, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xCC, 0x02, 0x1C, 0x02, 0x00,
+		0x00, 0xF5, 0x06, 0x98, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0A, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x26, 0x02,
+		0x74, 0x01, 0xE3, 0x00, 0x6F, 0x00, 0x14, 0x00, 0xB6, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x3C, 0x01, 0x00, 0x00, 0xCC, 0xFC, 0xCC, 0xFC, 0xCC, 0xFC,
+		0xCC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0x00, 0x34, 0x03, 0xA4, 0x06, 0x88, 0x13, 0xEB, 0x00,
+		0x1D, 0x01, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x3B, 0x01, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x14,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xEE, 0xFF, 0x56,
+		// #104 r 01 02 03 04 0B 09 01 CC 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xAD, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xCC, 0x02, 0x1C, 0x02, 0x00,
+		0x00, 0xF7, 0x05, 0x9A, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0A, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x26, 0x02,
+		0xE0, 0x01, 0x26, 0x01, 0x57, 0x00, 0x21, 0x00, 0xE3, 0x00, 0x19, 0x00, 0x00, 0x00, 0x3C, 0x01, 0x3C, 0x01, 0x51, 0xFF, 0x7D, 0xFF, 0xB0, 0xFF,
+		0xAD, 0xFD, 0x00, 0x00, 0x3C, 0x01, 0x3C, 0x01, 0x3C, 0x01, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x34, 0x03, 0x27, 0x07, 0x88, 0x13, 0xEB, 0x00,
+		0x1D, 0x01, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x3B, 0x01, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x14,
+		0x00, 0x00, 0x96, 0x09, 0x00, 0x00, 0x00, 0x00, 0x96, 0x09, 0x00, 0x00, 0x96, 0x09, 0x00, 0x00, 0x79, 0x04, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x02,
+		0x02, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF9, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0xDC, 0x00,
+		0xC0, 0xFF, 0x9C, 0x00, 0xED,
+		// #105 r 01 02 03 04 0B 09 01 F5 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x40, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xF5, 0x01, 0x46, 0x01, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xE1, 0x00, 0x31, 0x00, 0xCC, 0x02, 0x00, 0x00, 0xFD, 0x02, 0x51, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0xD2, 0x00, 0x07,
+		// #106 r 01 02 03 04 0B 09 01 F5 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x40, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xF5, 0x01, 0x46, 0x01, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xE1, 0x00, 0x39, 0x00, 0xC4, 0x02, 0x00, 0x00, 0xFD, 0x02, 0x51, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0xD2, 0x00, 0xAD,
+		// #107 r 01 02 03 04 0B 09 01 F5 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x40, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xF5, 0x01, 0x46, 0x01, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xE2, 0x00, 0x87, 0x05, 0x76, 0xFD, 0x00, 0x00, 0xFD, 0x02, 0x51, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0xD2, 0x00, 0xD5,
+		// #108 r 01 02 03 04 0B 09 01 F5 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x40, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xF5, 0x01, 0x46, 0x01, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xE2, 0x00, 0x8F, 0x05, 0x6E, 0xFD, 0x00, 0x00, 0xFD, 0x02, 0x51, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0xD2, 0x00, 0x59,
+		// #109 r 01 02 03 04 0B 09 01 F5 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x40, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xF5, 0x01, 0x46, 0x01, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xE2, 0x00, 0x97, 0x05, 0x66, 0xFD, 0x00, 0x00, 0xFD, 0x02, 0x51, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0xD2, 0x00, 0x98,
+		// #110 r 01 02 03 04 0B 09 01 F5 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x40, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xF5, 0x01, 0x46, 0x01, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xE2, 0x00, 0xA0, 0x05, 0x5D, 0xFD, 0x00, 0x00, 0xFD, 0x02, 0x51, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0xD2, 0x00, 0x79,
+		// #111 r 01 02 03 04 0B 09 01 F5 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x40, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xF5, 0x01, 0x47, 0x01, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xE1, 0x00, 0x20, 0x00, 0xDD, 0x02, 0x00, 0x00, 0xFD, 0x02, 0x51, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0xD2, 0x00, 0xA6,
+		// #112 r 01 02 03 04 0B 09 01 F5 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x40, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xF5, 0x01, 0x47, 0x01, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xE2, 0x00, 0x1A, 0x05, 0xE3, 0xFD, 0x00, 0x00, 0xFD, 0x02, 0x51, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0xD2, 0x00, 0xC2,
+		// #113 r 01 02 03 04 0B 09 01 F5 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x40, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xF5, 0x01, 0x47, 0x01, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xE2, 0x00, 0x20, 0x00, 0xDD, 0x02, 0x00, 0x00, 0xFD, 0x02, 0x51, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00, 0x77, 0x00, 0x77, 0x00, 0xE0, 0x01, 0xD2, 0x00, 0x42,
+		// #114 r 01 02 03 04 0B 09 01 F5 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x40, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xF5, 0x01, 0x47, 0x01, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xE2, 0x00, 0x20, 0x00, 0xDD, 0x02, 0x00, 0x00, 0xFD, 0x02, 0x51, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0xD2, 0x00, 0x9C,
+		// #115 r 01 02 03 04 0B 09 01 F5 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x40, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xF5, 0x01, 0x47, 0x01, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xE2, 0x00, 0x23, 0x05, 0xDA, 0xFD, 0x00, 0x00, 0xFD, 0x02, 0x51, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0xD2, 0x00, 0xEC,
+		// #116 r 01 02 03 04 0B 09 01 F5 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x40, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xF5, 0x01, 0x47, 0x01, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xE2, 0x00, 0x2B, 0x05, 0xD2, 0xFD, 0x00, 0x00, 0xFD, 0x02, 0x51, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00, 0x77, 0x00, 0x77, 0x00, 0xDF, 0x01, 0xD2, 0x00, 0x4A,
+		// #117 r 01 02 03 04 0B 09 01 F5 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x40, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xF5, 0x01, 0x47, 0x01, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xE2, 0x00, 0x2B, 0x05, 0xD2, 0xFD, 0x00, 0x00, 0xFD, 0x02, 0x51, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0xD2, 0x00, 0x46,
+		// #118 r 01 02 03 04 0B 09 01 F5 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x40, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xF5, 0x01, 0x47, 0x01, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xE2, 0x00, 0x52, 0x04, 0xAB, 0xFE, 0x00, 0x00, 0xFD, 0x02, 0x51, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0xD2, 0x00, 0x55,
+		// #119 r 01 02 03 04 0B 09 01 F5 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x40, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xF5, 0x01, 0x47, 0x01, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xE2, 0x00, 0x8D, 0x04, 0x70, 0xFE, 0x00, 0x00, 0xFD, 0x02, 0x51, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0xD2, 0x00, 0xE0,
+		// #120 r 01 02 03 04 0B 09 01 F5 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x40, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xF5, 0x01, 0x47, 0x01, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xE2, 0x00, 0xB6, 0x00, 0x47, 0x02, 0x00, 0x00, 0xFD, 0x02, 0x51, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0xD2, 0x00, 0xEE,
+		// #121 r 01 02 03 04 0B 09 01 F5 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x40, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xF5, 0x01, 0x47, 0x01, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xE2, 0x00, 0xCF, 0x04, 0x2E, 0xFE, 0x00, 0x00, 0xFD, 0x02, 0x51, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0xD2, 0x00, 0xDB,
+		// #122 r 01 02 03 04 0B 09 01 F5 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x40, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xF5, 0x01, 0x47, 0x01, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xE2, 0x00, 0xE2, 0x01, 0x1B, 0x01, 0x00, 0x00, 0xFD, 0x02, 0x51, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0xD2, 0x00, 0xD8,
+		// #123 r 01 02 03 04 0B 09 01 F5 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x40, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xF5, 0x01, 0xE2, 0x00, 0x9C,
+		0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xE1, 0x00, 0x71, 0x03, 0x8C, 0xFF, 0x00, 0x00, 0xFD, 0x02, 0x51, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0xD2, 0x00, 0x44,
+		// #124 r 01 02 03 04 0B 09 03 14 0F
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x26, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x03, 0x14, 0x0F, 0x09, 0x00, 0x00,
+		0x08, 0x09, 0x17, 0x32, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x2D,
+		// #125 r 01 02 03 04 0B 09 03 21 0F
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x6D, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x03, 0x21, 0x0F, 0x00, 0x00, 0x07,
+		0x01, 0x02, 0x00, 0x06, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+		0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+		0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+		0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x77,
+		// #126 r 01 02 03 04 0B 09 03 6F 0E
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x58, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x03, 0x6F, 0x0E, 0x11, 0x03, 0x12,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x0C, 0x16, 0x0C, 0x00, 0x00, 0x01, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x17, 0x12,
+		0x30, 0x15, 0x02, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x17, 0x12, 0x30, 0x19, 0x03, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x08, 0x01, 0x17, 0x0B, 0x39, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1,
+		// #127 r 01 02 03 04 0B 09 00 39 04
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x18, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x39, 0x04, 0x00, 0x00, 0xEA,
+		// #128 r 01 02 03 04 0B 09 04 4E 3F
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2C, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x04, 0x4E, 0x3F, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A,
+		// #129 r 01 02 03 04 0B 09 04 9C 3E
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x04, 0x9C, 0x3E, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF,
+		// #130 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x33, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x39, 0x42, 0x0F, 0x00, 0x30, 0x87, 0x0B, 0x00, 0x85, 0x56, 0x1D, 0x00, 0xA5,
+		// #131 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x33, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x39, 0x42, 0x0F, 0x00, 0x30, 0x87, 0x0B, 0x00, 0x86, 0x56, 0x1D, 0x00, 0x2D,
+		// #132 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x50, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x56, 0x42, 0x0F, 0x00, 0x37, 0x87, 0x0B, 0x00, 0x8E, 0x56, 0x1D, 0x00, 0x41,
+		// #133 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x51, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x56, 0x42, 0x0F, 0x00, 0x37, 0x87, 0x0B, 0x00, 0x8E, 0x56, 0x1D, 0x00, 0x8A,
+		// #134 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x51, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x56, 0x42, 0x0F, 0x00, 0x37, 0x87, 0x0B, 0x00, 0x8F, 0x56, 0x1D, 0x00, 0x05,
+		// #135 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x57, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x5D, 0x42, 0x0F, 0x00, 0x39, 0x87, 0x0B, 0x00, 0x90, 0x56, 0x1D, 0x00, 0x45,
+		// #136 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x20, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x26, 0x42, 0x0F, 0x00, 0x2C, 0x87, 0x0B, 0x00, 0x7E, 0x56, 0x1D, 0x00, 0xCF,
+		// #137 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x21, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x27, 0x42, 0x0F, 0x00, 0x2C, 0x87, 0x0B, 0x00, 0x7E, 0x56, 0x1D, 0x00, 0x6C,
+		// #138 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x33, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x39, 0x42, 0x0F, 0x00, 0x30, 0x87, 0x0B, 0x00, 0x83, 0x56, 0x1D, 0x00, 0xAC,
+		// #139 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x33, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x39, 0x42, 0x0F, 0x00, 0x30, 0x87, 0x0B, 0x00, 0x84, 0x56, 0x1D, 0x00, 0x2A,
+		// #140 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x49, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x4E, 0x42, 0x0F, 0x00, 0x35, 0x87, 0x0B, 0x00, 0x8D, 0x56, 0x1D, 0x00, 0x2B,
+		// #141 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x49, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x4F, 0x42, 0x0F, 0x00, 0x36, 0x87, 0x0B, 0x00, 0x8D, 0x56, 0x1D, 0x00, 0x86,
+		// #142 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x4A, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x4F, 0x42, 0x0F, 0x00, 0x36, 0x87, 0x0B, 0x00, 0x8D, 0x56, 0x1D, 0x00, 0xC2,
+		// #143 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x34, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x39, 0x42, 0x0F, 0x00, 0x30, 0x87, 0x0B, 0x00, 0x87, 0x56, 0x1D, 0x00, 0xE1,
+		// #144 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x34, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x3A, 0x42, 0x0F, 0x00, 0x30, 0x87, 0x0B, 0x00, 0x88, 0x56, 0x1D, 0x00, 0xC3,
+		// #145 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x35, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x3A, 0x42, 0x0F, 0x00, 0x30, 0x87, 0x0B, 0x00, 0x88, 0x56, 0x1D, 0x00, 0x08,
+		// #146 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x35, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x3A, 0x42, 0x0F, 0x00, 0x31, 0x87, 0x0B, 0x00, 0x88, 0x56, 0x1D, 0x00, 0x4B,
+		// #147 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x35, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x3B, 0x42, 0x0F, 0x00, 0x31, 0x87, 0x0B, 0x00, 0x88, 0x56, 0x1D, 0x00, 0x23,
+		// #148 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x36, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x3B, 0x42, 0x0F, 0x00, 0x31, 0x87, 0x0B, 0x00, 0x88, 0x56, 0x1D, 0x00, 0x67,
+		// #149 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x36, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x3C, 0x42, 0x0F, 0x00, 0x31, 0x87, 0x0B, 0x00, 0x88, 0x56, 0x1D, 0x00, 0x66,
+		// #150 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x37, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x3C, 0x42, 0x0F, 0x00, 0x31, 0x87, 0x0B, 0x00, 0x88, 0x56, 0x1D, 0x00, 0xAD,
+		// #151 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x37, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x3D, 0x42, 0x0F, 0x00, 0x31, 0x87, 0x0B, 0x00, 0x88, 0x56, 0x1D, 0x00, 0xC5,
+		// #152 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x38, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x3D, 0x42, 0x0F, 0x00, 0x31, 0x87, 0x0B, 0x00, 0x88, 0x56, 0x1D, 0x00, 0x88,
+		// #153 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x40, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x45, 0x42, 0x0F, 0x00, 0x33, 0x87, 0x0B, 0x00, 0x8A, 0x56, 0x1D, 0x00, 0x28,
+		// #154 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x40, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x46, 0x42, 0x0F, 0x00, 0x33, 0x87, 0x0B, 0x00, 0x8A, 0x56, 0x1D, 0x00, 0x90,
+		// #155 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x41, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x46, 0x42, 0x0F, 0x00, 0x33, 0x87, 0x0B, 0x00, 0x8B, 0x56, 0x1D, 0x00, 0xD4,
+		// #156 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x41, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x47, 0x42, 0x0F, 0x00, 0x34, 0x87, 0x0B, 0x00, 0x8B, 0x56, 0x1D, 0x00, 0x6C,
+		// #157 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x42, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x47, 0x42, 0x0F, 0x00, 0x34, 0x87, 0x0B, 0x00, 0x8B, 0x56, 0x1D, 0x00, 0x28,
+		// #158 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x0E, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x14, 0x42, 0x0F, 0x00, 0x27, 0x87, 0x0B, 0x00, 0x79, 0x56, 0x1D, 0x00, 0xAB,
+		// #159 r 01 02 03 04 0B 09 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x0F, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05, 0x00, 0x14, 0x42, 0x0F, 0x00, 0x27, 0x87, 0x0B, 0x00, 0x79, 0x56, 0x1D, 0x00, 0x60,
+		// #160 r 01 02 03 04 0B 09 03 0B 0D
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x03, 0x0B, 0x0D, 0x0C, 0x08, 0x01,
+		0x17, 0x0C, 0x00, 0x00, 0x01, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x17, 0x00, 0x02, 0x0F, 0x02, 0x12, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x09, 0x01, 0x17, 0x00, 0x02, 0x11, 0x03, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x17, 0x00, 0x02, 0x32, 0x01, 0x12,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x17, 0x06, 0x0D, 0x39, 0x02, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x17, 0x06,
+		0x0E, 0x00, 0x03, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x17, 0x0C, 0x00, 0x00, 0x01, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x09, 0x01, 0x17, 0x0C, 0x00, 0x26, 0x02, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x17, 0x0C, 0x00, 0x2A, 0x03, 0x12, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x17, 0x0C, 0x33, 0x17, 0x01, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x17, 0x0C, 0x33, 0x21,
+		0x02, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x17, 0x0C, 0x33, 0x26, 0x03, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0C,
+		0x16, 0x0C, 0x38, 0x09, 0x00, 0x00, 0x00, 0xA6,
+		// #161 r 01 02 03 04 0B 09 03 BD 0D
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x03, 0xBD, 0x0D, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x0B, 0x01, 0x17, 0x16, 0x10, 0x30, 0x02, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x01, 0x17, 0x16, 0x10, 0x32, 0x03, 0x12,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x01, 0x17, 0x16, 0x11, 0x15, 0x01, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x01, 0x17, 0x16,
+		0x11, 0x21, 0x02, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x0C, 0x16, 0x0C, 0x00, 0x00, 0x01, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x1A, 0x0C, 0x16, 0x10, 0x37, 0x37, 0x02, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x0C, 0x16, 0x10, 0x3A, 0x21, 0x03, 0x12, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x1B, 0x0C, 0x16, 0x0C, 0x00, 0x00, 0x01, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x0C, 0x16, 0x0D, 0x16, 0x26,
+		0x02, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x0C, 0x16, 0x0D, 0x16, 0x2A, 0x03, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x0C,
+		0x16, 0x0C, 0x00, 0x00, 0x01, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x0C, 0x16, 0x0D, 0x2F, 0x0E, 0x02, 0x12, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x1C, 0x0C, 0x16, 0x0D, 0x2F, 0x2A,
+		// #162 r 01 02 03 04 0B 09 03 BD 0D
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x03, 0xBD, 0x0D, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x0B, 0x01, 0x17, 0x16, 0x10, 0x30, 0x02, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x01, 0x17, 0x16, 0x10, 0x32, 0x03, 0x12,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x01, 0x17, 0x16, 0x11, 0x15, 0x01, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x01, 0x17, 0x16,
+		0x11, 0x21, 0x02, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x01, 0x17, 0x16, 0x11, 0x25, 0x03, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x1A, 0x0C, 0x16, 0x10, 0x37, 0x37, 0x02, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x0C, 0x16, 0x10, 0x3A, 0x21, 0x03, 0x12, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x1B, 0x0C, 0x16, 0x0C, 0x00, 0x00, 0x01, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x0C, 0x16, 0x0D, 0x16, 0x26,
+		0x02, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x0C, 0x16, 0x0D, 0x16, 0x2A, 0x03, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x0C,
+		0x16, 0x0C, 0x00, 0x00, 0x01, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x0C, 0x16, 0x0D, 0x2F, 0x0E, 0x02, 0x12, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x1C, 0x0C, 0x16, 0x0D, 0x2F, 0x18,
+		// #163 r 01 02 03 04 0B 09 05 00 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x56, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x00, 0x00, 0x37, 0x07, 0x22,
+		0x01, 0x11, 0x01, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x56, 0x14, 0x00, 0x00, 0x17, 0x0F, 0x00, 0x00, 0x9F, 0x0A, 0x00,
+		0x00, 0x65, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05,
+		0x00, 0x39, 0x42, 0x0F, 0x00, 0x30, 0x87, 0x0B, 0x00, 0x86, 0x56, 0x1D, 0x00, 0x0E,
+		// #164 r 01 02 03 04 0B 09 05 00 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x56, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x00, 0x00, 0x33, 0x59, 0x21,
+		0x01, 0x11, 0x01, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x14, 0x00, 0x00, 0x17, 0x0F, 0x00, 0x00, 0x9F, 0x0A, 0x00,
+		0x00, 0x65, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xFC, 0x3A, 0x00, 0x77, 0x71, 0x05,
+		0x00, 0x26, 0x42, 0x0F, 0x00, 0x2C, 0x87, 0x0B, 0x00, 0x7E, 0x56, 0x1D, 0x00, 0xA3,
+		// #165 W 01 02 03 04 0B 09 81 17 00
+		0x65, 0x6F, 0xDE, 0x02, 0xD3, 0x5E, 0x41, 0x44, 0x44, 0x52, 0x18, 0x57, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x81, 0x17, 0x00, 0x00, 0x01, 0x9A,
+		// #166 w 01 02 03 04 0B 09 81 17 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x17, 0x77, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x81, 0x17, 0x00, 0x4D, 0xBD,
+		// #167 W 01 02 03 04 0B 09 81 17 00
+		0x65, 0x6F, 0xDE, 0x02, 0xD3, 0x5E, 0x41, 0x44, 0x44, 0x52, 0x18, 0x57, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x81, 0x17, 0x00, 0x01, 0x00, 0x00,
+		// #168 w 01 02 03 04 0B 09 81 17 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x17, 0x77, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x81, 0x17, 0x00, 0x5C, 0x7E,
+		// #169 w 01 02 03 04 0B 09 81 17 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x17, 0x77, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x81, 0x17, 0x00, 0x6C, 0xC0,
+	};
+
+static const byte comfortzone_corpus_frame_types[170] =
+	{
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 3, 2, 3, 2, 3, 3,
+	};
+
+static const COMFORTZONE_CORPUS_VALUE comfortzone_corpus_values[] =
+	{
+		{ 3, CZSF_LED_LUMINOSITY_SETTING, 0 },
+		{ 4, CZSF_HOT_WATER_SETTING, 540 },
+		{ 5, CZSF_HOT_WATER_SETTING, 540 },
+		{ 11, CZSF_FAN_TIME_TO_FILTER_CHANGE, 88 },
+		{ 12, CZSF_FAN_TIME_TO_FILTER_CHANGE, 90 },
+		{ 13, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 46 },
+		{ 13, CZSF_SENSORS_TE1_FLOW_WATER, 272 },
+		{ 13, CZSF_SENSORS_TE2_RETURN_WATER, 285 },
+		{ 13, CZSF_SENSORS_TE3_INDOOR_TEMP, 225 },
+		{ 13, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 281 },
+		{ 13, CZSF_SENSORS_TE5_EXCHANGER_OUT, 276 },
+		{ 13, CZSF_SENSORS_TE6_EVAPORATOR_IN, 44 },
+		{ 13, CZSF_SENSORS_TE7_EXHAUST_AIR, 8 },
+		{ 13, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 464 },
+		{ 13, CZSF_COMPRESSOR_ACTIVITY, 4 },
+		{ 13, CZSF_DEFROST_ENABLED, 1 },
+		{ 13, CZSF_MODE, 4 },
+		{ 13, CZSF_ROOM_HEATING_IN_PROGRESS, 0 },
+		{ 13, CZSF_HOT_WATER_PRODUCTION, 0 },
+		{ 13, CZSF_FILTER_ALARM, 0 },
+		{ 13, CZSF_GENERAL_ALARM, 0 },
+		{ 13, CZSF_HOUR, 22 },
+		{ 13, CZSF_MINUTE, 51 },
+		{ 13, CZSF_SECOND, 55 },
+		{ 13, CZSF_DAY, 12 },
+		{ 13, CZSF_MONTH, 1 },
+		{ 13, CZSF_YEAR, 2023 },
+		{ 13, CZSF_DAY_OF_WEEK, 4 },
+		{ 21, CZSF_LED_LUMINOSITY_SETTING, 1 },
+		{ 22, CZSF_LED_LUMINOSITY_SETTING, 1 },
+		{ 23, CZSF_LED_LUMINOSITY_SETTING, 0 },
+		{ 24, CZSF_LED_LUMINOSITY_SETTING, 0 },
+		{ 25, CZSF_LED_LUMINOSITY_SETTING, 0 },
+		{ 26, CZSF_LED_LUMINOSITY_SETTING, 2 },
+		{ 27, CZSF_LED_LUMINOSITY_SETTING, 3 },
+		{ 28, CZSF_LED_LUMINOSITY_SETTING, 4 },
+		{ 29, CZSF_LED_LUMINOSITY_SETTING, 5 },
+		{ 30, CZSF_LED_LUMINOSITY_SETTING, 0 },
+		{ 97, CZSF_HOT_WATER_CALCULATED_SETTING, 540 },
+		{ 97, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 0 },
+		{ 97, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0 },
+		{ 97, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 97, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0 },
+		{ 97, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0 },
+		{ 97, CZSF_EXPANSION_VALVE_CALCULATED_SETTING, 0 },
+		{ 97, CZSF_EXPANSION_VALVE_TEMPERATURE_DIFFERENCE, -73 },
+		{ 98, CZSF_HOT_WATER_CALCULATED_SETTING, 540 },
+		{ 98, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 316 },
+		{ 98, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 2454 },
+		{ 98, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 98, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 2454 },
+		{ 98, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 1181 },
+		{ 98, CZSF_EXPANSION_VALVE_CALCULATED_SETTING, 220 },
+		{ 98, CZSF_EXPANSION_VALVE_TEMPERATURE_DIFFERENCE, 181 },
+		{ 99, CZSF_HOT_WATER_CALCULATED_SETTING, 540 },
+		{ 99, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 316 },
+		{ 99, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 2454 },
+		{ 99, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 99, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 2454 },
+		{ 99, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 1170 },
+		{ 99, CZSF_EXPANSION_VALVE_CALCULATED_SETTING, 220 },
+		{ 99, CZSF_EXPANSION_VALVE_TEMPERATURE_DIFFERENCE, 182 },
+		{ 100, CZSF_HOT_WATER_CALCULATED_SETTING, 540 },
+		{ 100, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 316 },
+		{ 100, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 2454 },
+		{ 100, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 100, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 2454 },
+		{ 100, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 1167 },
+		{ 100, CZSF_EXPANSION_VALVE_CALCULATED_SETTING, 220 },
+		{ 100, CZSF_EXPANSION_VALVE_TEMPERATURE_DIFFERENCE, 188 },
+		{ 101, CZSF_HOT_WATER_CALCULATED_SETTING, 540 },
+		{ 101, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 316 },
+		{ 101, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 2454 },
+		{ 101, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 101, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 2454 },
+		{ 101, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 1103 },
+		{ 101, CZSF_EXPANSION_VALVE_CALCULATED_SETTING, 220 },
+		{ 101, CZSF_EXPANSION_VALVE_TEMPERATURE_DIFFERENCE, 74 },
+		{ 102, CZSF_HOT_WATER_CALCULATED_SETTING, 540 },
+		{ 102, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 316 },
+		{ 102, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 2454 },
+		{ 102, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 102, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 2454 },
+		{ 102, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 1183 },
+		{ 102, CZSF_EXPANSION_VALVE_CALCULATED_SETTING, 220 },
+		{ 102, CZSF_EXPANSION_VALVE_TEMPERATURE_DIFFERENCE, 199 },
+		{ 103, CZSF_HOT_WATER_CALCULATED_SETTING, 540 },
+		{ 103, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 0 },
+		{ 103, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0 },
+		{ 103, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 103, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0 },
+		{ 103, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0 },
+		{ 103, CZSF_EXPANSION_VALVE_CALCULATED_SETTING, 0 },
+		{ 103, CZSF_EXPANSION_VALVE_TEMPERATURE_DIFFERENCE, -18 },
+		{ 104, CZSF_HOT_WATER_CALCULATED_SETTING, 540 },
+		{ 104, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 316 },
+		{ 104, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 2454 },
+		{ 104, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 104, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 2454 },
+		{ 104, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 1145 },
+		{ 104, CZSF_EXPANSION_VALVE_CALCULATED_SETTING, 220 },
+		{ 104, CZSF_EXPANSION_VALVE_TEMPERATURE_DIFFERENCE, 156 },
+		{ 105, CZSF_ROOM_HEATING_SETTING, 210 },
+		{ 105, CZSF_CALCULATED_FLOW_SET, 326 },
+		{ 106, CZSF_ROOM_HEATING_SETTING, 210 },
+		{ 106, CZSF_CALCULATED_FLOW_SET, 326 },
+		{ 107, CZSF_ROOM_HEATING_SETTING, 210 },
+		{ 107, CZSF_CALCULATED_FLOW_SET, 326 },
+		{ 108, CZSF_ROOM_HEATING_SETTING, 210 },
+		{ 108, CZSF_CALCULATED_FLOW_SET, 326 },
+		{ 109, CZSF_ROOM_HEATING_SETTING, 210 },
+		{ 109, CZSF_CALCULATED_FLOW_SET, 326 },
+		{ 110, CZSF_ROOM_HEATING_SETTING, 210 },
+		{ 110, CZSF_CALCULATED_FLOW_SET, 326 },
+		{ 111, CZSF_ROOM_HEATING_SETTING, 210 },
+		{ 111, CZSF_CALCULATED_FLOW_SET, 327 },
+		{ 112, CZSF_ROOM_HEATING_SETTING, 210 },
+		{ 112, CZSF_CALCULATED_FLOW_SET, 327 },
+		{ 113, CZSF_ROOM_HEATING_SETTING, 210 },
+		{ 113, CZSF_CALCULATED_FLOW_SET, 327 },
+		{ 114, CZSF_ROOM_HEATING_SETTING, 210 },
+		{ 114, CZSF_CALCULATED_FLOW_SET, 327 },
+		{ 115, CZSF_ROOM_HEATING_SETTING, 210 },
+		{ 115, CZSF_CALCULATED_FLOW_SET, 327 },
+		{ 116, CZSF_ROOM_HEATING_SETTING, 210 },
+		{ 116, CZSF_CALCULATED_FLOW_SET, 327 },
+		{ 117, CZSF_ROOM_HEATING_SETTING, 210 },
+		{ 117, CZSF_CALCULATED_FLOW_SET, 327 },
+		{ 118, CZSF_ROOM_HEATING_SETTING, 210 },
+		{ 118, CZSF_CALCULATED_FLOW_SET, 327 },
+		{ 119, CZSF_ROOM_HEATING_SETTING, 210 },
+		{ 119, CZSF_CALCULATED_FLOW_SET, 327 },
+		{ 120, CZSF_ROOM_HEATING_SETTING, 210 },
+		{ 120, CZSF_CALCULATED_FLOW_SET, 327 },
+		{ 121, CZSF_ROOM_HEATING_SETTING, 210 },
+		{ 121, CZSF_CALCULATED_FLOW_SET, 327 },
+		{ 122, CZSF_ROOM_HEATING_SETTING, 210 },
+		{ 122, CZSF_CALCULATED_FLOW_SET, 327 },
+		{ 123, CZSF_ROOM_HEATING_SETTING, 210 },
+		{ 123, CZSF_CALCULATED_FLOW_SET, 226 },
+		{ 130, CZSF_COMPRESSOR_ENERGY, 3865651 },
+		{ 130, CZSF_ADD_ENERGY, 356727 },
+		{ 130, CZSF_HOT_WATER_ENERGY, 999993 },
+		{ 130, CZSF_COMPRESSOR_RUNTIME, 755504 },
+		{ 130, CZSF_TOTAL_RUNTIME, 1922693 },
+		{ 131, CZSF_COMPRESSOR_ENERGY, 3865651 },
+		{ 131, CZSF_ADD_ENERGY, 356727 },
+		{ 131, CZSF_HOT_WATER_ENERGY, 999993 },
+		{ 131, CZSF_COMPRESSOR_RUNTIME, 755504 },
+		{ 131, CZSF_TOTAL_RUNTIME, 1922694 },
+		{ 132, CZSF_COMPRESSOR_ENERGY, 3865680 },
+		{ 132, CZSF_ADD_ENERGY, 356727 },
+		{ 132, CZSF_HOT_WATER_ENERGY, 1000022 },
+		{ 132, CZSF_COMPRESSOR_RUNTIME, 755511 },
+		{ 132, CZSF_TOTAL_RUNTIME, 1922702 },
+		{ 133, CZSF_COMPRESSOR_ENERGY, 3865681 },
+		{ 133, CZSF_ADD_ENERGY, 356727 },
+		{ 133, CZSF_HOT_WATER_ENERGY, 1000022 },
+		{ 133, CZSF_COMPRESSOR_RUNTIME, 755511 },
+		{ 133, CZSF_TOTAL_RUNTIME, 1922702 },
+		{ 134, CZSF_COMPRESSOR_ENERGY, 3865681 },
+		{ 134, CZSF_ADD_ENERGY, 356727 },
+		{ 134, CZSF_HOT_WATER_ENERGY, 1000022 },
+		{ 134, CZSF_COMPRESSOR_RUNTIME, 755511 },
+		{ 134, CZSF_TOTAL_RUNTIME, 1922703 },
+		{ 135, CZSF_COMPRESSOR_ENERGY, 3865687 },
+		{ 135, CZSF_ADD_ENERGY, 356727 },
+		{ 135, CZSF_HOT_WATER_ENERGY, 1000029 },
+		{ 135, CZSF_COMPRESSOR_RUNTIME, 755513 },
+		{ 135, CZSF_TOTAL_RUNTIME, 1922704 },
+		{ 136, CZSF_COMPRESSOR_ENERGY, 3865632 },
+		{ 136, CZSF_ADD_ENERGY, 356727 },
+		{ 136, CZSF_HOT_WATER_ENERGY, 999974 },
+		{ 136, CZSF_COMPRESSOR_RUNTIME, 755500 },
+		{ 136, CZSF_TOTAL_RUNTIME, 1922686 },
+		{ 137, CZSF_COMPRESSOR_ENERGY, 3865633 },
+		{ 137, CZSF_ADD_ENERGY, 356727 },
+		{ 137, CZSF_HOT_WATER_ENERGY, 999975 },
+		{ 137, CZSF_COMPRESSOR_RUNTIME, 755500 },
+		{ 137, CZSF_TOTAL_RUNTIME, 1922686 },
+		{ 138, CZSF_COMPRESSOR_ENERGY, 3865651 },
+		{ 138, CZSF_ADD_ENERGY, 356727 },
+		{ 138, CZSF_HOT_WATER_ENERGY, 999993 },
+		{ 138, CZSF_COMPRESSOR_RUNTIME, 755504 },
+		{ 138, CZSF_TOTAL_RUNTIME, 1922691 },
+		{ 139, CZSF_COMPRESSOR_ENERGY, 3865651 },
+		{ 139, CZSF_ADD_ENERGY, 356727 },
+		{ 139, CZSF_HOT_WATER_ENERGY, 999993 },
+		{ 139, CZSF_COMPRESSOR_RUNTIME, 755504 },
+		{ 139, CZSF_TOTAL_RUNTIME, 1922692 },
+		{ 140, CZSF_COMPRESSOR_ENERGY, 3865673 },
+		{ 140, CZSF_ADD_ENERGY, 356727 },
+		{ 140, CZSF_HOT_WATER_ENERGY, 1000014 },
+		{ 140, CZSF_COMPRESSOR_RUNTIME, 755509 },
+		{ 140, CZSF_TOTAL_RUNTIME, 1922701 },
+		{ 141, CZSF_COMPRESSOR_ENERGY, 3865673 },
+		{ 141, CZSF_ADD_ENERGY, 356727 },
+		{ 141, CZSF_HOT_WATER_ENERGY, 1000015 },
+		{ 141, CZSF_COMPRESSOR_RUNTIME, 755510 },
+		{ 141, CZSF_TOTAL_RUNTIME, 1922701 },
+		{ 142, CZSF_COMPRESSOR_ENERGY, 3865674 },
+		{ 142, CZSF_ADD_ENERGY, 356727 },
+		{ 142, CZSF_HOT_WATER_ENERGY, 1000015 },
+		{ 142, CZSF_COMPRESSOR_RUNTIME, 755510 },
+		{ 142, CZSF_TOTAL_RUNTIME, 1922701 },
+		{ 143, CZSF_COMPRESSOR_ENERGY, 3865652 },
+		{ 143, CZSF_ADD_ENERGY, 356727 },
+		{ 143, CZSF_HOT_WATER_ENERGY, 999993 },
+		{ 143, CZSF_COMPRESSOR_RUNTIME, 755504 },
+		{ 143, CZSF_TOTAL_RUNTIME, 1922695 },
+		{ 144, CZSF_COMPRESSOR_ENERGY, 3865652 },
+		{ 144, CZSF_ADD_ENERGY, 356727 },
+		{ 144, CZSF_HOT_WATER_ENERGY, 999994 },
+		{ 144, CZSF_COMPRESSOR_RUNTIME, 755504 },
+		{ 144, CZSF_TOTAL_RUNTIME, 1922696 },
+		{ 145, CZSF_COMPRESSOR_ENERGY, 3865653 },
+		{ 145, CZSF_ADD_ENERGY, 356727 },
+		{ 145, CZSF_HOT_WATER_ENERGY, 999994 },
+		{ 145, CZSF_COMPRESSOR_RUNTIME, 755504 },
+		{ 145, CZSF_TOTAL_RUNTIME, 1922696 },
+		{ 146, CZSF_COMPRESSOR_ENERGY, 3865653 },
+		{ 146, CZSF_ADD_ENERGY, 356727 },
+		{ 146, CZSF_HOT_WATER_ENERGY, 999994 },
+		{ 146, CZSF_COMPRESSOR_RUNTIME, 755505 },
+		{ 146, CZSF_TOTAL_RUNTIME, 1922696 },
+		{ 147, CZSF_COMPRESSOR_ENERGY, 3865653 },
+		{ 147, CZSF_ADD_ENERGY, 356727 },
+		{ 147, CZSF_HOT_WATER_ENERGY, 999995 },
+		{ 147, CZSF_COMPRESSOR_RUNTIME, 755505 },
+		{ 147, CZSF_TOTAL_RUNTIME, 1922696 },
+		{ 148, CZSF_COMPRESSOR_ENERGY, 3865654 },
+		{ 148, CZSF_ADD_ENERGY, 356727 },
+		{ 148, CZSF_HOT_WATER_ENERGY, 999995 },
+		{ 148, CZSF_COMPRESSOR_RUNTIME, 755505 },
+		{ 148, CZSF_TOTAL_RUNTIME, 1922696 },
+		{ 149, CZSF_COMPRESSOR_ENERGY, 3865654 },
+		{ 149, CZSF_ADD_ENERGY, 356727 },
+		{ 149, CZSF_HOT_WATER_ENERGY, 999996 },
+		{ 149, CZSF_COMPRESSOR_RUNTIME, 755505 },
+		{ 149, CZSF_TOTAL_RUNTIME, 1922696 },
+		{ 150, CZSF_COMPRESSOR_ENERGY, 3865655 },
+		{ 150, CZSF_ADD_ENERGY, 356727 },
+		{ 150, CZSF_HOT_WATER_ENERGY, 999996 },
+		{ 150, CZSF_COMPRESSOR_RUNTIME, 755505 },
+		{ 150, CZSF_TOTAL_RUNTIME, 1922696 },
+		{ 151, CZSF_COMPRESSOR_ENERGY, 3865655 },
+		{ 151, CZSF_ADD_ENERGY, 356727 },
+		{ 151, CZSF_HOT_WATER_ENERGY, 999997 },
+		{ 151, CZSF_COMPRESSOR_RUNTIME, 755505 },
+		{ 151, CZSF_TOTAL_RUNTIME, 1922696 },
+		{ 152, CZSF_COMPRESSOR_ENERGY, 3865656 },
+		{ 152, CZSF_ADD_ENERGY, 356727 },
+		{ 152, CZSF_HOT_WATER_ENERGY, 999997 },
+		{ 152, CZSF_COMPRESSOR_RUNTIME, 755505 },
+		{ 152, CZSF_TOTAL_RUNTIME, 1922696 },
+		{ 153, CZSF_COMPRESSOR_ENERGY, 3865664 },
+		{ 153, CZSF_ADD_ENERGY, 356727 },
+		{ 153, CZSF_HOT_WATER_ENERGY, 1000005 },
+		{ 153, CZSF_COMPRESSOR_RUNTIME, 755507 },
+		{ 153, CZSF_TOTAL_RUNTIME, 1922698 },
+		{ 154, CZSF_COMPRESSOR_ENERGY, 3865664 },
+		{ 154, CZSF_ADD_ENERGY, 356727 },
+		{ 154, CZSF_HOT_WATER_ENERGY, 1000006 },
+		{ 154, CZSF_COMPRESSOR_RUNTIME, 755507 },
+		{ 154, CZSF_TOTAL_RUNTIME, 1922698 },
+		{ 155, CZSF_COMPRESSOR_ENERGY, 3865665 },
+		{ 155, CZSF_ADD_ENERGY, 356727 },
+		{ 155, CZSF_HOT_WATER_ENERGY, 1000006 },
+		{ 155, CZSF_COMPRESSOR_RUNTIME, 755507 },
+		{ 155, CZSF_TOTAL_RUNTIME, 1922699 },
+		{ 156, CZSF_COMPRESSOR_ENERGY, 3865665 },
+		{ 156, CZSF_ADD_ENERGY, 356727 },
+		{ 156, CZSF_HOT_WATER_ENERGY, 1000007 },
+		{ 156, CZSF_COMPRESSOR_RUNTIME, 755508 },
+		{ 156, CZSF_TOTAL_RUNTIME, 1922699 },
+		{ 157, CZSF_COMPRESSOR_ENERGY, 3865666 },
+		{ 157, CZSF_ADD_ENERGY, 356727 },
+		{ 157, CZSF_HOT_WATER_ENERGY, 1000007 },
+		{ 157, CZSF_COMPRESSOR_RUNTIME, 755508 },
+		{ 157, CZSF_TOTAL_RUNTIME, 1922699 },
+		{ 158, CZSF_COMPRESSOR_ENERGY, 3865614 },
+		{ 158, CZSF_ADD_ENERGY, 356727 },
+		{ 158, CZSF_HOT_WATER_ENERGY, 999956 },
+		{ 158, CZSF_COMPRESSOR_RUNTIME, 755495 },
+		{ 158, CZSF_TOTAL_RUNTIME, 1922681 },
+		{ 159, CZSF_COMPRESSOR_ENERGY, 3865615 },
+		{ 159, CZSF_ADD_ENERGY, 356727 },
+		{ 159, CZSF_HOT_WATER_ENERGY, 999956 },
+		{ 159, CZSF_COMPRESSOR_RUNTIME, 755495 },
+		{ 159, CZSF_TOTAL_RUNTIME, 1922681 },
+		{ 161, CZSF_FAN_SPEED_DUTY, 545 },
+		{ 162, CZSF_FAN_SPEED_DUTY, 545 },
+		{ 163, CZSF_COMPRESSOR_ENERGY, 3865651 },
+		{ 163, CZSF_ADD_ENERGY, 356727 },
+		{ 163, CZSF_HOT_WATER_ENERGY, 999993 },
+		{ 163, CZSF_COMPRESSOR_RUNTIME, 755504 },
+		{ 163, CZSF_TOTAL_RUNTIME, 1922694 },
+		{ 164, CZSF_COMPRESSOR_ENERGY, 3865633 },
+		{ 164, CZSF_ADD_ENERGY, 356727 },
+		{ 164, CZSF_HOT_WATER_ENERGY, 999974 },
+		{ 164, CZSF_COMPRESSOR_RUNTIME, 755500 },
+		{ 164, CZSF_TOTAL_RUNTIME, 1922686 },
+	};
+
+static const COMFORTZONE_CORPUS comfortzone_corpus =
+	{
+		HP_PROTOCOL_1_8,
+		comfortzone_corpus_frames, sizeof(comfortzone_corpus_frames), 170,
+		comfortzone_corpus_frame_types,
+		comfortzone_corpus_values, sizeof(comfortzone_corpus_values) / sizeof(comfortzone_corpus_values[0])
+	};
+#endif
+
+#if HP_PROTOCOL == HP_PROTOCOL_2_21
+static const byte comfortzone_corpus_frames[] =
+	{
+		// #0 r 01 02 03 04 0B 0D 00 87 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC1, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x87, 0x02, 0x00, 0x06, 0x00,
+		0x00, 0xFF, 0x00, 0x00, 0xFF, 0x28, 0xF0, 0x00, 0x14, 0x00, 0x32, 0x00, 0xCE, 0xFF, 0x05, 0xFA, 0xED, 0xE8, 0xE9, 0xE8, 0xF6, 0x00, 0x1C, 0x01,
+		0x3E, 0x01, 0x5E, 0x01, 0x7D, 0x01, 0x9B, 0x01, 0x1E, 0x00, 0x28, 0x00, 0x1E, 0x00, 0x64, 0x00, 0x32, 0x00, 0xB0, 0x04, 0x5A, 0x00, 0xB0, 0x04,
+		0x5A, 0x00, 0x46, 0x00, 0xB4, 0x00, 0x50, 0x00, 0x78, 0x00, 0xFA, 0x00, 0x32, 0x00, 0x12, 0xFD, 0x1E, 0x00, 0xA8, 0xFD, 0x80, 0x0C, 0xE0, 0xFC,
+		0xA0, 0x0F, 0xDC, 0x05, 0x1E, 0x00, 0x64, 0x00, 0x64, 0x00, 0x96, 0x00, 0xC2, 0x01, 0xBC, 0x02, 0xC8, 0x00, 0xF4, 0x01, 0x78, 0x00, 0x58, 0x02,
+		0xEC, 0xFF, 0x02, 0x64, 0x00, 0x05, 0x78, 0x00, 0x1E, 0x00, 0xEE, 0x02, 0xFA, 0x00, 0xFF, 0x0C, 0xFE, 0xC8, 0x00, 0x0A, 0x00, 0x8C, 0x0A, 0x0C,
+		0xFE, 0x1E, 0x0C, 0xFE, 0x58, 0x02, 0xD0, 0x07, 0x58, 0x02, 0x9C, 0xFF, 0x54, 0x0B, 0xFA, 0x00, 0x2C, 0x01, 0x5E, 0x01, 0x90, 0x01, 0xC2, 0x01,
+		0x90, 0x01, 0x5E, 0x01, 0x2C, 0x01, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x1E, 0x90, 0x01, 0xC8, 0x00, 0x14, 0x00,
+		0x73,
+		// #1 r 01 02 03 04 0B 0D 00 87 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC1, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x87, 0x02, 0x00, 0x06, 0x00,
+		0x00, 0xFF, 0x01, 0x00, 0x07, 0x28, 0xF0, 0x00, 0x14, 0x00, 0x32, 0x00, 0xCE, 0xFF, 0x05, 0xFA, 0xED, 0xE8, 0xE9, 0xE8, 0xF6, 0x00, 0x1C, 0x01,
+		0x3E, 0x01, 0x5E, 0x01, 0x7D, 0x01, 0x9B, 0x01, 0x1E, 0x00, 0x28, 0x00, 0x1E, 0x00, 0x64, 0x00, 0x32, 0x00, 0xB0, 0x04, 0x5A, 0x00, 0xB0, 0x04,
+		0x5A, 0x00, 0x46, 0x00, 0xB4, 0x00, 0x50, 0x00, 0x78, 0x00, 0xFA, 0x00, 0x32, 0x00, 0x12, 0xFD, 0x1E, 0x00, 0xA8, 0xFD, 0x80, 0x0C, 0xE0, 0xFC,
+		0xA0, 0x0F, 0xDC, 0x05, 0x1E, 0x00, 0x64, 0x00, 0x64, 0x00, 0x96, 0x00, 0xC2, 0x01, 0xBC, 0x02, 0xC8, 0x00, 0xF4, 0x01, 0x78, 0x00, 0x58, 0x02,
+		0xEC, 0xFF, 0x02, 0x64, 0x00, 0x05, 0x78, 0x00, 0x1E, 0x00, 0xEE, 0x02, 0xFA, 0x00, 0xFF, 0x0C, 0xFE, 0xC8, 0x00, 0x0A, 0x00, 0x8C, 0x0A, 0x0C,
+		0xFE, 0x1E, 0x0C, 0xFE, 0x58, 0x02, 0xD0, 0x07, 0x58, 0x02, 0x9C, 0xFF, 0x54, 0x0B, 0xFA, 0x00, 0x2C, 0x01, 0x5E, 0x01, 0x90, 0x01, 0xC2, 0x01,
+		0x90, 0x01, 0x5E, 0x01, 0x2C, 0x01, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x1E, 0x90, 0x01, 0xC8, 0x00, 0x14, 0x00,
+		0x1C,
+		// #2 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x0F, 0x18, 0x08,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x0F, 0x18, 0x08, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x2C, 0x00, 0x81, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x76, 0x00, 0xF1, 0x00, 0xA4, 0x01, 0xF0, 0x00, 0xFA, 0x01, 0xB1, 0x01, 0x61, 0x00, 0x1E, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x92, 0x01, 0x4C, 0x00, 0x1A, 0x00, 0x0F, 0x00, 0x8B, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x3B,
+		// #3 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x0F, 0x18, 0x0A,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x0F, 0x18, 0x0A, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x2C, 0x00, 0x81, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x76, 0x00, 0xF1, 0x00, 0xA5, 0x01, 0xF0, 0x00, 0xFA, 0x01, 0xB2, 0x01, 0x60, 0x00, 0x1E, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x92, 0x01, 0x3A, 0x00, 0x0D, 0x00, 0x16, 0x00, 0x8B, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x01,
+		// #4 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x0F, 0x18, 0x0D,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x0F, 0x18, 0x0D, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x2C, 0x00, 0x81, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x76, 0x00, 0xF1, 0x00, 0xA5, 0x01, 0xF0, 0x00, 0xFA, 0x01, 0xB2, 0x01, 0x60, 0x00, 0x1E, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x92, 0x01, 0x2B, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x8B, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x5D,
+		// #5 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x0F, 0x18, 0x0F,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x0F, 0x18, 0x0F, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x2C, 0x00, 0x81, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x76, 0x00, 0xF1, 0x00, 0xA5, 0x01, 0xF0, 0x00, 0xFA, 0x01, 0xB2, 0x01, 0x60, 0x00, 0x1D, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x92, 0x01, 0x4E, 0x00, 0x1B, 0x00, 0x11, 0x00, 0x8B, 0x00, 0x00, 0x00, 0xE8, 0x03, 0xA1,
+		// #6 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x0F, 0x18, 0x12,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x0F, 0x18, 0x12, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x2C, 0x00, 0x81, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x76, 0x00, 0xF1, 0x00, 0xA5, 0x01, 0xF0, 0x00, 0xFA, 0x01, 0xB2, 0x01, 0x60, 0x00, 0x1D, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x92, 0x01, 0x4C, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x8B, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x7D,
+		// #7 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x0F, 0x18, 0x15,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x0F, 0x18, 0x15, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x2C, 0x00, 0x81, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x76, 0x00, 0xF1, 0x00, 0xA5, 0x01, 0xF0, 0x00, 0xFA, 0x01, 0xB2, 0x01, 0x5F, 0x00, 0x1D, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x92, 0x01, 0x40, 0x00, 0x18, 0x00, 0x18, 0x00, 0x8B, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x1D,
+		// #8 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x0F, 0x18, 0x17,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x0F, 0x18, 0x17, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x2C, 0x00, 0x81, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x76, 0x00, 0xF1, 0x00, 0xA5, 0x01, 0xF0, 0x00, 0xFB, 0x01, 0xB2, 0x01, 0x5F, 0x00, 0x1D, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x92, 0x01, 0x38, 0x00, 0x12, 0x00, 0x14, 0x00, 0x8B, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x29,
+		// #9 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x0F, 0x18, 0x1A,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x0F, 0x18, 0x1A, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x2C, 0x00, 0x81, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x76, 0x00, 0xF1, 0x00, 0xA5, 0x01, 0xF0, 0x00, 0xFB, 0x01, 0xB2, 0x01, 0x5F, 0x00, 0x1C, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x92, 0x01, 0x3C, 0x00, 0x0F, 0x00, 0x14, 0x00, 0x8B, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x92,
+		// #10 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x0F, 0x18, 0x1D,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x0F, 0x18, 0x1D, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x2C, 0x00, 0x81, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x76, 0x00, 0xF1, 0x00, 0xA5, 0x01, 0xF0, 0x00, 0xFB, 0x01, 0xB2, 0x01, 0x5F, 0x00, 0x1C, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x92, 0x01, 0x43, 0x00, 0x21, 0x00, 0x16, 0x00, 0x89, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x72,
+		// #11 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x0F, 0x18, 0x24,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x0F, 0x18, 0x24, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x2C, 0x00, 0x81, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x76, 0x00, 0xF1, 0x00, 0xA5, 0x01, 0xF0, 0x00, 0xFB, 0x01, 0xB2, 0x01, 0x5E, 0x00, 0x1B, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x93, 0x01, 0x38, 0x00, 0x24, 0x00, 0x14, 0x00, 0x89, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x47,
+		// #12 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x0F, 0x18, 0x26,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x0F, 0x18, 0x26, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x2C, 0x00, 0x81, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x76, 0x00, 0xF1, 0x00, 0xA5, 0x01, 0xF0, 0x00, 0xFC, 0x01, 0xB2, 0x01, 0x5E, 0x00, 0x1B, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x93, 0x01, 0x43, 0x00, 0x1D, 0x00, 0x13, 0x00, 0x89, 0x00, 0x00, 0x00, 0xE8, 0x03, 0xEB,
+		// #13 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x0F, 0x18, 0x29,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x0F, 0x18, 0x29, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x2C, 0x00, 0x81, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x76, 0x00, 0xF1, 0x00, 0xA6, 0x01, 0xF0, 0x00, 0xFC, 0x01, 0xB2, 0x01, 0x5E, 0x00, 0x1B, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x93, 0x01, 0x48, 0x00, 0x12, 0x00, 0x13, 0x00, 0x89, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x80,
+		// #14 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x0F, 0x18, 0x2C,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x0F, 0x18, 0x2C, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x2C, 0x00, 0x81, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x76, 0x00, 0xF1, 0x00, 0xA6, 0x01, 0xF0, 0x00, 0xFC, 0x01, 0xB2, 0x01, 0x5D, 0x00, 0x1B, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x93, 0x01, 0x3E, 0x00, 0x1A, 0x00, 0x14, 0x00, 0x89, 0x00, 0x00, 0x00, 0xE8, 0x03, 0xCC,
+		// #15 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x0F, 0x18, 0x2E,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x0F, 0x18, 0x2E, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x2C, 0x00, 0x81, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x76, 0x00, 0xF1, 0x00, 0xA6, 0x01, 0xF0, 0x00, 0xFC, 0x01, 0xB2, 0x01, 0x5D, 0x00, 0x1A, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x93, 0x01, 0x31, 0x00, 0x10, 0x00, 0x18, 0x00, 0x89, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x25,
+		// #16 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x0F, 0x18, 0x31,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x0F, 0x18, 0x31, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x2C, 0x00, 0x81, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x76, 0x00, 0xF1, 0x00, 0xA6, 0x01, 0xF0, 0x00, 0xFC, 0x01, 0xB2, 0x01, 0x5D, 0x00, 0x1A, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x93, 0x01, 0x36, 0x00, 0x22, 0x00, 0x18, 0x00, 0x89, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x26,
+		// #17 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x0F, 0x18, 0x34,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x0F, 0x18, 0x34, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x2C, 0x00, 0x81, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x76, 0x00, 0xF1, 0x00, 0xA6, 0x01, 0xF0, 0x00, 0xFD, 0x01, 0xB2, 0x01, 0x5D, 0x00, 0x1A, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x93, 0x01, 0x45, 0x00, 0x16, 0x00, 0x12, 0x00, 0x89, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x6C,
+		// #18 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x0F, 0x18, 0x36,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x0F, 0x18, 0x36, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x2C, 0x00, 0x81, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x76, 0x00, 0xF2, 0x00, 0xA6, 0x01, 0xF0, 0x00, 0xFD, 0x01, 0xB2, 0x01, 0x5C, 0x00, 0x19, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x93, 0x01, 0x4A, 0x00, 0x18, 0x00, 0x14, 0x00, 0x89, 0x00, 0x00, 0x00, 0xE8, 0x03, 0xFF,
+		// #19 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x0F, 0x18, 0x39,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x0F, 0x18, 0x39, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x2C, 0x00, 0x81, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x76, 0x00, 0xF2, 0x00, 0xA6, 0x01, 0xF0, 0x00, 0xFD, 0x01, 0xB3, 0x01, 0x5C, 0x00, 0x19, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x93, 0x01, 0x3C, 0x00, 0x1A, 0x00, 0x18, 0x00, 0x89, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x6E,
+		// #20 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x0F, 0x3B, 0x3B,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x0F, 0x3B, 0x3B, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x08, 0x00, 0x89, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x74, 0x00, 0x0F, 0x01, 0xE5, 0x00, 0xF5, 0x00, 0x58, 0x01, 0xE1, 0x00, 0xAE, 0x00, 0xB0, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0xC7, 0x01, 0x45, 0x00, 0x22, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x4A,
+		// #21 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x10, 0x00, 0x02,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x08, 0x00, 0x89, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x74, 0x00, 0x0D, 0x01, 0xE5, 0x00, 0xF5, 0x00, 0x56, 0x01, 0xE0, 0x00, 0xAE, 0x00, 0xB0, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0xC7, 0x01, 0x3B, 0x00, 0x18, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x6E,
+		// #22 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x10, 0x00, 0x04,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x08, 0x00, 0x89, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x74, 0x00, 0x0B, 0x01, 0xE5, 0x00, 0xF5, 0x00, 0x56, 0x01, 0xE0, 0x00, 0xAE, 0x00, 0xB0, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0xC7, 0x01, 0x3B, 0x00, 0x17, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0xFC,
+		// #23 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x10, 0x00, 0x07,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x10, 0x00, 0x07, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x08, 0x00, 0x89, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x74, 0x00, 0x09, 0x01, 0xE5, 0x00, 0xF5, 0x00, 0x54, 0x01, 0xDF, 0x00, 0xAF, 0x00, 0xB0, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0xC7, 0x01, 0x37, 0x00, 0x12, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x87,
+		// #24 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x10, 0x00, 0x0A,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x10, 0x00, 0x0A, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x08, 0x00, 0x89, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x74, 0x00, 0x07, 0x01, 0xE4, 0x00, 0xF5, 0x00, 0x54, 0x01, 0xDF, 0x00, 0xAF, 0x00, 0xB0, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0xC7, 0x01, 0x35, 0x00, 0x19, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0xC1,
+		// #25 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x10, 0x00, 0x0C,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x10, 0x00, 0x0C, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x08, 0x00, 0x89, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x74, 0x00, 0x05, 0x01, 0xE4, 0x00, 0xF5, 0x00, 0x52, 0x01, 0xDE, 0x00, 0xAF, 0x00, 0xB0, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0xC7, 0x01, 0x45, 0x00, 0x16, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0xF7,
+		// #26 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x10, 0x00, 0x0F,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x10, 0x00, 0x0F, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x08, 0x00, 0x89, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x74, 0x00, 0x03, 0x01, 0xE4, 0x00, 0xF5, 0x00, 0x52, 0x01, 0xDE, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0xC7, 0x01, 0x47, 0x00, 0x1A, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x61,
+		// #27 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x10, 0x00, 0x11,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x10, 0x00, 0x11, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x08, 0x00, 0x89, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x74, 0x00, 0x01, 0x01, 0xE4, 0x00, 0xF5, 0x00, 0x50, 0x01, 0xDD, 0x00, 0xB0, 0x00, 0xAF, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0xC7, 0x01, 0x47, 0x00, 0x1A, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x22,
+		// #28 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x10, 0x00, 0x14,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x08, 0x00, 0x89, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x74, 0x00, 0x01, 0x01, 0xE4, 0x00, 0xF5, 0x00, 0x50, 0x01, 0xDD, 0x00, 0xB0, 0x00, 0xAF, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0xC7, 0x01, 0x48, 0x00, 0x1C, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0xEE,
+		// #29 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x10, 0x00, 0x17,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x10, 0x00, 0x17, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x08, 0x00, 0x89, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x74, 0x00, 0xFF, 0x00, 0xE4, 0x00, 0xF5, 0x00, 0x4E, 0x01, 0xDD, 0x00, 0xB1, 0x00, 0xAF, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0xC7, 0x01, 0x39, 0x00, 0x1B, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x00,
+		// #30 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x10, 0x00, 0x19,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x10, 0x00, 0x19, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x08, 0x00, 0x89, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x74, 0x00, 0xFD, 0x00, 0xE4, 0x00, 0xF5, 0x00, 0x4E, 0x01, 0xDC, 0x00, 0xB1, 0x00, 0xAF, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0xC7, 0x01, 0x45, 0x00, 0x11, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x61,
+		// #31 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x10, 0x00, 0x1C,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x10, 0x00, 0x1C, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x08, 0x00, 0x89, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x74, 0x00, 0xFB, 0x00, 0xE4, 0x00, 0xF5, 0x00, 0x4C, 0x01, 0xDC, 0x00, 0xB1, 0x00, 0xAF, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0xC7, 0x01, 0x3A, 0x00, 0x0A, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0xA0,
+		// #32 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x10, 0x00, 0x1F,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x08, 0x00, 0x89, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x74, 0x00, 0xFB, 0x00, 0xE3, 0x00, 0xF5, 0x00, 0x4C, 0x01, 0xDC, 0x00, 0xB2, 0x00, 0xAF, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0xC7, 0x01, 0x3B, 0x00, 0x1A, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x1D,
+		// #33 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x10, 0x00, 0x21,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x10, 0x00, 0x21, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x08, 0x00, 0x89, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x74, 0x00, 0xF9, 0x00, 0xE3, 0x00, 0xF5, 0x00, 0x4C, 0x01, 0xDB, 0x00, 0xB2, 0x00, 0xAF, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0xC7, 0x01, 0x40, 0x00, 0x22, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0xCC,
+		// #34 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x10, 0x00, 0x24,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x10, 0x00, 0x24, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x08, 0x00, 0x89, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x74, 0x00, 0xF7, 0x00, 0xE3, 0x00, 0xF5, 0x00, 0x4B, 0x01, 0xDB, 0x00, 0xB2, 0x00, 0xAF, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0xC7, 0x01, 0x48, 0x00, 0x1B, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0xFC,
+		// #35 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x10, 0x00, 0x26,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x10, 0x00, 0x26, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x08, 0x00, 0x89, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x74, 0x00, 0xF7, 0x00, 0xE3, 0x00, 0xF5, 0x00, 0x4B, 0x01, 0xDB, 0x00, 0xB2, 0x00, 0xAF, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0xC7, 0x01, 0x39, 0x00, 0x1C, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x0D,
+		// #36 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x10, 0x00, 0x29,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x10, 0x00, 0x29, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x08, 0x00, 0x89, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x74, 0x00, 0xF5, 0x00, 0xE3, 0x00, 0xF4, 0x00, 0x4A, 0x01, 0xDB, 0x00, 0xB2, 0x00, 0xAF, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0xC7, 0x01, 0x3A, 0x00, 0x0D, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0xC0,
+		// #37 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x10, 0x00, 0x2D,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x10, 0x00, 0x2D, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x08, 0x00, 0x89, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x74, 0x00, 0xF3, 0x00, 0xE3, 0x00, 0xF4, 0x00, 0x49, 0x01, 0xDA, 0x00, 0xB3, 0x00, 0xAE, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0xC7, 0x01, 0x38, 0x00, 0x24, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0xBC,
+		// #38 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x10, 0x00, 0x2E,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x10, 0x00, 0x2E, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x08, 0x00, 0x89, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x74, 0x00, 0xF3, 0x00, 0xE3, 0x00, 0xF4, 0x00, 0x49, 0x01, 0xDA, 0x00, 0xB3, 0x00, 0xAE, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0xC7, 0x01, 0x36, 0x00, 0x15, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0xED,
+		// #39 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x10, 0x00, 0x31,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x10, 0x00, 0x31, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x08, 0x00, 0x89, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x74, 0x00, 0xF3, 0x00, 0xE3, 0x00, 0xF4, 0x00, 0x48, 0x01, 0xDA, 0x00, 0xB3, 0x00, 0xAE, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0xC7, 0x01, 0x40, 0x00, 0x14, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0xE6,
+		// #40 r 01 02 03 04 0B 0D 01 04 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x88, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00, 0x10, 0x00, 0x34,
+		0x0A, 0x0C, 0x17, 0x07, 0x00, 0x10, 0x00, 0x34, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x08, 0x00, 0x89, 0x10, 0x00, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x19, 0xFC, 0x19,
+		0xFC, 0x74, 0x00, 0xF1, 0x00, 0xE3, 0x00, 0xF4, 0x00, 0x48, 0x01, 0xDA, 0x00, 0xB3, 0x00, 0xAE, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0xC7, 0x01, 0x3C, 0x00, 0x12, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0x98,
+		// #41 r 01 02 03 04 0B 0D 01 CD 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x51, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xCD, 0x02, 0x01, 0x02, 0xF8,
+		0x02, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x01, 0x5E, 0x01, 0xEE, 0x02, 0x00, 0xB9, 0x01, 0x11, 0x01, 0x6D, 0x00, 0x19, 0x00, 0xD3, 0x00, 0x61, 0x00,
+		0x61, 0x00, 0x00, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0x53, 0xFF, 0x9E, 0xFF, 0x9C, 0xFF, 0xDA, 0xFD, 0x00, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D,
+		// #42 r 01 02 03 04 0B 0D 01 CD 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x51, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xCD, 0x02, 0x01, 0x02, 0xF8,
+		0x02, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x01, 0x5E, 0x01, 0xEE, 0x02, 0x00, 0xBA, 0x01, 0x12, 0x01, 0x6C, 0x00, 0x19, 0x00, 0xD3, 0x00, 0x5C, 0x00,
+		0x5C, 0x00, 0x00, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0x54, 0xFF, 0xA0, 0xFF, 0x9C, 0xFF, 0xDA, 0xFD, 0x00, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76,
+		// #43 r 01 02 03 04 0B 0D 01 CD 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x51, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xCD, 0x02, 0x01, 0x02, 0xF8,
+		0x02, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x01, 0x5E, 0x01, 0xEE, 0x02, 0x00, 0xBA, 0x01, 0x12, 0x01, 0x6C, 0x00, 0x19, 0x00, 0xD3, 0x00, 0x5D, 0x00,
+		0x5D, 0x00, 0x00, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0x54, 0xFF, 0x9F, 0xFF, 0x9C, 0xFF, 0xDA, 0xFD, 0x00, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9,
+		// #44 r 01 02 03 04 0B 0D 01 CD 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x51, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xCD, 0x02, 0x01, 0x02, 0xF8,
+		0x02, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x01, 0x5E, 0x01, 0xEE, 0x02, 0x00, 0xBA, 0x01, 0x12, 0x01, 0x6C, 0x00, 0x19, 0x00, 0xD3, 0x00, 0x5D, 0x00,
+		0x5E, 0x00, 0x00, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0x54, 0xFF, 0x9F, 0xFF, 0x9C, 0xFF, 0xDA, 0xFD, 0x00, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23,
+		// #45 r 01 02 03 04 0B 0D 01 CD 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x51, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xCD, 0x02, 0x01, 0x02, 0xF8,
+		0x02, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x01, 0x5E, 0x01, 0xEE, 0x02, 0x00, 0xBA, 0x01, 0x12, 0x01, 0x6C, 0x00, 0x19, 0x00, 0xD3, 0x00, 0x5E, 0x00,
+		0x5E, 0x00, 0x00, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0x54, 0xFF, 0x9F, 0xFF, 0x9C, 0xFF, 0xDA, 0xFD, 0x00, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+		// #46 r 01 02 03 04 0B 0D 01 CD 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x51, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xCD, 0x02, 0x01, 0x02, 0xF8,
+		0x02, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x01, 0x5E, 0x01, 0xEE, 0x02, 0x00, 0xBA, 0x01, 0x12, 0x01, 0x6D, 0x00, 0x19, 0x00, 0xD3, 0x00, 0x5F, 0x00,
+		0x5F, 0x00, 0x00, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0x54, 0xFF, 0x9E, 0xFF, 0x9C, 0xFF, 0xDA, 0xFD, 0x00, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A,
+		// #47 r 01 02 03 04 0B 0D 01 CD 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x51, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xCD, 0x02, 0x01, 0x02, 0xF8,
+		0x02, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x01, 0x5E, 0x01, 0xEE, 0x02, 0x00, 0xBA, 0x01, 0x12, 0x01, 0x6D, 0x00, 0x19, 0x00, 0xD3, 0x00, 0x60, 0x00,
+		0x60, 0x00, 0x00, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0x54, 0xFF, 0x9E, 0xFF, 0x9C, 0xFF, 0xDA, 0xFD, 0x00, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4,
+		// #48 r 01 02 03 04 0B 0D 01 CD 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x51, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xCD, 0x02, 0x01, 0x02, 0xF8,
+		0x02, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x01, 0x5E, 0x01, 0xEE, 0x02, 0x00, 0xBB, 0x01, 0x12, 0x01, 0x6C, 0x00, 0x19, 0x00, 0xD3, 0x00, 0x5C, 0x00,
+		0x5C, 0x00, 0x00, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0x55, 0xFF, 0xA0, 0xFF, 0x9C, 0xFF, 0xDA, 0xFD, 0x00, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1,
+		// #49 r 01 02 03 04 0B 0D 01 CD 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x51, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xCD, 0x02, 0x01, 0x02, 0xF8,
+		0x02, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x5E, 0x01, 0xEE, 0x02, 0x00, 0xDA, 0x00, 0x9B, 0x00, 0x8B, 0x00, 0x0B, 0x00, 0x73, 0x00, 0xB3, 0x00,
+		0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB,
+		// #50 r 01 02 03 04 0B 0D 01 CD 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x51, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xCD, 0x02, 0x01, 0x02, 0xF8,
+		0x02, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x5E, 0x01, 0xEE, 0x02, 0x00, 0xDB, 0x00, 0x9B, 0x00, 0x8B, 0x00, 0x0B, 0x00, 0x73, 0x00, 0xB2, 0x00,
+		0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6,
+		// #51 r 01 02 03 04 0B 0D 01 CD 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x51, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xCD, 0x02, 0x01, 0x02, 0xF8,
+		0x02, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x5E, 0x01, 0xEE, 0x02, 0x00, 0xDC, 0x00, 0x9C, 0x00, 0x8A, 0x00, 0x0B, 0x00, 0x73, 0x00, 0xB1, 0x00,
+		0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5,
+		// #52 r 01 02 03 04 0B 0D 01 CD 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x51, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xCD, 0x02, 0x01, 0x02, 0xF8,
+		0x02, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x5E, 0x01, 0xEE, 0x02, 0x00, 0xDC, 0x00, 0x9C, 0x00, 0x8B, 0x00, 0x0B, 0x00, 0x73, 0x00, 0xB2, 0x00,
+		0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6,
+		// #53 r 01 02 03 04 0B 0D 01 CD 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x51, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xCD, 0x02, 0x01, 0x02, 0xF8,
+		0x02, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x5E, 0x01, 0xEE, 0x02, 0x00, 0xDD, 0x00, 0x9C, 0x00, 0x8A, 0x00, 0x0B, 0x00, 0x74, 0x00, 0xB0, 0x00,
+		0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65,
+		// #54 r 01 02 03 04 0B 0D 01 CD 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x51, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xCD, 0x02, 0x01, 0x02, 0xF8,
+		0x02, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x5E, 0x01, 0xEE, 0x02, 0x00, 0xDD, 0x00, 0x9C, 0x00, 0x8A, 0x00, 0x0B, 0x00, 0x74, 0x00, 0xB1, 0x00,
+		0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+		// #55 r 01 02 03 04 0B 0D 01 CD 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x51, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xCD, 0x02, 0x01, 0x02, 0xF8,
+		0x02, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x5E, 0x01, 0xEE, 0x02, 0x00, 0xDE, 0x00, 0x9C, 0x00, 0x8A, 0x00, 0x0B, 0x00, 0x74, 0x00, 0xB0, 0x00,
+		0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B,
+		// #56 r 01 02 03 04 0B 0D 01 CD 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x51, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xCD, 0x02, 0x01, 0x02, 0xF8,
+		0x02, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x5E, 0x01, 0xEE, 0x02, 0x00, 0xDE, 0x00, 0x9C, 0x00, 0x8A, 0x00, 0x0B, 0x00, 0x75, 0x00, 0xAF, 0x00,
+		0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52,
+		// #57 r 01 02 03 04 0B 0D 01 CD 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x51, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xCD, 0x02, 0x01, 0x02, 0xF8,
+		0x02, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x5E, 0x01, 0xEE, 0x02, 0x00, 0xDF, 0x00, 0x9D, 0x00, 0x89, 0x00, 0x0B, 0x00, 0x75, 0x00, 0xAE, 0x00,
+		0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7,
+		// #58 r 01 02 03 04 0B 0D 01 CD 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x51, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xCD, 0x02, 0x01, 0x02, 0xF8,
+		0x02, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x5E, 0x01, 0xEE, 0x02, 0x00, 0xDF, 0x00, 0x9D, 0x00, 0x8A, 0x00, 0x0B, 0x00, 0x75, 0x00, 0xAF, 0x00,
+		0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7,
+		// #59 r 01 02 03 04 0B 0D 01 CD 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x51, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xCD, 0x02, 0x01, 0x02, 0xF8,
+		0x02, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x5E, 0x01, 0xEE, 0x02, 0x00, 0xE0, 0x00, 0x9D, 0x00, 0x89, 0x00, 0x0B, 0x00, 0x75, 0x00, 0xAE, 0x00,
+		0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3,
+		// #60 r 01 02 03 04 0B 0D 01 CD 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x51, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xCD, 0x02, 0x01, 0x02, 0xF8,
+		0x02, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x5E, 0x01, 0xEE, 0x02, 0x00, 0xE1, 0x00, 0x9E, 0x00, 0x89, 0x00, 0x0B, 0x00, 0x76, 0x00, 0xAE, 0x00,
+		0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53,
+		// #61 w 01 02 03 04 0B 0D 00 41 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x17, 0x77, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x41, 0x03, 0x01, 0xEE,
+		// #62 W 01 02 03 04 0B 0D 00 41 03
+		0x65, 0x6F, 0xDE, 0x02, 0xD3, 0x5E, 0x41, 0x44, 0x44, 0x52, 0x18, 0x57, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x41, 0x03, 0xB8, 0x01, 0x01,
+		// #63 W 01 02 03 04 0B 0D 00 41 03
+		0x65, 0x6F, 0xDE, 0x02, 0xD3, 0x5E, 0x41, 0x44, 0x44, 0x52, 0x18, 0x57, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x41, 0x03, 0xC2, 0x01, 0x50,
+		// #64 r 01 02 03 04 0B 0D 00 41 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC5, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x41, 0x03, 0xB8, 0x01, 0x0F,
+		0x00, 0x92, 0xFF, 0x8D, 0xFF, 0x88, 0xFF, 0x83, 0xFF, 0x7E, 0xFF, 0x79, 0xFF, 0x74, 0xFF, 0x6F, 0xFF, 0x6A, 0xFF, 0x65, 0xFF, 0x60, 0xFF, 0x5B,
+		0xFF, 0x5B, 0xFF, 0x5B, 0xFF, 0x5B, 0xFF, 0xCE, 0xFF, 0xCE, 0xFF, 0xC9, 0xFF, 0xC9, 0xFF, 0xC4, 0xFF, 0xC4, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xBA,
+		0xFF, 0xBA, 0xFF, 0xB5, 0xFF, 0xB5, 0xFF, 0xB5, 0xFF, 0xB5, 0xFF, 0xB5, 0xFF, 0xF1, 0xFF, 0xEC, 0xFF, 0xE7, 0xFF, 0xE2, 0xFF, 0xDD, 0xFF, 0xD8,
+		0xFF, 0xD3, 0xFF, 0xCE, 0xFF, 0xC9, 0xFF, 0xC4, 0xFF, 0xBF, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0x05, 0x1E, 0x14, 0x7E, 0xFF,
+		0x74, 0xFF, 0x92, 0xFF, 0x88, 0xFF, 0xCE, 0xFF, 0xC4, 0xFF, 0xF1, 0xFF, 0xE7, 0xFF, 0x96, 0x00, 0x68, 0x01, 0xC2, 0x01, 0x7E, 0xFF, 0x26, 0x02,
+		0xB4, 0x00, 0x8A, 0x02, 0xDA, 0x02, 0x0A, 0x1E, 0x1E, 0xF4, 0x01, 0x32, 0x00, 0x58, 0x02, 0x68, 0x01, 0x90, 0x01, 0x26, 0x02, 0x58, 0x02, 0x58,
+		0x02, 0x02, 0xF8, 0x02, 0xD4, 0xFE, 0xE8, 0x03, 0x00, 0x00, 0xFA, 0x00, 0x8A, 0x02, 0x8A, 0x02, 0xEE, 0x02, 0x48, 0x03, 0xB6, 0x03, 0xE8, 0x03,
+		0xD4, 0xFE, 0xBC, 0x02, 0xE6,
+		// #65 r 01 02 03 04 0B 0D 00 41 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC5, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x41, 0x03, 0xC2, 0x01, 0x0F,
+		0x00, 0x92, 0xFF, 0x8D, 0xFF, 0x88, 0xFF, 0x83, 0xFF, 0x7E, 0xFF, 0x79, 0xFF, 0x74, 0xFF, 0x6F, 0xFF, 0x6A, 0xFF, 0x65, 0xFF, 0x60, 0xFF, 0x5B,
+		0xFF, 0x5B, 0xFF, 0x5B, 0xFF, 0x5B, 0xFF, 0xCE, 0xFF, 0xCE, 0xFF, 0xC9, 0xFF, 0xC9, 0xFF, 0xC4, 0xFF, 0xC4, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xBA,
+		0xFF, 0xBA, 0xFF, 0xB5, 0xFF, 0xB5, 0xFF, 0xB5, 0xFF, 0xB5, 0xFF, 0xB5, 0xFF, 0xF1, 0xFF, 0xEC, 0xFF, 0xE7, 0xFF, 0xE2, 0xFF, 0xDD, 0xFF, 0xD8,
+		0xFF, 0xD3, 0xFF, 0xCE, 0xFF, 0xC9, 0xFF, 0xC4, 0xFF, 0xBF, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0x05, 0x1E, 0x14, 0x7E, 0xFF,
+		0x74, 0xFF, 0x92, 0xFF, 0x88, 0xFF, 0xCE, 0xFF, 0xC4, 0xFF, 0xF1, 0xFF, 0xE7, 0xFF, 0x96, 0x00, 0x68, 0x01, 0xC2, 0x01, 0x7E, 0xFF, 0x26, 0x02,
+		0xB4, 0x00, 0x8A, 0x02, 0xDA, 0x02, 0x0A, 0x1E, 0x1E, 0xF4, 0x01, 0x32, 0x00, 0x58, 0x02, 0x68, 0x01, 0x90, 0x01, 0x26, 0x02, 0x58, 0x02, 0x58,
+		0x02, 0x02, 0xF8, 0x02, 0xD4, 0xFE, 0xE8, 0x03, 0x00, 0x00, 0xFA, 0x00, 0x8A, 0x02, 0x8A, 0x02, 0xEE, 0x02, 0x48, 0x03, 0xB6, 0x03, 0xE8, 0x03,
+		0xD4, 0xFE, 0xBC, 0x02, 0xAF,
+		// #66 w 01 02 03 04 0B 0D 00 8C 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x17, 0x77, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x8C, 0x02, 0x00, 0x37,
+		// #67 w 01 02 03 04 0B 0D 01 D4 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x17, 0x77, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xD4, 0x03, 0x00, 0x22,
+		// #68 w 01 02 03 04 0B 0D 01 D6 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x17, 0x77, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xD6, 0x03, 0x00, 0x6D,
+		// #69 r 01 02 03 04 0B 0D 00 55 06
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x18, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x55, 0x06, 0x03, 0x06, 0x73,
+		// #70 r 01 02 03 04 0B 0D 01 1D 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x18, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x1D, 0x00, 0x04, 0x00, 0x20,
+		// #71 r 01 02 03 04 0B 0D 01 1D 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x18, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x1D, 0x00, 0xC4, 0x00, 0x94,
+		// #72 r 01 02 03 04 0B 0D 01 47 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x1C, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x47, 0x01, 0x0D, 0x00, 0x00,
+		0xC0, 0x00, 0x00, 0x85,
+		// #73 r 01 02 03 04 0B 0D 01 47 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x1C, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x47, 0x01, 0x0D, 0x00, 0x00,
+		0xC0, 0x21, 0x01, 0xDE,
+		// #74 r 01 02 03 04 0B 0D 01 47 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x1C, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x47, 0x01, 0x0D, 0x00, 0x7F,
+		0xC0, 0x00, 0x00, 0xB7,
+		// #75 r 01 02 03 04 0B 0D 01 47 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x1C, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x47, 0x01, 0x0D, 0x00, 0x7F,
+		0xC0, 0x21, 0x01, 0xEC,
+		// #76 r 01 02 03 04 0B 0D 00 7D 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x20, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87,
+		// #77 r 01 02 03 04 0B 0D 00 00 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2C, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x00, 0x00, 0xC2, 0x8E, 0x72,
+		0x42, 0xAE, 0x34, 0x06, 0x1F, 0xFF, 0x00, 0x00, 0x11, 0x04, 0xCA, 0x59, 0x01, 0x2B, 0x01, 0x40, 0x31, 0x00, 0x00, 0x32,
+		// #78 r 01 02 03 04 0B 0D 01 1B 04
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2C, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x1B, 0x04, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+		// #79 r 01 02 03 04 0B 0D 04 4E 3F
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2C, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x04, 0x4E, 0x3F, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF,
+		// #80 r 01 02 03 04 0B 0D 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x51, 0x83, 0x1C, 0x00, 0x30, 0x1D, 0x01, 0x00, 0xA4, 0x9B, 0x0C, 0x00, 0x36, 0xE0, 0x07, 0x00, 0x61, 0x00, 0x15, 0x00, 0xA1,
+		// #81 r 01 02 03 04 0B 0D 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x52, 0x83, 0x1C, 0x00, 0x30, 0x1D, 0x01, 0x00, 0xA4, 0x9B, 0x0C, 0x00, 0x36, 0xE0, 0x07, 0x00, 0x61, 0x00, 0x15, 0x00, 0xE5,
+		// #82 r 01 02 03 04 0B 0D 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x52, 0x83, 0x1C, 0x00, 0x30, 0x1D, 0x01, 0x00, 0xA5, 0x9B, 0x0C, 0x00, 0x36, 0xE0, 0x07, 0x00, 0x61, 0x00, 0x15, 0x00, 0x8D,
+		// #83 r 01 02 03 04 0B 0D 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x53, 0x83, 0x1C, 0x00, 0x30, 0x1D, 0x01, 0x00, 0xA5, 0x9B, 0x0C, 0x00, 0x37, 0xE0, 0x07, 0x00, 0x62, 0x00, 0x15, 0x00, 0x8D,
+		// #84 r 01 02 03 04 0B 0D 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x53, 0x83, 0x1C, 0x00, 0x30, 0x1D, 0x01, 0x00, 0xA6, 0x9B, 0x0C, 0x00, 0x37, 0xE0, 0x07, 0x00, 0x62, 0x00, 0x15, 0x00, 0x35,
+		// #85 r 01 02 03 04 0B 0D 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xAA, 0x83, 0x1C, 0x00, 0x30, 0x1D, 0x01, 0x00, 0xFD, 0x9B, 0x0C, 0x00, 0x55, 0xE0, 0x07, 0x00, 0x85, 0x00, 0x15, 0x00, 0x9A,
+		// #86 r 01 02 03 04 0B 0D 05 28 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x2E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xAA, 0x83, 0x1C, 0x00, 0x30, 0x1D, 0x01, 0x00, 0xFD, 0x9B, 0x0C, 0x00, 0x55, 0xE0, 0x07, 0x00, 0x86, 0x00, 0x15, 0x00, 0x12,
+		// #87 r 01 02 03 04 0B 0D 01 4B 05
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x32, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x4B, 0x05, 0x02, 0x0C, 0x01,
+		0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x25,
+		// #88 r 01 02 03 04 0B 0D 03 FC 0E
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x3E, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x03, 0xFC, 0x0E, 0x08, 0x16, 0x00,
+		0x0A, 0x08, 0x07, 0x00, 0x09, 0x08, 0x0A, 0x1E, 0x03, 0x08, 0x0C, 0x1E, 0x04, 0x08, 0x12, 0x14, 0x03, 0x08, 0x14, 0x14, 0x04, 0x00, 0x00, 0x00,
+		0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0xC1,
+		// #89 r 01 02 03 04 0B 0D 00 45 05
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x41, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x45, 0x05, 0x12, 0x06, 0xCE,
+		0xFF, 0x0A, 0x08, 0x07, 0xF4, 0x01, 0xD0, 0x07, 0xD0, 0x07, 0x58, 0x02, 0x1A, 0xFF, 0x2C, 0x01, 0xDA, 0x02, 0x05, 0x50, 0x00, 0x78, 0xB0, 0x04,
+		0x78, 0xE8, 0x03, 0xE8, 0x03, 0x14, 0x08, 0x07, 0x08, 0x07, 0x5A, 0x00, 0x78, 0x32, 0x5A, 0x00, 0x7A,
+		// #90 r 01 02 03 04 0B 0D 00 3F 06
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x4A, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x3F, 0x06, 0xD6, 0x03, 0x14,
+		0x0D, 0x83, 0x0C, 0xEE, 0x0B, 0xB0, 0x0A, 0xF2, 0x08, 0x98, 0x07, 0x34, 0x06, 0x90, 0x05, 0x9D, 0x04, 0xE4, 0x03, 0x03, 0x06, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0x04, 0x56,
+		0x55, 0xF2,
+		// #91 r 01 02 03 04 0B 0D 00 F2 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x51, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0xF2, 0x03, 0x32, 0x00, 0x25,
+		0x00, 0x2C, 0x01, 0x0A, 0x01, 0x14, 0x05, 0x28, 0x0A, 0x00, 0x1E, 0x32, 0x90, 0x01, 0x2C, 0x01, 0x28, 0x14, 0x05, 0x05, 0x0A, 0xB0, 0x04, 0xC4,
+		0x09, 0xAC, 0x0D, 0x96, 0x00, 0x26, 0x02, 0x26, 0x02, 0xFA, 0x00, 0x14, 0x26, 0x02, 0xBC, 0x02, 0x34, 0x03, 0xFC, 0x03, 0x1A, 0x04, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
+		// #92 r 01 02 03 04 0B 0D 00 F2 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x51, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0xF2, 0x03, 0x32, 0x00, 0x27,
+		0x00, 0x2C, 0x01, 0x0A, 0x01, 0x14, 0x05, 0x28, 0x0A, 0x00, 0x1E, 0x32, 0x90, 0x01, 0x2C, 0x01, 0x28, 0x14, 0x05, 0x05, 0x0A, 0xB0, 0x04, 0xC4,
+		0x09, 0xAC, 0x0D, 0x96, 0x00, 0x26, 0x02, 0x26, 0x02, 0xFA, 0x00, 0x14, 0x26, 0x02, 0xBC, 0x02, 0x34, 0x03, 0xFC, 0x03, 0x1A, 0x04, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD7,
+		// #93 r 01 02 03 04 0B 0D 00 F2 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x51, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0xF2, 0x03, 0x32, 0x00, 0x29,
+		0x00, 0x2C, 0x01, 0x0A, 0x01, 0x14, 0x05, 0x28, 0x0A, 0x00, 0x1E, 0x32, 0x90, 0x01, 0x2C, 0x01, 0x28, 0x14, 0x05, 0x05, 0x0A, 0xB0, 0x04, 0xC4,
+		0x09, 0xAC, 0x0D, 0x96, 0x00, 0x26, 0x02, 0x26, 0x02, 0xFA, 0x00, 0x14, 0x26, 0x02, 0xBC, 0x02, 0x34, 0x03, 0xFC, 0x03, 0x1A, 0x04, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+		// #94 r 01 02 03 04 0B 0D 05 00 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x56, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x05, 0x00, 0x00, 0x05, 0x01, 0x16,
+		0x01, 0x10, 0x12, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x28, 0x28, 0x28, 0x04, 0x03, 0x00, 0x00, 0xB9, 0x02, 0x00, 0x00, 0x83, 0x02, 0x00,
+		0x00, 0x56, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x83, 0x1C, 0x00, 0x30, 0x1D, 0x01,
+		0x00, 0xFD, 0x9B, 0x0C, 0x00, 0x55, 0xE0, 0x07, 0x00, 0x86, 0x00, 0x15, 0x00, 0x34,
+		// #95 r 01 02 03 04 0B 0D 05 00 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x56, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x05, 0x00, 0x00, 0x35, 0x24, 0x15,
+		0x01, 0x10, 0x12, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x04, 0x03, 0x00, 0x00, 0xB9, 0x02, 0x00, 0x00, 0x83, 0x02, 0x00,
+		0x00, 0x56, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x83, 0x1C, 0x00, 0x30, 0x1D, 0x01,
+		0x00, 0xA5, 0x9B, 0x0C, 0x00, 0x37, 0xE0, 0x07, 0x00, 0x61, 0x00, 0x15, 0x00, 0xEA,
+		// #96 r 01 02 03 04 0B 0D 05 00 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x56, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x05, 0x00, 0x00, 0x58, 0x59, 0x15,
+		0x01, 0x10, 0x12, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x27, 0x27, 0x27, 0x04, 0x03, 0x00, 0x00, 0xB9, 0x02, 0x00, 0x00, 0x83, 0x02, 0x00,
+		0x00, 0x56, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x83, 0x1C, 0x00, 0x30, 0x1D, 0x01,
+		0x00, 0xFD, 0x9B, 0x0C, 0x00, 0x55, 0xE0, 0x07, 0x00, 0x85, 0x00, 0x15, 0x00, 0x0E,
+		// #97 r 01 02 03 04 0B 0D 03 6F 0E
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x58, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x03, 0x6F, 0x0E, 0x0C, 0x02, 0x12,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x04, 0x17, 0x15, 0x00, 0x0D, 0x03, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x17, 0x0C,
+		0x34, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x05, 0x17, 0x14, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x0B, 0x05, 0x17, 0x0D, 0x1F, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
+		// #98 r 01 02 03 04 0B 0D 03 21 0F
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x6D, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x03, 0x21, 0x0F, 0x00, 0x00, 0x07,
+		0x01, 0x02, 0x00, 0x06, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+		0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+		0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+		0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0xC2,
+		// #99 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xE9, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0xF5, 0x00, 0x03, 0x03, 0x6A, 0xFF, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x71, 0x00, 0x71, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68,
+		// #100 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xE9, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0xF5, 0x00, 0x13, 0x03, 0x5A, 0xFF, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x73, 0x00, 0x73, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C,
+		// #101 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xE9, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0xF5, 0x00, 0x24, 0x03, 0x49, 0xFF, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x76, 0x00, 0x76, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42,
+		// #102 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xE9, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0xF5, 0x00, 0x24, 0x03, 0x49, 0xFF, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53,
+		// #103 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xE9, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0xF5, 0x00, 0x35, 0x03, 0x38, 0xFF, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8,
+		// #104 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xE9, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0xF5, 0x00, 0x45, 0x03, 0x28, 0xFF, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE,
+		// #105 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xE9, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0xF5, 0x00, 0x56, 0x03, 0x17, 0xFF, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+		// #106 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xE9, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0xF5, 0x00, 0x67, 0x03, 0x06, 0xFF, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
+		// #107 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xE9, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0xF5, 0x00, 0x77, 0x03, 0xF6, 0xFE, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7,
+		// #108 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xE9, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0xF5, 0x00, 0x88, 0x03, 0xE5, 0xFE, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
+		// #109 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xE9, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0xF5, 0x00, 0x99, 0x03, 0xD4, 0xFE, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B,
+		// #110 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xE9, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0xF5, 0x00, 0xA9, 0x03, 0xC4, 0xFE, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85,
+		// #111 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xE9, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0xF5, 0x00, 0xE1, 0x02, 0x8C, 0xFF, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x66, 0x00, 0x66, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92,
+		// #112 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xE9, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0xF5, 0x00, 0xE1, 0x02, 0x8C, 0xFF, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x69, 0x00, 0x69, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC,
+		// #113 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xE9, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0xF5, 0x00, 0xF2, 0x02, 0x7B, 0xFF, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x6C, 0x00, 0x6C, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB,
+		// #114 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xE9, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF6, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0xF5, 0x00, 0xF2, 0x02, 0x7B, 0xFF, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x6E, 0x00, 0x6E, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+		// #115 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xEB, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0xF4, 0x00, 0x9F, 0x02, 0xCE, 0xFF, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x59, 0x00, 0x59, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1,
+		// #116 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xEB, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0xF4, 0x00, 0x9F, 0x02, 0xCE, 0xFF, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x5C, 0x00, 0x5C, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB,
+		// #117 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xEB, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0xF4, 0x00, 0xAF, 0x02, 0xBE, 0xFF, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x5F, 0x00, 0x5F, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C,
+		// #118 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xEB, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0xF4, 0x00, 0xAF, 0x02, 0xBE, 0xFF, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xB8, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3,
+		// #119 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xEB, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0xF4, 0x00, 0xC0, 0x02, 0xAD, 0xFF, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x64, 0x00, 0x64, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
+		// #120 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xF2, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x65, 0x02, 0x08, 0x00, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x35, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+		// #121 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xF2, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x65, 0x02, 0x08, 0x00, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x38, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49,
+		// #122 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xF2, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x65, 0x02, 0x08, 0x00, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x3A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+		// #123 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xF2, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x65, 0x02, 0x08, 0x00, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x3D, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+		// #124 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xF2, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x65, 0x02, 0x08, 0x00, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+		// #125 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xF2, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x65, 0x02, 0x08, 0x00, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x42, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+		// #126 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xF2, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x65, 0x02, 0x08, 0x00, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x45, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+		// #127 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xF2, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x65, 0x02, 0x08, 0x00, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x4C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6,
+		// #128 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xF2, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x65, 0x02, 0x08, 0x00, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x4F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+		// #129 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xF2, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x65, 0x02, 0x08, 0x00, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x51, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+		// #130 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xF2, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x65, 0x02, 0x08, 0x00, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x54, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+		// #131 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xF2, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x65, 0x02, 0x08, 0x00, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x57, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
+		// #132 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xF2, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x65, 0x02, 0x08, 0x00, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x59, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A,
+		// #133 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xF2, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x65, 0x02, 0x08, 0x00, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x5C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C,
+		// #134 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xF2, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x65, 0x02, 0x08, 0x00, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x5F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9,
+		// #135 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xF2, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x65, 0x02, 0x08, 0x00, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x61, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0,
+		// #136 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xF2, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x6D, 0x02, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x30, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+		// #137 r 01 02 03 04 0B 0D 01 F9 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0x82, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xF9, 0x01, 0xF2, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x6D, 0x02, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x02, 0x54, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+		0xF1, 0x00, 0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00,
+		0x33, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
+		// #138 r 01 02 03 04 0B 0D 01 DB 04
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xAA, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xDB, 0x04, 0xE0, 0x2E, 0x10,
+		0x0E, 0x2C, 0x01, 0x05, 0x78, 0x78, 0x14, 0x08, 0x07, 0x08, 0x07, 0x05, 0xB0, 0x04, 0x8C, 0x0A, 0x1E, 0x00, 0x10, 0x0E, 0x10, 0x0E, 0x8C, 0x0A,
+		0x03, 0x2C, 0x01, 0x20, 0x1C, 0x00, 0x00, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x14, 0x1E, 0x00, 0x14, 0x80, 0x16, 0xC1, 0xA8, 0x0A, 0xC7, 0xFF,
+		0xFF, 0xFF, 0x00, 0xC0, 0xA8, 0x0A, 0x01, 0x63, 0x01, 0x83, 0x00, 0x00, 0x2C, 0x01, 0x18, 0x01, 0xC8, 0x00, 0x6C, 0x02, 0x22, 0x01, 0x6A, 0xFF,
+		0x78, 0x00, 0x2C, 0x01, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x02, 0x00, 0x02, 0x0C, 0x01, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xF0,
+		// #139 r 01 02 03 04 0B 0D 01 DB 04
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xAA, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xDB, 0x04, 0xE0, 0x2E, 0x10,
+		0x0E, 0x2C, 0x01, 0x05, 0x78, 0x78, 0x14, 0x08, 0x07, 0x08, 0x07, 0x05, 0xB0, 0x04, 0x8C, 0x0A, 0x1E, 0x00, 0x10, 0x0E, 0x10, 0x0E, 0x8C, 0x0A,
+		0x21, 0x2C, 0x01, 0x20, 0x1C, 0x00, 0x00, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x14, 0x1E, 0x00, 0x14, 0x80, 0x16, 0xC1, 0xA8, 0x0A, 0xC7, 0xFF,
+		0xFF, 0xFF, 0x00, 0xC0, 0xA8, 0x0A, 0x01, 0x63, 0x01, 0x83, 0x00, 0x00, 0x2C, 0x01, 0x18, 0x01, 0xC8, 0x00, 0x6C, 0x02, 0x22, 0x01, 0x6A, 0xFF,
+		0x78, 0x00, 0x2C, 0x01, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x02, 0x00, 0x02, 0x0C, 0x01, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xCA,
+		// #140 r 01 02 03 04 0B 0D 01 DB 04
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xAA, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xDB, 0x04, 0xE0, 0x2E, 0x10,
+		0x0E, 0x2C, 0x01, 0x05, 0x78, 0x78, 0x14, 0x08, 0x07, 0x08, 0x07, 0x05, 0xB0, 0x04, 0x8C, 0x0A, 0x1E, 0x00, 0x10, 0x0E, 0x10, 0x0E, 0x8C, 0x0A,
+		0x39, 0x2C, 0x01, 0x20, 0x1C, 0x00, 0x00, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x14, 0x1E, 0x00, 0x14, 0x80, 0x16, 0xC1, 0xA8, 0x0A, 0xC7, 0xFF,
+		0xFF, 0xFF, 0x00, 0xC0, 0xA8, 0x0A, 0x01, 0x63, 0x01, 0x83, 0x00, 0x00, 0x2C, 0x01, 0x18, 0x01, 0xC8, 0x00, 0x6C, 0x02, 0x22, 0x01, 0x6A, 0xFF,
+		0x78, 0x00, 0x2C, 0x01, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x02, 0x00, 0x02, 0x0C, 0x01, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x1E,
+		// #141 r 01 02 03 04 0B 0D 00 82 04
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xAF, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x82, 0x04, 0x0D, 0x00, 0x01,
+		0x14, 0xF4, 0x01, 0xE8, 0x03, 0xD0, 0x07, 0xC4, 0x09, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F,
+		0x64, 0x00, 0x0A, 0x00, 0x0A, 0x64, 0x00, 0xB0, 0x04, 0xB0, 0x04, 0x32, 0x00, 0xF4, 0x01, 0x96, 0x00, 0x58, 0x02, 0x00, 0x00, 0x50, 0x00, 0x19,
+		0x00, 0xC8, 0x00, 0x07, 0x00, 0x18, 0x01, 0x72, 0x01, 0x87, 0x00, 0xE6, 0x00, 0x05, 0x05, 0x88, 0x13, 0xB0, 0x04, 0xE4, 0x0C, 0x5E, 0x01, 0xE8,
+		0x03, 0xE8, 0x03, 0x90, 0x01, 0x50, 0x00, 0x3C, 0x00, 0x82, 0x00, 0x48, 0x03, 0x32, 0x1E, 0x00, 0x14, 0x14, 0x14, 0x00, 0xE8, 0x03, 0xE8, 0x03,
+		0x00, 0x05, 0x01, 0x64, 0x00, 0x00, 0x2D, 0x00, 0xBB, 0x03, 0x05, 0x01, 0x1E, 0x2C, 0x01, 0x0A, 0xF4, 0x01, 0x3C, 0x00, 0x05, 0x46, 0x00, 0xFA,
+		0x00, 0x74, 0x04, 0x26, 0x02, 0x78, 0x00, 0xF4, 0x01, 0x32, 0x00, 0x1E, 0x0A, 0xFA, 0x00, 0x0F, 0x28, 0x14, 0x14, 0x32, 0x96, 0x00, 0x64, 0x00,
+		0xB4, 0x00, 0xE8, 0x03, 0x78, 0x00, 0x3C,
+		// #142 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x02, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x05, 0x4E, 0x10,
+		0x13, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4F, 0x75, 0x30, 0x75, 0x00, 0x00, 0xDB, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x3B,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x0D, 0x12,
+		// #143 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x04, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x05, 0x4E, 0x10,
+		0x13, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4F, 0x75, 0x30, 0x75, 0x00, 0x00, 0xDB, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0C,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x0D, 0x79,
+		// #144 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x04, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x05, 0x4E, 0x10,
+		0x13, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4F, 0x75, 0x30, 0x75, 0x00, 0x00, 0xDB, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x39,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x12, 0x00, 0x00, 0x0D, 0xFE,
+		// #145 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x06, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x05, 0x4E, 0x10,
+		0x13, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4F, 0x75, 0x30, 0x75, 0x00, 0x00, 0xDB, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0A,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x0D, 0x98,
+		// #146 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x07, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x05, 0x4E, 0x10,
+		0x13, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4F, 0x75, 0x30, 0x75, 0x00, 0x00, 0xDB, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x36,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x0D, 0xC7,
+		// #147 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0A, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x05, 0x4E, 0x10,
+		0x13, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4F, 0x75, 0x30, 0x75, 0x00, 0x00, 0xDB, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x0D, 0x06,
+		// #148 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x05, 0x4E, 0x10,
+		0x13, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4F, 0x75, 0x30, 0x75, 0x00, 0x00, 0xDB, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x04,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x0D, 0xA5,
+		// #149 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x05, 0x4E, 0x10,
+		0x13, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4F, 0x75, 0x30, 0x75, 0x00, 0x00, 0xDB, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x31,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x12, 0x00, 0x00, 0x0D, 0xAB,
+		// #150 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0E, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x05, 0x4E, 0x10,
+		0x13, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4F, 0x75, 0x30, 0x75, 0x00, 0x00, 0xDB, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x02,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x12, 0x00, 0x00, 0x0D, 0xFB,
+		// #151 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0F, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x05, 0x4E, 0x10,
+		0x13, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4F, 0x75, 0x30, 0x75, 0x00, 0x00, 0xDB, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x10,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x11, 0x00, 0x00, 0x0D, 0x9C,
+		// #152 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0F, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x05, 0x4E, 0x10,
+		0x13, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4F, 0x75, 0x30, 0x75, 0x00, 0x00, 0xDB, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x2E,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x0D, 0xB9,
+		// #153 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x02, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x05, 0x4E, 0x10,
+		0x13, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4F, 0x75, 0x30, 0x75, 0x00, 0x00, 0xDB, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x2C,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x12, 0x00, 0x00, 0x0D, 0x6A,
+		// #154 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x05, 0x4E, 0x10,
+		0x13, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4F, 0x75, 0x30, 0x75, 0x00, 0x00, 0xDB, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x29,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x12, 0x00, 0x00, 0x0D, 0x75,
+		// #155 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x08, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x05, 0x4E, 0x10,
+		0x13, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4F, 0x75, 0x30, 0x75, 0x00, 0x00, 0xDB, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x26,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x0D, 0x36,
+		// #156 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0A, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x05, 0x4E, 0x10,
+		0x13, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4F, 0x75, 0x30, 0x75, 0x00, 0x00, 0xDB, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x24,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x12, 0x00, 0x00, 0x0D, 0x3A,
+		// #157 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0D, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x05, 0x4E, 0x10,
+		0x13, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4F, 0x75, 0x30, 0x75, 0x00, 0x00, 0xDB, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x21,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x0D, 0x23,
+		// #158 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x05, 0x4E, 0x10,
+		0x13, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4F, 0x75, 0x30, 0x75, 0x00, 0x00, 0xDB, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x1E,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x0D, 0xBC,
+		// #159 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x03, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x05, 0x4E, 0x10,
+		0x13, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4F, 0x75, 0x30, 0x75, 0x00, 0x00, 0xDB, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x1C,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x12, 0x00, 0x00, 0x0D, 0x25,
+		// #160 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x06, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x05, 0x4E, 0x10,
+		0x13, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4F, 0x75, 0x30, 0x75, 0x00, 0x00, 0xDB, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x19,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x0D, 0x2A,
+		// #161 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x09, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x05, 0x4E, 0x10,
+		0x13, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4F, 0x75, 0x30, 0x75, 0x00, 0x00, 0xDB, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x16,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x0D, 0x33,
+		// #162 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x6E, 0x06, 0x00,
+		0x00, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x01, 0x00, 0x0F, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x25, 0x01, 0x1C, 0xFF, 0x41, 0x00, 0x93, 0x00, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x10,
+		0x5F, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x2C, 0x69, 0x30, 0x75, 0x00, 0x00, 0xB8, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x1F,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x0D, 0xC7,
+		// #163 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x6E, 0x06, 0x00,
+		0x00, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x56, 0x03, 0x00, 0x00, 0x00, 0x00, 0x94, 0x01, 0x00, 0x0E, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x25, 0x01, 0x1D, 0xFF, 0x43, 0x00, 0x90, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x10,
+		0x5F, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0xB0, 0x77, 0x30, 0x75, 0x00, 0x00, 0x3C, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x11,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x0D, 0x2C,
+		// #164 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x6E, 0x06, 0x00,
+		0x00, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x56, 0x03, 0x00, 0x00, 0x00, 0x00, 0x96, 0x01, 0x00, 0x01, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x25, 0x01, 0x1D, 0xFF, 0x43, 0x00, 0x90, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x10,
+		0x5F, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0xD4, 0x6A, 0x30, 0x75, 0x00, 0x00, 0x60, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0F,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x0D, 0xA8,
+		// #165 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x6E, 0x06, 0x00,
+		0x00, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x56, 0x03, 0x00, 0x00, 0x00, 0x00, 0x99, 0x01, 0x00, 0x04, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x25, 0x01, 0x1D, 0xFF, 0x43, 0x00, 0x90, 0x00, 0x90, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x10,
+		0x5F, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x8A, 0x57, 0x30, 0x75, 0x00, 0x00, 0x16, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0C,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x0D, 0x45,
+		// #166 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x6E, 0x06, 0x00,
+		0x00, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x56, 0x03, 0x00, 0x00, 0x00, 0x00, 0x9B, 0x01, 0x00, 0x06, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x25, 0x01, 0x1D, 0xFF, 0x42, 0x00, 0x90, 0x00, 0x90, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x10,
+		0x5F, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0xAE, 0x4A, 0x30, 0x75, 0x00, 0x00, 0x3A, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0A,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x12, 0x00, 0x00, 0x0D, 0x78,
+		// #167 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x6E, 0x06, 0x00,
+		0x00, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x56, 0x03, 0x00, 0x00, 0x00, 0x00, 0x9E, 0x01, 0x00, 0x09, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x25, 0x01, 0x1C, 0xFF, 0x42, 0x00, 0x91, 0x00, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x10,
+		0x5F, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x64, 0x37, 0x30, 0x75, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x07,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x0D, 0x2C,
+		// #168 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x6E, 0x06, 0x00,
+		0x00, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x56, 0x03, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x01, 0x00, 0x0C, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x25, 0x01, 0x1C, 0xFF, 0x42, 0x00, 0x91, 0x00, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x10,
+		0x5F, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x1A, 0x24, 0x30, 0x75, 0x00, 0x00, 0x46, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x04,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x0D, 0x3C,
+		// #169 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x6E, 0x06, 0x00,
+		0x00, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x56, 0x03, 0x00, 0x00, 0x00, 0x00, 0xA3, 0x01, 0x00, 0x0E, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x25, 0x01, 0x1C, 0xFF, 0x42, 0x00, 0x91, 0x00, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x10,
+		0x5F, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x3E, 0x17, 0x30, 0x75, 0x00, 0x00, 0x6A, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x02,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x12, 0x00, 0x00, 0x0D, 0xC9,
+		// #170 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x6E, 0x06, 0x00,
+		0x00, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x56, 0x03, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x01, 0x00, 0x02, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x25, 0x01, 0x1C, 0xFF, 0x41, 0x00, 0x91, 0x00, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x10,
+		0x5F, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0xF4, 0x03, 0x30, 0x75, 0x00, 0x00, 0x20, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x3B,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x0D, 0x54,
+		// #171 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x6E, 0x06, 0x00,
+		0x00, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x56, 0x03, 0x00, 0x00, 0x00, 0x00, 0xAD, 0x01, 0x00, 0x09, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x25, 0x01, 0x1B, 0xFF, 0x41, 0x00, 0x92, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x10,
+		0x5F, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x92, 0x63, 0x30, 0x75, 0x00, 0x00, 0x1E, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x34,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x0D, 0xF6,
+		// #172 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x6E, 0x06, 0x00,
+		0x00, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x56, 0x03, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01, 0x00, 0x0C, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x25, 0x01, 0x1B, 0xFF, 0x41, 0x00, 0x92, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x10,
+		0x5F, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x48, 0x50, 0x30, 0x75, 0x00, 0x00, 0xD4, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x31,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x0D, 0xF6,
+		// #173 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x6E, 0x06, 0x00,
+		0x00, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x56, 0x03, 0x00, 0x00, 0x00, 0x00, 0xB2, 0x01, 0x00, 0x0E, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x25, 0x01, 0x1B, 0xFF, 0x41, 0x00, 0x92, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x10,
+		0x5F, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x6C, 0x43, 0x30, 0x75, 0x00, 0x00, 0xF8, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x2F,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x12, 0x00, 0x00, 0x0D, 0xC0,
+		// #174 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x6E, 0x06, 0x00,
+		0x00, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x56, 0x03, 0x00, 0x00, 0x00, 0x00, 0xB5, 0x01, 0x00, 0x02, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x25, 0x01, 0x1B, 0xFF, 0x40, 0x00, 0x92, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x10,
+		0x5F, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x22, 0x30, 0x30, 0x75, 0x00, 0x00, 0xAE, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x2C,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x0D, 0xE8,
+		// #175 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x6E, 0x06, 0x00,
+		0x00, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x56, 0x03, 0x00, 0x00, 0x00, 0x00, 0xB7, 0x01, 0x00, 0x04, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x25, 0x01, 0x1B, 0xFF, 0x40, 0x00, 0x92, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x10,
+		0x5F, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x46, 0x23, 0x30, 0x75, 0x00, 0x00, 0x72, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x12, 0x00, 0x00, 0x0D, 0x37,
+		// #176 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x6E, 0x06, 0x00,
+		0x00, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x56, 0x03, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x01, 0x00, 0x07, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x25, 0x01, 0x1B, 0xFF, 0x40, 0x00, 0x92, 0x00, 0x92, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x10,
+		0x5F, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0xFC, 0x0F, 0x30, 0x75, 0x00, 0x00, 0x28, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x27,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x12, 0x00, 0x00, 0x0D, 0xA5,
+		// #177 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x6E, 0x06, 0x00,
+		0x00, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x56, 0x03, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x01, 0x00, 0x0A, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x25, 0x01, 0x1B, 0xFF, 0x40, 0x00, 0x92, 0x00, 0x92, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x10,
+		0x5F, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x52, 0x89, 0x30, 0x75, 0x00, 0x00, 0xDE, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x24,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x0D, 0x2C,
+		// #178 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x6E, 0x06, 0x00,
+		0x00, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x56, 0x03, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x01, 0x00, 0x0C, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x25, 0x01, 0x1C, 0xFF, 0x40, 0x00, 0x93, 0x00, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x10,
+		0x5F, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x76, 0x7C, 0x30, 0x75, 0x00, 0x00, 0x02, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x22,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x12, 0x00, 0x00, 0x0D, 0xE0,
+		// #179 r 01 02 03 04 0B 0D 01 3C 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xB9, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03, 0x6E, 0x06, 0x00,
+		0x00, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x58, 0x03, 0x00, 0x00, 0x00, 0x00, 0x91, 0x01, 0x00, 0x0B, 0x00, 0x00, 0x3C,
+		0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A,
+		0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x25, 0x01, 0x1D, 0xFF, 0x42, 0x00, 0x90, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x10,
+		0x5F, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0xFA, 0x8A, 0x30, 0x75, 0x00, 0x00, 0x86, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x14,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA,
+		0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x0D, 0x2F,
+		// #180 r 01 02 03 04 0B 0D 01 63 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC6, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x63, 0x01, 0xCD, 0x18, 0x22,
+		0x16, 0x18, 0x1A, 0xFD, 0x18, 0x0A, 0x14, 0x85, 0x18, 0x1D, 0x13, 0x79, 0x7F, 0x79, 0x7F, 0xDF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x8C, 0x00, 0x00, 0x00, 0x16, 0x02, 0xA5, 0x00, 0x32, 0x02, 0xB4, 0x00, 0x75, 0x01, 0x00, 0x00, 0x0A, 0x02, 0xA2, 0x00, 0x26, 0x02, 0xB0,
+		0x00, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x02, 0xA2, 0x00, 0x26, 0x02, 0x95, 0x00, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xCC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x36, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFC, 0x76, 0x00, 0xFB, 0x00, 0x16, 0x01, 0x2B, 0x01, 0x46, 0x01, 0x66,
+		0x01, 0x83, 0x01, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x65, 0x02, 0x08, 0x00, 0x00, 0x00, 0x6D,
+		0x02, 0x54, 0x02, 0x00, 0x00, 0xC7,
+		// #181 r 01 02 03 04 0B 0D 01 63 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC6, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x63, 0x01, 0xED, 0x15, 0x31,
+		0x16, 0x60, 0x17, 0xCB, 0x15, 0x4A, 0x15, 0x4E, 0x19, 0x2B, 0x15, 0x79, 0x7F, 0x79, 0x7F, 0xDF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x18, 0x00, 0x00, 0x00, 0x16, 0x02, 0x00, 0x00, 0xFF, 0x02, 0x3D, 0x00, 0x75, 0x01, 0x00, 0x00, 0x0A, 0x02, 0x00, 0x00, 0xEE, 0x02, 0x3C,
+		0x00, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x02, 0x00, 0x00, 0xEE, 0x02, 0x00, 0x00, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFC, 0x74, 0x00, 0xFB, 0x00, 0x16, 0x01, 0x2B, 0x01, 0x46, 0x01, 0x66,
+		0x01, 0x83, 0x01, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0xF4, 0x00, 0x86, 0x02, 0xE7, 0xFF, 0x00, 0x00, 0x6D,
+		0x02, 0x54, 0x02, 0x00, 0x00, 0xA9,
+		// #182 r 01 02 03 04 0B 0D 01 63 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC6, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x63, 0x01, 0xEE, 0x15, 0x31,
+		0x16, 0x63, 0x17, 0xCC, 0x15, 0x49, 0x15, 0x4E, 0x19, 0x2C, 0x15, 0x79, 0x7F, 0x79, 0x7F, 0xDF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x02, 0x00, 0x00, 0xFF, 0x02, 0x3D, 0x00, 0x75, 0x01, 0x00, 0x00, 0x0A, 0x02, 0x00, 0x00, 0xEE, 0x02, 0x3C,
+		0x00, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x02, 0x00, 0x00, 0xEE, 0x02, 0x00, 0x00, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFC, 0x74, 0x00, 0xFB, 0x00, 0x16, 0x01, 0x2B, 0x01, 0x46, 0x01, 0x66,
+		0x01, 0x83, 0x01, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x1E, 0x00, 0xF4, 0x00, 0x8E, 0x02, 0xDF, 0xFF, 0x00, 0x00, 0x6D,
+		0x02, 0x54, 0x02, 0x00, 0x00, 0xB8,
+		// #183 r 01 02 03 04 0B 0D 00 00 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC7, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x00, 0x00, 0xC2, 0x8E, 0x72,
+		0x42, 0xAE, 0x34, 0x06, 0x1F, 0xFF, 0x00, 0x00, 0x11, 0x04, 0xCA, 0x59, 0x01, 0x2B, 0x01, 0x40, 0x31, 0x00, 0x00, 0x19, 0x19, 0xFF, 0x0F, 0x00,
+		0x00, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x7F, 0x14, 0xC0, 0xA8, 0x0A, 0xC7, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xA8,
+		0x0A, 0x01, 0x65, 0x6F, 0xDE, 0x01, 0x65, 0x6F, 0xDE, 0x01, 0x65, 0x6F, 0xDE, 0x01, 0x65, 0x6F, 0xDE, 0x15, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF4,
+		0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1,
+		// #184 r 01 02 03 04 0B 0D 00 B1 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC7, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0xB1, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xFF, 0x03, 0xFF, 0x03, 0x74, 0x03, 0x74, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF,
+		0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0xE8, 0x03, 0xFF, 0x03, 0xE8, 0x03, 0xFE, 0x01, 0xA0,
+		0x00, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xFF, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x01, 0x2E, 0x3E, 0x3E, 0x2E, 0x2E, 0x2E, 0x2E, 0x40, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		// #185 r 01 02 03 04 0B 0D 00 C6 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC7, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0xC6, 0x02, 0x32, 0x00, 0x12,
+		0xFD, 0x1E, 0x00, 0xA8, 0xFD, 0x80, 0x0C, 0xE0, 0xFC, 0xA0, 0x0F, 0xDC, 0x05, 0x1E, 0x00, 0x64, 0x00, 0x64, 0x00, 0x96, 0x00, 0xC2, 0x01, 0xBC,
+		0x02, 0xC8, 0x00, 0xF4, 0x01, 0x78, 0x00, 0x58, 0x02, 0xEC, 0xFF, 0x02, 0x64, 0x00, 0x05, 0x78, 0x00, 0x1E, 0x00, 0xEE, 0x02, 0xFA, 0x00, 0xFF,
+		0x0C, 0xFE, 0xC8, 0x00, 0x0A, 0x00, 0x8C, 0x0A, 0x0C, 0xFE, 0x1E, 0x0C, 0xFE, 0x58, 0x02, 0xD0, 0x07, 0x58, 0x02, 0x9C, 0xFF, 0x54, 0x0B, 0xFA,
+		0x00, 0x2C, 0x01, 0x5E, 0x01, 0x90, 0x01, 0xC2, 0x01, 0x90, 0x01, 0x5E, 0x01, 0x2C, 0x01, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00,
+		0x00, 0x00, 0x1E, 0x90, 0x01, 0xC8, 0x00, 0x14, 0x00, 0xEC, 0x00, 0x0E, 0x01, 0x2C, 0x01, 0x46, 0x01, 0x60, 0x01, 0x79, 0x01, 0x00, 0x00, 0xFF,
+		0xC2, 0x01, 0x0F, 0x00, 0x92, 0xFF, 0x8D, 0xFF, 0x88, 0xFF, 0x83, 0xFF, 0x7E, 0xFF, 0x79, 0xFF, 0x74, 0xFF, 0x6F, 0xFF, 0x6A, 0xFF, 0x65, 0xFF,
+		0x60, 0xFF, 0x5B, 0xFF, 0x5B, 0xFF, 0x5B, 0xFF, 0x5B, 0xFF, 0xCE, 0xFF, 0xCE, 0xFF, 0xC9, 0xFF, 0xC9, 0xFF, 0xC4, 0xFF, 0xC4, 0xFF, 0xBF, 0xFF,
+		0xBF, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0x80,
+		// #186 r 01 02 03 04 0B 0D 00 C6 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC7, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0xC6, 0x02, 0x32, 0x00, 0x12,
+		0xFD, 0x1E, 0x00, 0xA8, 0xFD, 0x80, 0x0C, 0xE0, 0xFC, 0xA0, 0x0F, 0xDC, 0x05, 0x1E, 0x00, 0x64, 0x00, 0x64, 0x00, 0x96, 0x00, 0xC2, 0x01, 0xBC,
+		0x02, 0xC8, 0x00, 0xF4, 0x01, 0x78, 0x00, 0x58, 0x02, 0xEC, 0xFF, 0x02, 0x64, 0x00, 0x05, 0x78, 0x00, 0x1E, 0x00, 0xEE, 0x02, 0xFA, 0x00, 0xFF,
+		0x0C, 0xFE, 0xC8, 0x00, 0x0A, 0x00, 0x8C, 0x0A, 0x0C, 0xFE, 0x1E, 0x0C, 0xFE, 0x58, 0x02, 0xD0, 0x07, 0x58, 0x02, 0x9C, 0xFF, 0x54, 0x0B, 0xFA,
+		0x00, 0x2C, 0x01, 0x5E, 0x01, 0x90, 0x01, 0xC2, 0x01, 0x90, 0x01, 0x5E, 0x01, 0x2C, 0x01, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00,
+		0x00, 0x00, 0x1E, 0x90, 0x01, 0xC8, 0x00, 0x14, 0x00, 0xEC, 0x00, 0x0E, 0x01, 0x2C, 0x01, 0x46, 0x01, 0x60, 0x01, 0x79, 0x01, 0x00, 0x14, 0x00,
+		0xC2, 0x01, 0x0F, 0x00, 0x92, 0xFF, 0x8D, 0xFF, 0x88, 0xFF, 0x83, 0xFF, 0x7E, 0xFF, 0x79, 0xFF, 0x74, 0xFF, 0x6F, 0xFF, 0x6A, 0xFF, 0x65, 0xFF,
+		0x60, 0xFF, 0x5B, 0xFF, 0x5B, 0xFF, 0x5B, 0xFF, 0x5B, 0xFF, 0xCE, 0xFF, 0xCE, 0xFF, 0xC9, 0xFF, 0xC9, 0xFF, 0xC4, 0xFF, 0xC4, 0xFF, 0xBF, 0xFF,
+		0xBF, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0x61,
+		// #187 r 01 02 03 04 0B 0D 01 B2 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC7, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xB2, 0x00, 0x22, 0xFC, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05,
+		0x05, 0x00, 0x80, 0x3D, 0xEC, 0x42, 0xAE, 0x4F, 0x71, 0x43, 0xBA, 0xD3, 0xD2, 0x43, 0x11, 0x00, 0x70, 0x43, 0xAC, 0xCF, 0xFD, 0x43, 0xFC, 0xFF,
+		0xD8, 0x43, 0x54, 0x79, 0xBB, 0x42, 0x57, 0x71, 0xC9, 0x43, 0xBB, 0xBD, 0xD9, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x96, 0xC3, 0xEC, 0x33, 0xEC, 0x42, 0x25, 0x2E, 0x71, 0x43, 0x43, 0xA2, 0xD2, 0x43, 0x11, 0x00, 0x70, 0x43, 0xD6, 0xA3, 0xFD, 0x43, 0xF3, 0xFF,
+		0xD8, 0x43, 0x97, 0xF0, 0xBC, 0x42, 0x2D, 0x52, 0xC9, 0x43, 0x3F, 0x64, 0xDF, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x96, 0xC3, 0x0D, 0x00, 0x00, 0xC0, 0x21, 0x01, 0x21, 0x01, 0x00, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x90, 0x00, 0x8D, 0x00, 0x00, 0x00, 0xFF, 0x03,
+		0xFF, 0x03, 0x64, 0x14, 0x27, 0x16, 0xE5,
+		// #188 r 01 02 03 04 0B 0D 01 B2 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC7, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xB2, 0x00, 0x22, 0xFC, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04,
+		0x03, 0x00, 0x93, 0x8B, 0xE7, 0x42, 0x6C, 0x2F, 0x6D, 0x43, 0xCA, 0x6D, 0x62, 0x43, 0xB8, 0x16, 0x74, 0x43, 0x24, 0x3C, 0xA3, 0x43, 0x2C, 0x14,
+		0x59, 0x43, 0x5C, 0xAD, 0x34, 0x43, 0xEF, 0x7F, 0xE3, 0x43, 0x83, 0xEA, 0x2D, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x96, 0xC3, 0xBC, 0x6E, 0xE7, 0x42, 0xDA, 0x77, 0x6F, 0x43, 0xC8, 0xD2, 0x62, 0x43, 0x93, 0x38, 0x74, 0x43, 0x14, 0x73, 0xA3, 0x43, 0xCA, 0x42,
+		0x59, 0x43, 0x6E, 0x1C, 0x34, 0x43, 0xD4, 0x7F, 0xE3, 0x43, 0x33, 0x37, 0x2E, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x96, 0xC3, 0x0D, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x78, 0x00, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03,
+		0xFF, 0x03, 0x5B, 0x14, 0x0F, 0x16, 0x44,
+		// #189 r 01 02 03 04 0B 0D 01 B2 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC7, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xB2, 0x00, 0x22, 0xFC, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x06, 0x06,
+		0x06, 0x00, 0x03, 0x91, 0xE7, 0x42, 0xFD, 0xA8, 0x6B, 0x43, 0xE6, 0x2D, 0x62, 0x43, 0xFF, 0x09, 0x74, 0x43, 0x48, 0xC7, 0xA2, 0x43, 0x80, 0x01,
+		0x59, 0x43, 0x72, 0xDD, 0x34, 0x43, 0xEF, 0x7F, 0xE3, 0x43, 0x36, 0x67, 0x2D, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x96, 0xC3, 0xC0, 0x86, 0xE7, 0x42, 0xBA, 0xAD, 0x6D, 0x43, 0x21, 0x7F, 0x62, 0x43, 0xDF, 0x20, 0x74, 0x43, 0x29, 0xFE, 0xA2, 0x43, 0x8D, 0x08,
+		0x59, 0x43, 0x72, 0x83, 0x34, 0x43, 0xD4, 0x7F, 0xE3, 0x43, 0x80, 0xDB, 0x2D, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x96, 0xC3, 0x0D, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x6D, 0x00, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03,
+		0xFF, 0x03, 0x5A, 0x14, 0x0A, 0x16, 0xE7,
+		// #190 r 01 02 03 04 0B 0D 00 14 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x14, 0x02, 0xE8, 0x03, 0x05,
+		0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+		0x2E, 0x2E, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x0F, 0x0F, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x1E, 0x14, 0xA0,
+		0x0A, 0x0E, 0x01, 0x00, 0x2C, 0x01, 0x14, 0x2C, 0x01, 0x14, 0x05, 0x0F, 0x00, 0x00, 0x01, 0x01, 0x03, 0x01, 0x04, 0x03, 0x01, 0x00, 0x00, 0x00,
+		0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xB4, 0x00, 0x14, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x06, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+		0x28, 0xF0, 0x00, 0x14, 0x00, 0x32, 0x00, 0xCE, 0xFF, 0x05, 0xFA, 0xED, 0xE8, 0xE9, 0xE8, 0xF6, 0x00, 0x1C, 0x01, 0x3E, 0x01, 0x5E, 0x01, 0x7D,
+		0x01, 0x9B, 0x01, 0x1E, 0x00, 0x28, 0x00, 0x1E, 0x00, 0x64, 0x00, 0x32, 0x00, 0xB0, 0x04, 0x5A, 0x00, 0xB0, 0x04, 0x5A, 0x00, 0x46, 0x00, 0xB4,
+		0x00, 0x50, 0x00, 0x78, 0x00, 0xFA, 0x00, 0xE7,
+		// #191 r 01 02 03 04 0B 0D 00 29 04
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x29, 0x04, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x28, 0x00, 0x28,
+		0x00, 0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0xD6, 0x00, 0x2B, 0x00, 0x14, 0x05, 0x2C, 0x01, 0x00, 0x00, 0x84, 0x03, 0x2C, 0x01, 0x0A, 0x00, 0x14,
+		0x00, 0x14, 0x00, 0x14, 0x00, 0x44, 0x02, 0x7D, 0x00, 0x6A, 0xFF, 0xD8, 0xFF, 0x41, 0x00, 0xFA, 0x00, 0x4C, 0x04, 0x7D, 0x00, 0x14, 0x00, 0xF4,
+		0x01, 0x28, 0x00, 0x19, 0x00, 0xEB, 0xFF, 0x46, 0x00, 0x14, 0x00, 0xF4, 0xFF, 0x0F, 0x0D, 0x00, 0x01, 0x14, 0xF4, 0x01, 0xE8, 0x03, 0xD0, 0x07,
+		0xC4, 0x09, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x64, 0x00, 0x0A, 0x00, 0x0A, 0x64, 0x00,
+		0xB0, 0x04, 0xB0, 0x04, 0x32, 0x00, 0xF4, 0x01, 0x96, 0x00, 0x58, 0x02, 0x00, 0x00, 0x50, 0x00, 0x19, 0x00, 0xC8, 0x00, 0x07, 0x00, 0x18, 0x01,
+		0x72, 0x01, 0x87, 0x00, 0xE6, 0x00, 0x05, 0x05, 0x88, 0x13, 0xB0, 0x04, 0xE4, 0x0C, 0x5E, 0x01, 0xE8, 0x03, 0xE8, 0x03, 0x90, 0x01, 0x50, 0x00,
+		0x3C, 0x00, 0x82, 0x00, 0x48, 0x03, 0x32, 0x25,
+		// #192 r 01 02 03 04 0B 0D 00 62 01
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x62, 0x01, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC,
+		0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC,
+		0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0xAC, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8,
+		0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8,
+		0x03, 0xE8, 0x03, 0xE8, 0x03, 0xE8, 0x03, 0x00,
+		// #193 r 01 02 03 04 0B 0D 00 77 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x77, 0x03, 0xB5, 0xFF, 0xB5,
+		0xFF, 0xB5, 0xFF, 0xB5, 0xFF, 0xB5, 0xFF, 0xF1, 0xFF, 0xEC, 0xFF, 0xE7, 0xFF, 0xE2, 0xFF, 0xDD, 0xFF, 0xD8, 0xFF, 0xD3, 0xFF, 0xCE, 0xFF, 0xC9,
+		0xFF, 0xC4, 0xFF, 0xBF, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0xBA, 0xFF, 0x05, 0x1E, 0x14, 0x7E, 0xFF, 0x74, 0xFF, 0x92, 0xFF, 0x88, 0xFF,
+		0xCE, 0xFF, 0xC4, 0xFF, 0xF1, 0xFF, 0xE7, 0xFF, 0x96, 0x00, 0x68, 0x01, 0xC2, 0x01, 0x7E, 0xFF, 0x26, 0x02, 0xB4, 0x00, 0x8A, 0x02, 0xDA, 0x02,
+		0x0A, 0x1E, 0x1E, 0xF4, 0x01, 0x32, 0x00, 0x58, 0x02, 0x68, 0x01, 0x90, 0x01, 0x26, 0x02, 0x58, 0x02, 0x58, 0x02, 0x02, 0xF8, 0x02, 0xD4, 0xFE,
+		0xE8, 0x03, 0x00, 0x00, 0xFA, 0x00, 0x8A, 0x02, 0x8A, 0x02, 0xEE, 0x02, 0x48, 0x03, 0xB6, 0x03, 0xE8, 0x03, 0xD4, 0xFE, 0xBC, 0x02, 0x00, 0x00,
+		0x32, 0x00, 0x27, 0x00, 0x2C, 0x01, 0x0A, 0x01, 0x14, 0x05, 0x28, 0x0A, 0x00, 0x1E, 0x32, 0x90, 0x01, 0x2C, 0x01, 0x28, 0x14, 0x05, 0x05, 0x0A,
+		0xB0, 0x04, 0xC4, 0x09, 0xAC, 0x0D, 0x96, 0x00, 0x26, 0x02, 0x26, 0x02, 0xFA, 0x00, 0x14, 0x26, 0x02, 0xBC, 0x02, 0x34, 0x03, 0xFC, 0x03, 0x1A,
+		0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E,
+		// #194 r 01 02 03 04 0B 0D 00 8D 05
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x8D, 0x05, 0xD3, 0x0C, 0x71,
+		0x0C, 0x05, 0x0C, 0x5D, 0x0A, 0xE9, 0x08, 0x6C, 0x07, 0x1A, 0x06, 0x72, 0x05, 0x8C, 0x04, 0xC8, 0x03, 0x99, 0x0C, 0x3C, 0x0C, 0xD6, 0x0B, 0x59,
+		0x0A, 0xD7, 0x08, 0x68, 0x07, 0x17, 0x06, 0x72, 0x05, 0x89, 0x04, 0xC6, 0x03, 0x75, 0x0C, 0x1C, 0x0C, 0xB8, 0x0B, 0x5B, 0x0A, 0xCC, 0x08, 0x68,
+		0x07, 0x17, 0x06, 0x72, 0x05, 0x88, 0x04, 0xC3, 0x03, 0x66, 0x0C, 0x0D, 0x0C, 0xAA, 0x0B, 0x61, 0x0A, 0xC7, 0x08, 0x6A, 0x07, 0x17, 0x06, 0x73,
+		0x05, 0x88, 0x04, 0xC2, 0x03, 0x68, 0x0C, 0x0D, 0x0C, 0xA7, 0x0B, 0x6A, 0x0A, 0xC8, 0x08, 0x6E, 0x07, 0x1A, 0x06, 0x74, 0x05, 0x8A, 0x04, 0xC1,
+		0x03, 0x78, 0x0C, 0x18, 0x0C, 0xAE, 0x0B, 0x76, 0x0A, 0xCC, 0x08, 0x74, 0x07, 0x1D, 0x06, 0x77, 0x05, 0x8C, 0x04, 0xC2, 0x03, 0x94, 0x0C, 0x2C,
+		0x0C, 0xBC, 0x0B, 0x84, 0x0A, 0xD4, 0x08, 0x7C, 0x07, 0x22, 0x06, 0x7B, 0x05, 0x8F, 0x04, 0xC6, 0x03, 0xB9, 0x0C, 0x47, 0x0C, 0xCD, 0x0B, 0x93,
+		0x0A, 0xDD, 0x08, 0x84, 0x07, 0x27, 0x06, 0x81, 0x05, 0x93, 0x04, 0xCC, 0x03, 0xE5, 0x0C, 0x65, 0x0C, 0xDE, 0x0B, 0xA2, 0x0A, 0xE8, 0x08, 0x8E,
+		0x07, 0x2D, 0x06, 0x87, 0x05, 0x98, 0x04, 0x32,
+		// #195 r 01 02 03 04 0B 0D 00 DB 04
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0xDB, 0x04, 0x1E, 0x00, 0x14,
+		0x14, 0x14, 0x00, 0xE8, 0x03, 0xE8, 0x03, 0x00, 0x05, 0x01, 0x64, 0x00, 0x00, 0x2D, 0x00, 0xBB, 0x03, 0x05, 0x01, 0x1E, 0x2C, 0x01, 0x0A, 0xF4,
+		0x01, 0x3C, 0x00, 0x05, 0x46, 0x00, 0xFA, 0x00, 0x74, 0x04, 0x26, 0x02, 0x78, 0x00, 0xF4, 0x01, 0x32, 0x00, 0x1E, 0x0A, 0xFA, 0x00, 0x0F, 0x28,
+		0x14, 0x14, 0x32, 0x96, 0x00, 0x64, 0x00, 0xB4, 0x00, 0xE8, 0x03, 0x78, 0x00, 0x14, 0x96, 0x00, 0x00, 0x78, 0x00, 0x96, 0x00, 0x96, 0x00, 0x96,
+		0x00, 0x2C, 0x01, 0x26, 0x02, 0x40, 0x01, 0x40, 0x01, 0xFA, 0x00, 0xC2, 0x01, 0x0A, 0x60, 0x09, 0xA0, 0x00, 0x60, 0x09, 0xA0, 0x00, 0x64, 0x96,
+		0x00, 0x14, 0x00, 0x00, 0x32, 0x3C, 0x00, 0x12, 0x06, 0xCE, 0xFF, 0x0A, 0x08, 0x07, 0xF4, 0x01, 0xD0, 0x07, 0xD0, 0x07, 0x58, 0x02, 0x1A, 0xFF,
+		0x2C, 0x01, 0xDA, 0x02, 0x05, 0x50, 0x00, 0x78, 0xB0, 0x04, 0x78, 0xE8, 0x03, 0xE8, 0x03, 0x14, 0x08, 0x07, 0x08, 0x07, 0x5A, 0x00, 0x78, 0x32,
+		0x5A, 0x00, 0x32, 0x08, 0x07, 0x1E, 0x00, 0xCF, 0x00, 0xC0, 0x03, 0x5A, 0x55, 0x50, 0x46, 0x3C, 0x32, 0x28, 0x23, 0x1E, 0x19, 0x78, 0x6E, 0x64,
+		0x5A, 0x50, 0x46, 0x3C, 0x32, 0x28, 0x1E, 0x1F,
+		// #196 r 01 02 03 04 0B 0D 01 00 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x0F, 0x18, 0x20, 0x0A, 0x0C, 0x17, 0x07, 0x00, 0x0F, 0x18, 0x20, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x2C, 0x00, 0x81,
+		0x10, 0x00, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x41, 0x19, 0xFC, 0x19, 0xFC, 0x76, 0x00, 0xF1, 0x00, 0xA5, 0x01, 0xF0, 0x00, 0xFB, 0x01, 0xB2, 0x01, 0x5E, 0x00, 0x1C, 0x00, 0x22, 0xFC, 0x22,
+		0xFC, 0xD4, 0xFE, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x92, 0x01, 0x3A, 0x00, 0x11, 0x00, 0x13, 0x00, 0x89, 0x00, 0x00, 0x00, 0xE8, 0x03, 0xE8, 0x03, 0x00, 0x00, 0x3A,
+		0x00, 0x6B, 0x00, 0x8C, 0x00, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0xF2, 0x00, 0xA6, 0x01, 0xF0, 0x00, 0xFC, 0x01, 0xB2,
+		0x01, 0x5D, 0x00, 0x93, 0x01, 0x1A, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x72,
+		// #197 r 01 02 03 04 0B 0D 01 00 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x10, 0x00, 0x38, 0x0A, 0x0C, 0x17, 0x07, 0x00, 0x10, 0x00, 0x38, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x08, 0x00, 0x89,
+		0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x41, 0x19, 0xFC, 0x19, 0xFC, 0x74, 0x00, 0xEF, 0x00, 0xE3, 0x00, 0xF4, 0x00, 0x47, 0x01, 0xD9, 0x00, 0xB4, 0x00, 0xAE, 0x00, 0x22, 0xFC, 0x22,
+		0xFC, 0xD4, 0xFE, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0xC7, 0x01, 0x45, 0x00, 0x17, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x03, 0xE8, 0x03, 0x00, 0x00, 0x45,
+		0x00, 0x75, 0x00, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0xEB, 0x00, 0xE2, 0x00, 0xF4, 0x00, 0x46, 0x01, 0xD9,
+		0x00, 0xB5, 0x00, 0xC7, 0x01, 0xAD, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x52,
+		// #198 r 01 02 03 04 0B 0D 01 00 00
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x10, 0x01, 0x02, 0x0A, 0x0C, 0x17, 0x07, 0x00, 0x10, 0x01, 0x02, 0x00, 0x00, 0x40, 0x00, 0x41, 0x00, 0x00, 0x04, 0x08, 0x08, 0x00, 0x89,
+		0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x41, 0x19, 0xFC, 0x19, 0xFC, 0x74, 0x00, 0xEE, 0x00, 0xE2, 0x00, 0xF4, 0x00, 0x46, 0x01, 0xD9, 0x00, 0xB4, 0x00, 0xAE, 0x00, 0x22, 0xFC, 0x22,
+		0xFC, 0xD4, 0xFE, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0xC7, 0x01, 0x43, 0x00, 0x10, 0x00, 0x12, 0x00, 0x39, 0x00, 0x00, 0x00, 0xE8, 0x03, 0xE8, 0x03, 0x00, 0x00, 0x43,
+		0x00, 0x6A, 0x00, 0x89, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x00, 0xEA, 0x00, 0xE2, 0x00, 0xF4, 0x00, 0x45, 0x01, 0xD9,
+		0x00, 0xB5, 0x00, 0xC7, 0x01, 0xAD, 0x00, 0x22, 0xFC, 0x22, 0xFC, 0xD4, 0xFE, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22,
+		0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x22, 0xFC, 0x3C,
+		// #199 r 01 02 03 04 0B 0D 01 13 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x13, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x54, 0x02, 0x00, 0x00, 0x54, 0x00, 0x54, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00,
+		0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2,
+		// #200 r 01 02 03 04 0B 0D 01 13 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x13, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x54, 0x02, 0x00, 0x00, 0x75, 0x00, 0x75, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00,
+		0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B,
+		// #201 r 01 02 03 04 0B 0D 01 13 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x13, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x54, 0x02, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xC2, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00,
+		0x08, 0x01, 0x19, 0x01, 0x2E, 0x01, 0x49, 0x01, 0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xC8, 0x00, 0xC2, 0x01, 0x00, 0x00, 0x49, 0x02,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
+		// #202 r 01 02 03 04 0B 0D 01 29 04
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x29, 0x04, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0x40, 0x31, 0x00, 0x00, 0x28, 0x1E, 0x50, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x14, 0x14, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xB4, 0x00, 0x14, 0x00,
+		0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x02,
+		// #203 r 01 02 03 04 0B 0D 01 29 04
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x29, 0x04, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0x40, 0x31, 0x00, 0x00, 0x28, 0x1E, 0x50, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x14, 0x14, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xB4, 0x00, 0x14, 0x00,
+		0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x38,
+		// #204 r 01 02 03 04 0B 0D 01 29 04
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x29, 0x04, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x59, 0x40, 0x31, 0x00, 0x00, 0x28, 0x1E, 0x50, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x10, 0x00, 0x01, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x14, 0x14, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xB4, 0x00, 0x14, 0x00,
+		0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0xB1,
+		// #205 r 01 02 03 04 0B 0D 01 77 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x77, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x25, 0x01, 0x1C, 0xFF, 0x41,
+		0x00, 0x91, 0x00, 0x91, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x10, 0x5F, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4A, 0x7D, 0x30,
+		0x75, 0x00, 0x00, 0xD6, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA, 0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+		0xFF, 0x11, 0x00, 0x00, 0x0D, 0xF4, 0x01, 0xE8, 0x03, 0xDC, 0x05, 0xD0, 0x07, 0xC4, 0x09, 0xB8, 0x0B, 0xAC, 0x0D, 0xA0, 0x0F, 0x94, 0x11, 0x88,
+		0x13, 0x7C, 0x15, 0x70, 0x17, 0x70, 0x17, 0x70, 0x17, 0x70, 0x17, 0xF4, 0x01, 0xE8, 0x03, 0xDC, 0x05, 0xD0, 0x07, 0xC4, 0x09, 0xB8, 0x0B, 0xAC,
+		0x0D, 0xA0, 0x0F, 0x94, 0x11, 0x88, 0x13, 0x7C, 0x15, 0x70, 0x17, 0x70, 0x17, 0x70, 0x17, 0x70, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B,
+		// #206 r 01 02 03 04 0B 0D 01 77 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x77, 0x03, 0x14, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x05, 0x4E, 0x10, 0x13, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4F, 0x75, 0x30,
+		0x75, 0x00, 0x00, 0xDB, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA, 0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+		0xFF, 0x0B, 0x00, 0x00, 0x0D, 0xF4, 0x01, 0xE8, 0x03, 0xDC, 0x05, 0xD0, 0x07, 0xC4, 0x09, 0xB8, 0x0B, 0xAC, 0x0D, 0xA0, 0x0F, 0x94, 0x11, 0x88,
+		0x13, 0x7C, 0x15, 0x70, 0x17, 0x70, 0x17, 0x70, 0x17, 0x70, 0x17, 0xF4, 0x01, 0xE8, 0x03, 0xDC, 0x05, 0xD0, 0x07, 0xC4, 0x09, 0xB8, 0x0B, 0xAC,
+		0x0D, 0xA0, 0x0F, 0x94, 0x11, 0x88, 0x13, 0x7C, 0x15, 0x70, 0x17, 0x70, 0x17, 0x70, 0x17, 0x70, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
+		// #207 r 01 02 03 04 0B 0D 01 77 03
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x77, 0x03, 0x14, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2A, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x05, 0x4E, 0x10, 0x13, 0x03, 0x50, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4F, 0x75, 0x30,
+		0x75, 0x00, 0x00, 0xDB, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xFC, 0xFF, 0xFF, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xAA, 0x05, 0xAA, 0x05, 0xAA, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+		0xFF, 0x11, 0x00, 0x00, 0x0D, 0xF4, 0x01, 0xE8, 0x03, 0xDC, 0x05, 0xD0, 0x07, 0xC4, 0x09, 0xB8, 0x0B, 0xAC, 0x0D, 0xA0, 0x0F, 0x94, 0x11, 0x88,
+		0x13, 0x7C, 0x15, 0x70, 0x17, 0x70, 0x17, 0x70, 0x17, 0x70, 0x17, 0xF4, 0x01, 0xE8, 0x03, 0xDC, 0x05, 0xD0, 0x07, 0xC4, 0x09, 0xB8, 0x0B, 0xAC,
+		0x0D, 0xA0, 0x0F, 0x94, 0x11, 0x88, 0x13, 0x7C, 0x15, 0x70, 0x17, 0x70, 0x17, 0x70, 0x17, 0x70, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91,
+		// #208 r 01 02 03 04 0B 0D 01 C5 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xC5, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0xF8, 0x02, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x01, 0x5E, 0x01, 0xEE, 0x02, 0x00, 0xBA, 0x01, 0x12, 0x01,
+		0x6C, 0x00, 0x19, 0x00, 0xD3, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x00, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0x54, 0xFF, 0x9F, 0xFF, 0x9C, 0xFF, 0xDA, 0xFD,
+		0x00, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0x00, 0x26, 0x02, 0x6E, 0x06, 0xAC, 0x0D,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x0E, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00,
+		0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x6E, 0x06, 0x00, 0x00, 0x56, 0x03, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x01, 0x00, 0x05, 0x00, 0x00, 0x3C, 0x00,
+		0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x48,
+		// #209 r 01 02 03 04 0B 0D 01 C5 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xC5, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0xF8, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x5E, 0x01, 0xEE, 0x02, 0x00, 0xD9, 0x00, 0x9A, 0x00,
+		0x8C, 0x00, 0x0B, 0x00, 0x72, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x00, 0x26, 0x02, 0xB0, 0x04, 0xAC, 0x0D,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x3C, 0x00,
+		0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xCF,
+		// #210 r 01 02 03 04 0B 0D 01 C5 02
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xC5, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0xF8, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x5E, 0x01, 0xEE, 0x02, 0x00, 0xD9, 0x00, 0x9A, 0x00,
+		0x8C, 0x00, 0x0B, 0x00, 0x72, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD, 0xDA, 0xFD,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x00, 0x26, 0x02, 0xB0, 0x04, 0xAC, 0x0D,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0B, 0x00, 0x00, 0x3C, 0x00,
+		0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x8C,
+		// #211 r 01 02 03 04 0B 0D 03 0B 0D
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x03, 0x0B, 0x0D, 0x0C, 0x0B, 0x05,
+		0x17, 0x0D, 0x25, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x07, 0x17, 0x0C, 0x00, 0x00, 0x01, 0x12, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x16, 0x07, 0x17, 0x13, 0x1E, 0x34, 0x02, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x07, 0x17, 0x13, 0x1E, 0x35, 0x03, 0x12,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x08, 0x17, 0x0B, 0x12, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0A, 0x17, 0x0C,
+		0x00, 0x00, 0x01, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0A, 0x17, 0x0C, 0x00, 0x15, 0x02, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x14, 0x0A, 0x17, 0x0C, 0x00, 0x18, 0x03, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x0B, 0x17, 0x0F, 0x14, 0x09, 0x01, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x1C, 0x0B, 0x17, 0x0F, 0x32, 0x28, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x0B, 0x17, 0x0F, 0x32, 0x28,
+		0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0C, 0x17, 0x0F, 0x0B, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x0A,
+		0x16, 0x0A, 0x13, 0x07, 0x00, 0x00, 0x00, 0xE4,
+		// #212 r 01 02 03 04 0B 0D 03 6F 0E
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x03, 0x6F, 0x0E, 0x0C, 0x02, 0x12,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x04, 0x17, 0x15, 0x00, 0x0D, 0x03, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x17, 0x0C,
+		0x34, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x05, 0x17, 0x14, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x0B, 0x05, 0x17, 0x0D, 0x1F, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x16, 0x00, 0x0A, 0x08, 0x07,
+		0x00, 0x09, 0x08, 0x0A, 0x1E, 0x03, 0x08, 0x0C, 0x1E, 0x04, 0x08, 0x12, 0x14, 0x03, 0x08, 0x14, 0x14, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+		0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x91,
+		// #213 r 01 02 03 04 0B 0D 03 BD 0D
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x03, 0xBD, 0x0D, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x18, 0x0A, 0x16, 0x0C, 0x00, 0x00, 0x01, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0A, 0x16, 0x0D, 0x01, 0x00, 0x02, 0x12,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0A, 0x16, 0x0D, 0x03, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0A, 0x16, 0x0D,
+		0x03, 0x2D, 0x01, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0A, 0x16, 0x0D, 0x04, 0x02, 0x02, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x18, 0x0A, 0x16, 0x0D, 0x04, 0x04, 0x03, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x01, 0x17, 0x0C, 0x00, 0x00, 0x01, 0x12, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x16, 0x01, 0x17, 0x0D, 0x00, 0x14, 0x02, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x01, 0x17, 0x12, 0x31, 0x19,
+		0x03, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x03, 0x17, 0x0F, 0x08, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x03,
+		0x17, 0x11, 0x24, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x04, 0x17, 0x0C, 0x00, 0x00, 0x01, 0x12, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x17, 0x04, 0x17, 0x15, 0x00, 0xEE,
+		// #214 r 01 02 03 04 0B 0D 04 9C 3E
+		0x41, 0x44, 0x44, 0x52, 0x07, 0x8A, 0x65, 0x6F, 0xDE, 0x02, 0xC8, 0x72, 0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x04, 0x9C, 0x3E, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D,
+	};
+
+static const byte comfortzone_corpus_frame_types[215] =
+	{
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2,
+		3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 3, 3, 3, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+		3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+		4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	};
+
+static const COMFORTZONE_CORPUS_VALUE comfortzone_corpus_values[] =
+	{
+		{ 0, CZSF_ROOM_HEATING_SETTING, 240 },
+		{ 1, CZSF_ROOM_HEATING_SETTING, 240 },
+		{ 2, CZSF_HOUR, 15 },
+		{ 2, CZSF_MINUTE, 24 },
+		{ 2, CZSF_SECOND, 8 },
+		{ 2, CZSF_DAY, 10 },
+		{ 2, CZSF_MONTH, 12 },
+		{ 2, CZSF_YEAR, 2023 },
+		{ 2, CZSF_DAY_OF_WEEK, 7 },
+		{ 2, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 118 },
+		{ 2, CZSF_SENSORS_TE1_FLOW_WATER, 241 },
+		{ 2, CZSF_SENSORS_TE2_RETURN_WATER, 420 },
+		{ 2, CZSF_SENSORS_TE3_INDOOR_TEMP, 240 },
+		{ 2, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 506 },
+		{ 2, CZSF_SENSORS_TE5_EXCHANGER_OUT, 433 },
+		{ 2, CZSF_SENSORS_TE6_EVAPORATOR_IN, 97 },
+		{ 2, CZSF_SENSORS_TE7_EXHAUST_AIR, 30 },
+		{ 2, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 402 },
+		{ 3, CZSF_HOUR, 15 },
+		{ 3, CZSF_MINUTE, 24 },
+		{ 3, CZSF_SECOND, 10 },
+		{ 3, CZSF_DAY, 10 },
+		{ 3, CZSF_MONTH, 12 },
+		{ 3, CZSF_YEAR, 2023 },
+		{ 3, CZSF_DAY_OF_WEEK, 7 },
+		{ 3, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 118 },
+		{ 3, CZSF_SENSORS_TE1_FLOW_WATER, 241 },
+		{ 3, CZSF_SENSORS_TE2_RETURN_WATER, 421 },
+		{ 3, CZSF_SENSORS_TE3_INDOOR_TEMP, 240 },
+		{ 3, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 506 },
+		{ 3, CZSF_SENSORS_TE5_EXCHANGER_OUT, 434 },
+		{ 3, CZSF_SENSORS_TE6_EVAPORATOR_IN, 96 },
+		{ 3, CZSF_SENSORS_TE7_EXHAUST_AIR, 30 },
+		{ 3, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 402 },
+		{ 4, CZSF_HOUR, 15 },
+		{ 4, CZSF_MINUTE, 24 },
+		{ 4, CZSF_SECOND, 13 },
+		{ 4, CZSF_DAY, 10 },
+		{ 4, CZSF_MONTH, 12 },
+		{ 4, CZSF_YEAR, 2023 },
+		{ 4, CZSF_DAY_OF_WEEK, 7 },
+		{ 4, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 118 },
+		{ 4, CZSF_SENSORS_TE1_FLOW_WATER, 241 },
+		{ 4, CZSF_SENSORS_TE2_RETURN_WATER, 421 },
+		{ 4, CZSF_SENSORS_TE3_INDOOR_TEMP, 240 },
+		{ 4, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 506 },
+		{ 4, CZSF_SENSORS_TE5_EXCHANGER_OUT, 434 },
+		{ 4, CZSF_SENSORS_TE6_EVAPORATOR_IN, 96 },
+		{ 4, CZSF_SENSORS_TE7_EXHAUST_AIR, 30 },
+		{ 4, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 402 },
+		{ 5, CZSF_HOUR, 15 },
+		{ 5, CZSF_MINUTE, 24 },
+		{ 5, CZSF_SECOND, 15 },
+		{ 5, CZSF_DAY, 10 },
+		{ 5, CZSF_MONTH, 12 },
+		{ 5, CZSF_YEAR, 2023 },
+		{ 5, CZSF_DAY_OF_WEEK, 7 },
+		{ 5, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 118 },
+		{ 5, CZSF_SENSORS_TE1_FLOW_WATER, 241 },
+		{ 5, CZSF_SENSORS_TE2_RETURN_WATER, 421 },
+		{ 5, CZSF_SENSORS_TE3_INDOOR_TEMP, 240 },
+		{ 5, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 506 },
+		{ 5, CZSF_SENSORS_TE5_EXCHANGER_OUT, 434 },
+		{ 5, CZSF_SENSORS_TE6_EVAPORATOR_IN, 96 },
+		{ 5, CZSF_SENSORS_TE7_EXHAUST_AIR, 29 },
+		{ 5, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 402 },
+		{ 6, CZSF_HOUR, 15 },
+		{ 6, CZSF_MINUTE, 24 },
+		{ 6, CZSF_SECOND, 18 },
+		{ 6, CZSF_DAY, 10 },
+		{ 6, CZSF_MONTH, 12 },
+		{ 6, CZSF_YEAR, 2023 },
+		{ 6, CZSF_DAY_OF_WEEK, 7 },
+		{ 6, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 118 },
+		{ 6, CZSF_SENSORS_TE1_FLOW_WATER, 241 },
+		{ 6, CZSF_SENSORS_TE2_RETURN_WATER, 421 },
+		{ 6, CZSF_SENSORS_TE3_INDOOR_TEMP, 240 },
+		{ 6, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 506 },
+		{ 6, CZSF_SENSORS_TE5_EXCHANGER_OUT, 434 },
+		{ 6, CZSF_SENSORS_TE6_EVAPORATOR_IN, 96 },
+		{ 6, CZSF_SENSORS_TE7_EXHAUST_AIR, 29 },
+		{ 6, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 402 },
+		{ 7, CZSF_HOUR, 15 },
+		{ 7, CZSF_MINUTE, 24 },
+		{ 7, CZSF_SECOND, 21 },
+		{ 7, CZSF_DAY, 10 },
+		{ 7, CZSF_MONTH, 12 },
+		{ 7, CZSF_YEAR, 2023 },
+		{ 7, CZSF_DAY_OF_WEEK, 7 },
+		{ 7, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 118 },
+		{ 7, CZSF_SENSORS_TE1_FLOW_WATER, 241 },
+		{ 7, CZSF_SENSORS_TE2_RETURN_WATER, 421 },
+		{ 7, CZSF_SENSORS_TE3_INDOOR_TEMP, 240 },
+		{ 7, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 506 },
+		{ 7, CZSF_SENSORS_TE5_EXCHANGER_OUT, 434 },
+		{ 7, CZSF_SENSORS_TE6_EVAPORATOR_IN, 95 },
+		{ 7, CZSF_SENSORS_TE7_EXHAUST_AIR, 29 },
+		{ 7, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 402 },
+		{ 8, CZSF_HOUR, 15 },
+		{ 8, CZSF_MINUTE, 24 },
+		{ 8, CZSF_SECOND, 23 },
+		{ 8, CZSF_DAY, 10 },
+		{ 8, CZSF_MONTH, 12 },
+		{ 8, CZSF_YEAR, 2023 },
+		{ 8, CZSF_DAY_OF_WEEK, 7 },
+		{ 8, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 118 },
+		{ 8, CZSF_SENSORS_TE1_FLOW_WATER, 241 },
+		{ 8, CZSF_SENSORS_TE2_RETURN_WATER, 421 },
+		{ 8, CZSF_SENSORS_TE3_INDOOR_TEMP, 240 },
+		{ 8, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 507 },
+		{ 8, CZSF_SENSORS_TE5_EXCHANGER_OUT, 434 },
+		{ 8, CZSF_SENSORS_TE6_EVAPORATOR_IN, 95 },
+		{ 8, CZSF_SENSORS_TE7_EXHAUST_AIR, 29 },
+		{ 8, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 402 },
+		{ 9, CZSF_HOUR, 15 },
+		{ 9, CZSF_MINUTE, 24 },
+		{ 9, CZSF_SECOND, 26 },
+		{ 9, CZSF_DAY, 10 },
+		{ 9, CZSF_MONTH, 12 },
+		{ 9, CZSF_YEAR, 2023 },
+		{ 9, CZSF_DAY_OF_WEEK, 7 },
+		{ 9, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 118 },
+		{ 9, CZSF_SENSORS_TE1_FLOW_WATER, 241 },
+		{ 9, CZSF_SENSORS_TE2_RETURN_WATER, 421 },
+		{ 9, CZSF_SENSORS_TE3_INDOOR_TEMP, 240 },
+		{ 9, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 507 },
+		{ 9, CZSF_SENSORS_TE5_EXCHANGER_OUT, 434 },
+		{ 9, CZSF_SENSORS_TE6_EVAPORATOR_IN, 95 },
+		{ 9, CZSF_SENSORS_TE7_EXHAUST_AIR, 28 },
+		{ 9, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 402 },
+		{ 10, CZSF_HOUR, 15 },
+		{ 10, CZSF_MINUTE, 24 },
+		{ 10, CZSF_SECOND, 29 },
+		{ 10, CZSF_DAY, 10 },
+		{ 10, CZSF_MONTH, 12 },
+		{ 10, CZSF_YEAR, 2023 },
+		{ 10, CZSF_DAY_OF_WEEK, 7 },
+		{ 10, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 118 },
+		{ 10, CZSF_SENSORS_TE1_FLOW_WATER, 241 },
+		{ 10, CZSF_SENSORS_TE2_RETURN_WATER, 421 },
+		{ 10, CZSF_SENSORS_TE3_INDOOR_TEMP, 240 },
+		{ 10, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 507 },
+		{ 10, CZSF_SENSORS_TE5_EXCHANGER_OUT, 434 },
+		{ 10, CZSF_SENSORS_TE6_EVAPORATOR_IN, 95 },
+		{ 10, CZSF_SENSORS_TE7_EXHAUST_AIR, 28 },
+		{ 10, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 402 },
+		{ 11, CZSF_HOUR, 15 },
+		{ 11, CZSF_MINUTE, 24 },
+		{ 11, CZSF_SECOND, 36 },
+		{ 11, CZSF_DAY, 10 },
+		{ 11, CZSF_MONTH, 12 },
+		{ 11, CZSF_YEAR, 2023 },
+		{ 11, CZSF_DAY_OF_WEEK, 7 },
+		{ 11, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 118 },
+		{ 11, CZSF_SENSORS_TE1_FLOW_WATER, 241 },
+		{ 11, CZSF_SENSORS_TE2_RETURN_WATER, 421 },
+		{ 11, CZSF_SENSORS_TE3_INDOOR_TEMP, 240 },
+		{ 11, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 507 },
+		{ 11, CZSF_SENSORS_TE5_EXCHANGER_OUT, 434 },
+		{ 11, CZSF_SENSORS_TE6_EVAPORATOR_IN, 94 },
+		{ 11, CZSF_SENSORS_TE7_EXHAUST_AIR, 27 },
+		{ 11, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 403 },
+		{ 12, CZSF_HOUR, 15 },
+		{ 12, CZSF_MINUTE, 24 },
+		{ 12, CZSF_SECOND, 38 },
+		{ 12, CZSF_DAY, 10 },
+		{ 12, CZSF_MONTH, 12 },
+		{ 12, CZSF_YEAR, 2023 },
+		{ 12, CZSF_DAY_OF_WEEK, 7 },
+		{ 12, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 118 },
+		{ 12, CZSF_SENSORS_TE1_FLOW_WATER, 241 },
+		{ 12, CZSF_SENSORS_TE2_RETURN_WATER, 421 },
+		{ 12, CZSF_SENSORS_TE3_INDOOR_TEMP, 240 },
+		{ 12, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 508 },
+		{ 12, CZSF_SENSORS_TE5_EXCHANGER_OUT, 434 },
+		{ 12, CZSF_SENSORS_TE6_EVAPORATOR_IN, 94 },
+		{ 12, CZSF_SENSORS_TE7_EXHAUST_AIR, 27 },
+		{ 12, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 403 },
+		{ 13, CZSF_HOUR, 15 },
+		{ 13, CZSF_MINUTE, 24 },
+		{ 13, CZSF_SECOND, 41 },
+		{ 13, CZSF_DAY, 10 },
+		{ 13, CZSF_MONTH, 12 },
+		{ 13, CZSF_YEAR, 2023 },
+		{ 13, CZSF_DAY_OF_WEEK, 7 },
+		{ 13, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 118 },
+		{ 13, CZSF_SENSORS_TE1_FLOW_WATER, 241 },
+		{ 13, CZSF_SENSORS_TE2_RETURN_WATER, 422 },
+		{ 13, CZSF_SENSORS_TE3_INDOOR_TEMP, 240 },
+		{ 13, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 508 },
+		{ 13, CZSF_SENSORS_TE5_EXCHANGER_OUT, 434 },
+		{ 13, CZSF_SENSORS_TE6_EVAPORATOR_IN, 94 },
+		{ 13, CZSF_SENSORS_TE7_EXHAUST_AIR, 27 },
+		{ 13, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 403 },
+		{ 14, CZSF_HOUR, 15 },
+		{ 14, CZSF_MINUTE, 24 },
+		{ 14, CZSF_SECOND, 44 },
+		{ 14, CZSF_DAY, 10 },
+		{ 14, CZSF_MONTH, 12 },
+		{ 14, CZSF_YEAR, 2023 },
+		{ 14, CZSF_DAY_OF_WEEK, 7 },
+		{ 14, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 118 },
+		{ 14, CZSF_SENSORS_TE1_FLOW_WATER, 241 },
+		{ 14, CZSF_SENSORS_TE2_RETURN_WATER, 422 },
+		{ 14, CZSF_SENSORS_TE3_INDOOR_TEMP, 240 },
+		{ 14, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 508 },
+		{ 14, CZSF_SENSORS_TE5_EXCHANGER_OUT, 434 },
+		{ 14, CZSF_SENSORS_TE6_EVAPORATOR_IN, 93 },
+		{ 14, CZSF_SENSORS_TE7_EXHAUST_AIR, 27 },
+		{ 14, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 403 },
+		{ 15, CZSF_HOUR, 15 },
+		{ 15, CZSF_MINUTE, 24 },
+		{ 15, CZSF_SECOND, 46 },
+		{ 15, CZSF_DAY, 10 },
+		{ 15, CZSF_MONTH, 12 },
+		{ 15, CZSF_YEAR, 2023 },
+		{ 15, CZSF_DAY_OF_WEEK, 7 },
+		{ 15, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 118 },
+		{ 15, CZSF_SENSORS_TE1_FLOW_WATER, 241 },
+		{ 15, CZSF_SENSORS_TE2_RETURN_WATER, 422 },
+		{ 15, CZSF_SENSORS_TE3_INDOOR_TEMP, 240 },
+		{ 15, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 508 },
+		{ 15, CZSF_SENSORS_TE5_EXCHANGER_OUT, 434 },
+		{ 15, CZSF_SENSORS_TE6_EVAPORATOR_IN, 93 },
+		{ 15, CZSF_SENSORS_TE7_EXHAUST_AIR, 26 },
+		{ 15, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 403 },
+		{ 16, CZSF_HOUR, 15 },
+		{ 16, CZSF_MINUTE, 24 },
+		{ 16, CZSF_SECOND, 49 },
+		{ 16, CZSF_DAY, 10 },
+		{ 16, CZSF_MONTH, 12 },
+		{ 16, CZSF_YEAR, 2023 },
+		{ 16, CZSF_DAY_OF_WEEK, 7 },
+		{ 16, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 118 },
+		{ 16, CZSF_SENSORS_TE1_FLOW_WATER, 241 },
+		{ 16, CZSF_SENSORS_TE2_RETURN_WATER, 422 },
+		{ 16, CZSF_SENSORS_TE3_INDOOR_TEMP, 240 },
+		{ 16, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 508 },
+		{ 16, CZSF_SENSORS_TE5_EXCHANGER_OUT, 434 },
+		{ 16, CZSF_SENSORS_TE6_EVAPORATOR_IN, 93 },
+		{ 16, CZSF_SENSORS_TE7_EXHAUST_AIR, 26 },
+		{ 16, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 403 },
+		{ 17, CZSF_HOUR, 15 },
+		{ 17, CZSF_MINUTE, 24 },
+		{ 17, CZSF_SECOND, 52 },
+		{ 17, CZSF_DAY, 10 },
+		{ 17, CZSF_MONTH, 12 },
+		{ 17, CZSF_YEAR, 2023 },
+		{ 17, CZSF_DAY_OF_WEEK, 7 },
+		{ 17, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 118 },
+		{ 17, CZSF_SENSORS_TE1_FLOW_WATER, 241 },
+		{ 17, CZSF_SENSORS_TE2_RETURN_WATER, 422 },
+		{ 17, CZSF_SENSORS_TE3_INDOOR_TEMP, 240 },
+		{ 17, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 509 },
+		{ 17, CZSF_SENSORS_TE5_EXCHANGER_OUT, 434 },
+		{ 17, CZSF_SENSORS_TE6_EVAPORATOR_IN, 93 },
+		{ 17, CZSF_SENSORS_TE7_EXHAUST_AIR, 26 },
+		{ 17, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 403 },
+		{ 18, CZSF_HOUR, 15 },
+		{ 18, CZSF_MINUTE, 24 },
+		{ 18, CZSF_SECOND, 54 },
+		{ 18, CZSF_DAY, 10 },
+		{ 18, CZSF_MONTH, 12 },
+		{ 18, CZSF_YEAR, 2023 },
+		{ 18, CZSF_DAY_OF_WEEK, 7 },
+		{ 18, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 118 },
+		{ 18, CZSF_SENSORS_TE1_FLOW_WATER, 242 },
+		{ 18, CZSF_SENSORS_TE2_RETURN_WATER, 422 },
+		{ 18, CZSF_SENSORS_TE3_INDOOR_TEMP, 240 },
+		{ 18, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 509 },
+		{ 18, CZSF_SENSORS_TE5_EXCHANGER_OUT, 434 },
+		{ 18, CZSF_SENSORS_TE6_EVAPORATOR_IN, 92 },
+		{ 18, CZSF_SENSORS_TE7_EXHAUST_AIR, 25 },
+		{ 18, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 403 },
+		{ 19, CZSF_HOUR, 15 },
+		{ 19, CZSF_MINUTE, 24 },
+		{ 19, CZSF_SECOND, 57 },
+		{ 19, CZSF_DAY, 10 },
+		{ 19, CZSF_MONTH, 12 },
+		{ 19, CZSF_YEAR, 2023 },
+		{ 19, CZSF_DAY_OF_WEEK, 7 },
+		{ 19, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 118 },
+		{ 19, CZSF_SENSORS_TE1_FLOW_WATER, 242 },
+		{ 19, CZSF_SENSORS_TE2_RETURN_WATER, 422 },
+		{ 19, CZSF_SENSORS_TE3_INDOOR_TEMP, 240 },
+		{ 19, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 509 },
+		{ 19, CZSF_SENSORS_TE5_EXCHANGER_OUT, 435 },
+		{ 19, CZSF_SENSORS_TE6_EVAPORATOR_IN, 92 },
+		{ 19, CZSF_SENSORS_TE7_EXHAUST_AIR, 25 },
+		{ 19, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 403 },
+		{ 20, CZSF_HOUR, 15 },
+		{ 20, CZSF_MINUTE, 59 },
+		{ 20, CZSF_SECOND, 59 },
+		{ 20, CZSF_DAY, 10 },
+		{ 20, CZSF_MONTH, 12 },
+		{ 20, CZSF_YEAR, 2023 },
+		{ 20, CZSF_DAY_OF_WEEK, 7 },
+		{ 20, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 116 },
+		{ 20, CZSF_SENSORS_TE1_FLOW_WATER, 271 },
+		{ 20, CZSF_SENSORS_TE2_RETURN_WATER, 229 },
+		{ 20, CZSF_SENSORS_TE3_INDOOR_TEMP, 245 },
+		{ 20, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 344 },
+		{ 20, CZSF_SENSORS_TE5_EXCHANGER_OUT, 225 },
+		{ 20, CZSF_SENSORS_TE6_EVAPORATOR_IN, 174 },
+		{ 20, CZSF_SENSORS_TE7_EXHAUST_AIR, 176 },
+		{ 20, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 455 },
+		{ 21, CZSF_HOUR, 16 },
+		{ 21, CZSF_MINUTE, 0 },
+		{ 21, CZSF_SECOND, 2 },
+		{ 21, CZSF_DAY, 10 },
+		{ 21, CZSF_MONTH, 12 },
+		{ 21, CZSF_YEAR, 2023 },
+		{ 21, CZSF_DAY_OF_WEEK, 7 },
+		{ 21, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 116 },
+		{ 21, CZSF_SENSORS_TE1_FLOW_WATER, 269 },
+		{ 21, CZSF_SENSORS_TE2_RETURN_WATER, 229 },
+		{ 21, CZSF_SENSORS_TE3_INDOOR_TEMP, 245 },
+		{ 21, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 342 },
+		{ 21, CZSF_SENSORS_TE5_EXCHANGER_OUT, 224 },
+		{ 21, CZSF_SENSORS_TE6_EVAPORATOR_IN, 174 },
+		{ 21, CZSF_SENSORS_TE7_EXHAUST_AIR, 176 },
+		{ 21, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 455 },
+		{ 22, CZSF_HOUR, 16 },
+		{ 22, CZSF_MINUTE, 0 },
+		{ 22, CZSF_SECOND, 4 },
+		{ 22, CZSF_DAY, 10 },
+		{ 22, CZSF_MONTH, 12 },
+		{ 22, CZSF_YEAR, 2023 },
+		{ 22, CZSF_DAY_OF_WEEK, 7 },
+		{ 22, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 116 },
+		{ 22, CZSF_SENSORS_TE1_FLOW_WATER, 267 },
+		{ 22, CZSF_SENSORS_TE2_RETURN_WATER, 229 },
+		{ 22, CZSF_SENSORS_TE3_INDOOR_TEMP, 245 },
+		{ 22, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 342 },
+		{ 22, CZSF_SENSORS_TE5_EXCHANGER_OUT, 224 },
+		{ 22, CZSF_SENSORS_TE6_EVAPORATOR_IN, 174 },
+		{ 22, CZSF_SENSORS_TE7_EXHAUST_AIR, 176 },
+		{ 22, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 455 },
+		{ 23, CZSF_HOUR, 16 },
+		{ 23, CZSF_MINUTE, 0 },
+		{ 23, CZSF_SECOND, 7 },
+		{ 23, CZSF_DAY, 10 },
+		{ 23, CZSF_MONTH, 12 },
+		{ 23, CZSF_YEAR, 2023 },
+		{ 23, CZSF_DAY_OF_WEEK, 7 },
+		{ 23, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 116 },
+		{ 23, CZSF_SENSORS_TE1_FLOW_WATER, 265 },
+		{ 23, CZSF_SENSORS_TE2_RETURN_WATER, 229 },
+		{ 23, CZSF_SENSORS_TE3_INDOOR_TEMP, 245 },
+		{ 23, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 340 },
+		{ 23, CZSF_SENSORS_TE5_EXCHANGER_OUT, 223 },
+		{ 23, CZSF_SENSORS_TE6_EVAPORATOR_IN, 175 },
+		{ 23, CZSF_SENSORS_TE7_EXHAUST_AIR, 176 },
+		{ 23, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 455 },
+		{ 24, CZSF_HOUR, 16 },
+		{ 24, CZSF_MINUTE, 0 },
+		{ 24, CZSF_SECOND, 10 },
+		{ 24, CZSF_DAY, 10 },
+		{ 24, CZSF_MONTH, 12 },
+		{ 24, CZSF_YEAR, 2023 },
+		{ 24, CZSF_DAY_OF_WEEK, 7 },
+		{ 24, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 116 },
+		{ 24, CZSF_SENSORS_TE1_FLOW_WATER, 263 },
+		{ 24, CZSF_SENSORS_TE2_RETURN_WATER, 228 },
+		{ 24, CZSF_SENSORS_TE3_INDOOR_TEMP, 245 },
+		{ 24, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 340 },
+		{ 24, CZSF_SENSORS_TE5_EXCHANGER_OUT, 223 },
+		{ 24, CZSF_SENSORS_TE6_EVAPORATOR_IN, 175 },
+		{ 24, CZSF_SENSORS_TE7_EXHAUST_AIR, 176 },
+		{ 24, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 455 },
+		{ 25, CZSF_HOUR, 16 },
+		{ 25, CZSF_MINUTE, 0 },
+		{ 25, CZSF_SECOND, 12 },
+		{ 25, CZSF_DAY, 10 },
+		{ 25, CZSF_MONTH, 12 },
+		{ 25, CZSF_YEAR, 2023 },
+		{ 25, CZSF_DAY_OF_WEEK, 7 },
+		{ 25, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 116 },
+		{ 25, CZSF_SENSORS_TE1_FLOW_WATER, 261 },
+		{ 25, CZSF_SENSORS_TE2_RETURN_WATER, 228 },
+		{ 25, CZSF_SENSORS_TE3_INDOOR_TEMP, 245 },
+		{ 25, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 338 },
+		{ 25, CZSF_SENSORS_TE5_EXCHANGER_OUT, 222 },
+		{ 25, CZSF_SENSORS_TE6_EVAPORATOR_IN, 175 },
+		{ 25, CZSF_SENSORS_TE7_EXHAUST_AIR, 176 },
+		{ 25, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 455 },
+		{ 26, CZSF_HOUR, 16 },
+		{ 26, CZSF_MINUTE, 0 },
+		{ 26, CZSF_SECOND, 15 },
+		{ 26, CZSF_DAY, 10 },
+		{ 26, CZSF_MONTH, 12 },
+		{ 26, CZSF_YEAR, 2023 },
+		{ 26, CZSF_DAY_OF_WEEK, 7 },
+		{ 26, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 116 },
+		{ 26, CZSF_SENSORS_TE1_FLOW_WATER, 259 },
+		{ 26, CZSF_SENSORS_TE2_RETURN_WATER, 228 },
+		{ 26, CZSF_SENSORS_TE3_INDOOR_TEMP, 245 },
+		{ 26, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 338 },
+		{ 26, CZSF_SENSORS_TE5_EXCHANGER_OUT, 222 },
+		{ 26, CZSF_SENSORS_TE6_EVAPORATOR_IN, 176 },
+		{ 26, CZSF_SENSORS_TE7_EXHAUST_AIR, 176 },
+		{ 26, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 455 },
+		{ 27, CZSF_HOUR, 16 },
+		{ 27, CZSF_MINUTE, 0 },
+		{ 27, CZSF_SECOND, 17 },
+		{ 27, CZSF_DAY, 10 },
+		{ 27, CZSF_MONTH, 12 },
+		{ 27, CZSF_YEAR, 2023 },
+		{ 27, CZSF_DAY_OF_WEEK, 7 },
+		{ 27, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 116 },
+		{ 27, CZSF_SENSORS_TE1_FLOW_WATER, 257 },
+		{ 27, CZSF_SENSORS_TE2_RETURN_WATER, 228 },
+		{ 27, CZSF_SENSORS_TE3_INDOOR_TEMP, 245 },
+		{ 27, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 336 },
+		{ 27, CZSF_SENSORS_TE5_EXCHANGER_OUT, 221 },
+		{ 27, CZSF_SENSORS_TE6_EVAPORATOR_IN, 176 },
+		{ 27, CZSF_SENSORS_TE7_EXHAUST_AIR, 175 },
+		{ 27, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 455 },
+		{ 28, CZSF_HOUR, 16 },
+		{ 28, CZSF_MINUTE, 0 },
+		{ 28, CZSF_SECOND, 20 },
+		{ 28, CZSF_DAY, 10 },
+		{ 28, CZSF_MONTH, 12 },
+		{ 28, CZSF_YEAR, 2023 },
+		{ 28, CZSF_DAY_OF_WEEK, 7 },
+		{ 28, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 116 },
+		{ 28, CZSF_SENSORS_TE1_FLOW_WATER, 257 },
+		{ 28, CZSF_SENSORS_TE2_RETURN_WATER, 228 },
+		{ 28, CZSF_SENSORS_TE3_INDOOR_TEMP, 245 },
+		{ 28, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 336 },
+		{ 28, CZSF_SENSORS_TE5_EXCHANGER_OUT, 221 },
+		{ 28, CZSF_SENSORS_TE6_EVAPORATOR_IN, 176 },
+		{ 28, CZSF_SENSORS_TE7_EXHAUST_AIR, 175 },
+		{ 28, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 455 },
+		{ 29, CZSF_HOUR, 16 },
+		{ 29, CZSF_MINUTE, 0 },
+		{ 29, CZSF_SECOND, 23 },
+		{ 29, CZSF_DAY, 10 },
+		{ 29, CZSF_MONTH, 12 },
+		{ 29, CZSF_YEAR, 2023 },
+		{ 29, CZSF_DAY_OF_WEEK, 7 },
+		{ 29, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 116 },
+		{ 29, CZSF_SENSORS_TE1_FLOW_WATER, 255 },
+		{ 29, CZSF_SENSORS_TE2_RETURN_WATER, 228 },
+		{ 29, CZSF_SENSORS_TE3_INDOOR_TEMP, 245 },
+		{ 29, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 334 },
+		{ 29, CZSF_SENSORS_TE5_EXCHANGER_OUT, 221 },
+		{ 29, CZSF_SENSORS_TE6_EVAPORATOR_IN, 177 },
+		{ 29, CZSF_SENSORS_TE7_EXHAUST_AIR, 175 },
+		{ 29, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 455 },
+		{ 30, CZSF_HOUR, 16 },
+		{ 30, CZSF_MINUTE, 0 },
+		{ 30, CZSF_SECOND, 25 },
+		{ 30, CZSF_DAY, 10 },
+		{ 30, CZSF_MONTH, 12 },
+		{ 30, CZSF_YEAR, 2023 },
+		{ 30, CZSF_DAY_OF_WEEK, 7 },
+		{ 30, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 116 },
+		{ 30, CZSF_SENSORS_TE1_FLOW_WATER, 253 },
+		{ 30, CZSF_SENSORS_TE2_RETURN_WATER, 228 },
+		{ 30, CZSF_SENSORS_TE3_INDOOR_TEMP, 245 },
+		{ 30, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 334 },
+		{ 30, CZSF_SENSORS_TE5_EXCHANGER_OUT, 220 },
+		{ 30, CZSF_SENSORS_TE6_EVAPORATOR_IN, 177 },
+		{ 30, CZSF_SENSORS_TE7_EXHAUST_AIR, 175 },
+		{ 30, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 455 },
+		{ 31, CZSF_HOUR, 16 },
+		{ 31, CZSF_MINUTE, 0 },
+		{ 31, CZSF_SECOND, 28 },
+		{ 31, CZSF_DAY, 10 },
+		{ 31, CZSF_MONTH, 12 },
+		{ 31, CZSF_YEAR, 2023 },
+		{ 31, CZSF_DAY_OF_WEEK, 7 },
+		{ 31, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 116 },
+		{ 31, CZSF_SENSORS_TE1_FLOW_WATER, 251 },
+		{ 31, CZSF_SENSORS_TE2_RETURN_WATER, 228 },
+		{ 31, CZSF_SENSORS_TE3_INDOOR_TEMP, 245 },
+		{ 31, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 332 },
+		{ 31, CZSF_SENSORS_TE5_EXCHANGER_OUT, 220 },
+		{ 31, CZSF_SENSORS_TE6_EVAPORATOR_IN, 177 },
+		{ 31, CZSF_SENSORS_TE7_EXHAUST_AIR, 175 },
+		{ 31, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 455 },
+		{ 32, CZSF_HOUR, 16 },
+		{ 32, CZSF_MINUTE, 0 },
+		{ 32, CZSF_SECOND, 31 },
+		{ 32, CZSF_DAY, 10 },
+		{ 32, CZSF_MONTH, 12 },
+		{ 32, CZSF_YEAR, 2023 },
+		{ 32, CZSF_DAY_OF_WEEK, 7 },
+		{ 32, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 116 },
+		{ 32, CZSF_SENSORS_TE1_FLOW_WATER, 251 },
+		{ 32, CZSF_SENSORS_TE2_RETURN_WATER, 227 },
+		{ 32, CZSF_SENSORS_TE3_INDOOR_TEMP, 245 },
+		{ 32, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 332 },
+		{ 32, CZSF_SENSORS_TE5_EXCHANGER_OUT, 220 },
+		{ 32, CZSF_SENSORS_TE6_EVAPORATOR_IN, 178 },
+		{ 32, CZSF_SENSORS_TE7_EXHAUST_AIR, 175 },
+		{ 32, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 455 },
+		{ 33, CZSF_HOUR, 16 },
+		{ 33, CZSF_MINUTE, 0 },
+		{ 33, CZSF_SECOND, 33 },
+		{ 33, CZSF_DAY, 10 },
+		{ 33, CZSF_MONTH, 12 },
+		{ 33, CZSF_YEAR, 2023 },
+		{ 33, CZSF_DAY_OF_WEEK, 7 },
+		{ 33, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 116 },
+		{ 33, CZSF_SENSORS_TE1_FLOW_WATER, 249 },
+		{ 33, CZSF_SENSORS_TE2_RETURN_WATER, 227 },
+		{ 33, CZSF_SENSORS_TE3_INDOOR_TEMP, 245 },
+		{ 33, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 332 },
+		{ 33, CZSF_SENSORS_TE5_EXCHANGER_OUT, 219 },
+		{ 33, CZSF_SENSORS_TE6_EVAPORATOR_IN, 178 },
+		{ 33, CZSF_SENSORS_TE7_EXHAUST_AIR, 175 },
+		{ 33, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 455 },
+		{ 34, CZSF_HOUR, 16 },
+		{ 34, CZSF_MINUTE, 0 },
+		{ 34, CZSF_SECOND, 36 },
+		{ 34, CZSF_DAY, 10 },
+		{ 34, CZSF_MONTH, 12 },
+		{ 34, CZSF_YEAR, 2023 },
+		{ 34, CZSF_DAY_OF_WEEK, 7 },
+		{ 34, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 116 },
+		{ 34, CZSF_SENSORS_TE1_FLOW_WATER, 247 },
+		{ 34, CZSF_SENSORS_TE2_RETURN_WATER, 227 },
+		{ 34, CZSF_SENSORS_TE3_INDOOR_TEMP, 245 },
+		{ 34, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 331 },
+		{ 34, CZSF_SENSORS_TE5_EXCHANGER_OUT, 219 },
+		{ 34, CZSF_SENSORS_TE6_EVAPORATOR_IN, 178 },
+		{ 34, CZSF_SENSORS_TE7_EXHAUST_AIR, 175 },
+		{ 34, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 455 },
+		{ 35, CZSF_HOUR, 16 },
+		{ 35, CZSF_MINUTE, 0 },
+		{ 35, CZSF_SECOND, 38 },
+		{ 35, CZSF_DAY, 10 },
+		{ 35, CZSF_MONTH, 12 },
+		{ 35, CZSF_YEAR, 2023 },
+		{ 35, CZSF_DAY_OF_WEEK, 7 },
+		{ 35, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 116 },
+		{ 35, CZSF_SENSORS_TE1_FLOW_WATER, 247 },
+		{ 35, CZSF_SENSORS_TE2_RETURN_WATER, 227 },
+		{ 35, CZSF_SENSORS_TE3_INDOOR_TEMP, 245 },
+		{ 35, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 331 },
+		{ 35, CZSF_SENSORS_TE5_EXCHANGER_OUT, 219 },
+		{ 35, CZSF_SENSORS_TE6_EVAPORATOR_IN, 178 },
+		{ 35, CZSF_SENSORS_TE7_EXHAUST_AIR, 175 },
+		{ 35, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 455 },
+		{ 36, CZSF_HOUR, 16 },
+		{ 36, CZSF_MINUTE, 0 },
+		{ 36, CZSF_SECOND, 41 },
+		{ 36, CZSF_DAY, 10 },
+		{ 36, CZSF_MONTH, 12 },
+		{ 36, CZSF_YEAR, 2023 },
+		{ 36, CZSF_DAY_OF_WEEK, 7 },
+		{ 36, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 116 },
+		{ 36, CZSF_SENSORS_TE1_FLOW_WATER, 245 },
+		{ 36, CZSF_SENSORS_TE2_RETURN_WATER, 227 },
+		{ 36, CZSF_SENSORS_TE3_INDOOR_TEMP, 244 },
+		{ 36, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 330 },
+		{ 36, CZSF_SENSORS_TE5_EXCHANGER_OUT, 219 },
+		{ 36, CZSF_SENSORS_TE6_EVAPORATOR_IN, 178 },
+		{ 36, CZSF_SENSORS_TE7_EXHAUST_AIR, 175 },
+		{ 36, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 455 },
+		{ 37, CZSF_HOUR, 16 },
+		{ 37, CZSF_MINUTE, 0 },
+		{ 37, CZSF_SECOND, 45 },
+		{ 37, CZSF_DAY, 10 },
+		{ 37, CZSF_MONTH, 12 },
+		{ 37, CZSF_YEAR, 2023 },
+		{ 37, CZSF_DAY_OF_WEEK, 7 },
+		{ 37, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 116 },
+		{ 37, CZSF_SENSORS_TE1_FLOW_WATER, 243 },
+		{ 37, CZSF_SENSORS_TE2_RETURN_WATER, 227 },
+		{ 37, CZSF_SENSORS_TE3_INDOOR_TEMP, 244 },
+		{ 37, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 329 },
+		{ 37, CZSF_SENSORS_TE5_EXCHANGER_OUT, 218 },
+		{ 37, CZSF_SENSORS_TE6_EVAPORATOR_IN, 179 },
+		{ 37, CZSF_SENSORS_TE7_EXHAUST_AIR, 174 },
+		{ 37, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 455 },
+		{ 38, CZSF_HOUR, 16 },
+		{ 38, CZSF_MINUTE, 0 },
+		{ 38, CZSF_SECOND, 46 },
+		{ 38, CZSF_DAY, 10 },
+		{ 38, CZSF_MONTH, 12 },
+		{ 38, CZSF_YEAR, 2023 },
+		{ 38, CZSF_DAY_OF_WEEK, 7 },
+		{ 38, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 116 },
+		{ 38, CZSF_SENSORS_TE1_FLOW_WATER, 243 },
+		{ 38, CZSF_SENSORS_TE2_RETURN_WATER, 227 },
+		{ 38, CZSF_SENSORS_TE3_INDOOR_TEMP, 244 },
+		{ 38, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 329 },
+		{ 38, CZSF_SENSORS_TE5_EXCHANGER_OUT, 218 },
+		{ 38, CZSF_SENSORS_TE6_EVAPORATOR_IN, 179 },
+		{ 38, CZSF_SENSORS_TE7_EXHAUST_AIR, 174 },
+		{ 38, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 455 },
+		{ 39, CZSF_HOUR, 16 },
+		{ 39, CZSF_MINUTE, 0 },
+		{ 39, CZSF_SECOND, 49 },
+		{ 39, CZSF_DAY, 10 },
+		{ 39, CZSF_MONTH, 12 },
+		{ 39, CZSF_YEAR, 2023 },
+		{ 39, CZSF_DAY_OF_WEEK, 7 },
+		{ 39, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 116 },
+		{ 39, CZSF_SENSORS_TE1_FLOW_WATER, 243 },
+		{ 39, CZSF_SENSORS_TE2_RETURN_WATER, 227 },
+		{ 39, CZSF_SENSORS_TE3_INDOOR_TEMP, 244 },
+		{ 39, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 328 },
+		{ 39, CZSF_SENSORS_TE5_EXCHANGER_OUT, 218 },
+		{ 39, CZSF_SENSORS_TE6_EVAPORATOR_IN, 179 },
+		{ 39, CZSF_SENSORS_TE7_EXHAUST_AIR, 174 },
+		{ 39, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 455 },
+		{ 40, CZSF_HOUR, 16 },
+		{ 40, CZSF_MINUTE, 0 },
+		{ 40, CZSF_SECOND, 52 },
+		{ 40, CZSF_DAY, 10 },
+		{ 40, CZSF_MONTH, 12 },
+		{ 40, CZSF_YEAR, 2023 },
+		{ 40, CZSF_DAY_OF_WEEK, 7 },
+		{ 40, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 116 },
+		{ 40, CZSF_SENSORS_TE1_FLOW_WATER, 241 },
+		{ 40, CZSF_SENSORS_TE2_RETURN_WATER, 227 },
+		{ 40, CZSF_SENSORS_TE3_INDOOR_TEMP, 244 },
+		{ 40, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 328 },
+		{ 40, CZSF_SENSORS_TE5_EXCHANGER_OUT, 218 },
+		{ 40, CZSF_SENSORS_TE6_EVAPORATOR_IN, 179 },
+		{ 40, CZSF_SENSORS_TE7_EXHAUST_AIR, 174 },
+		{ 40, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 455 },
+		{ 41, CZSF_FAN_SPEED, 2 },
+		{ 41, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 211 },
+		{ 42, CZSF_FAN_SPEED, 2 },
+		{ 42, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 211 },
+		{ 43, CZSF_FAN_SPEED, 2 },
+		{ 43, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 211 },
+		{ 44, CZSF_FAN_SPEED, 2 },
+		{ 44, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 211 },
+		{ 45, CZSF_FAN_SPEED, 2 },
+		{ 45, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 211 },
+		{ 46, CZSF_FAN_SPEED, 2 },
+		{ 46, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 211 },
+		{ 47, CZSF_FAN_SPEED, 2 },
+		{ 47, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 211 },
+		{ 48, CZSF_FAN_SPEED, 2 },
+		{ 48, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 211 },
+		{ 49, CZSF_FAN_SPEED, 2 },
+		{ 49, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 0 },
+		{ 50, CZSF_FAN_SPEED, 2 },
+		{ 50, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 0 },
+		{ 51, CZSF_FAN_SPEED, 2 },
+		{ 51, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 0 },
+		{ 52, CZSF_FAN_SPEED, 2 },
+		{ 52, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 0 },
+		{ 53, CZSF_FAN_SPEED, 2 },
+		{ 53, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 0 },
+		{ 54, CZSF_FAN_SPEED, 2 },
+		{ 54, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 0 },
+		{ 55, CZSF_FAN_SPEED, 2 },
+		{ 55, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 0 },
+		{ 56, CZSF_FAN_SPEED, 2 },
+		{ 56, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 0 },
+		{ 57, CZSF_FAN_SPEED, 2 },
+		{ 57, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 0 },
+		{ 58, CZSF_FAN_SPEED, 2 },
+		{ 58, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 0 },
+		{ 59, CZSF_FAN_SPEED, 2 },
+		{ 59, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 0 },
+		{ 60, CZSF_FAN_SPEED, 2 },
+		{ 60, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 0 },
+		{ 64, CZSF_HOT_WATER_CALCULATED_SETTING, 440 },
+		{ 65, CZSF_HOT_WATER_CALCULATED_SETTING, 450 },
+		{ 80, CZSF_COMPRESSOR_ENERGY, 1868625 },
+		{ 80, CZSF_ADD_ENERGY, 73008 },
+		{ 80, CZSF_HOT_WATER_ENERGY, 826276 },
+		{ 80, CZSF_COMPRESSOR_RUNTIME, 516150 },
+		{ 80, CZSF_TOTAL_RUNTIME, 1376353 },
+		{ 81, CZSF_COMPRESSOR_ENERGY, 1868626 },
+		{ 81, CZSF_ADD_ENERGY, 73008 },
+		{ 81, CZSF_HOT_WATER_ENERGY, 826276 },
+		{ 81, CZSF_COMPRESSOR_RUNTIME, 516150 },
+		{ 81, CZSF_TOTAL_RUNTIME, 1376353 },
+		{ 82, CZSF_COMPRESSOR_ENERGY, 1868626 },
+		{ 82, CZSF_ADD_ENERGY, 73008 },
+		{ 82, CZSF_HOT_WATER_ENERGY, 826277 },
+		{ 82, CZSF_COMPRESSOR_RUNTIME, 516150 },
+		{ 82, CZSF_TOTAL_RUNTIME, 1376353 },
+		{ 83, CZSF_COMPRESSOR_ENERGY, 1868627 },
+		{ 83, CZSF_ADD_ENERGY, 73008 },
+		{ 83, CZSF_HOT_WATER_ENERGY, 826277 },
+		{ 83, CZSF_COMPRESSOR_RUNTIME, 516151 },
+		{ 83, CZSF_TOTAL_RUNTIME, 1376354 },
+		{ 84, CZSF_COMPRESSOR_ENERGY, 1868627 },
+		{ 84, CZSF_ADD_ENERGY, 73008 },
+		{ 84, CZSF_HOT_WATER_ENERGY, 826278 },
+		{ 84, CZSF_COMPRESSOR_RUNTIME, 516151 },
+		{ 84, CZSF_TOTAL_RUNTIME, 1376354 },
+		{ 85, CZSF_COMPRESSOR_ENERGY, 1868714 },
+		{ 85, CZSF_ADD_ENERGY, 73008 },
+		{ 85, CZSF_HOT_WATER_ENERGY, 826365 },
+		{ 85, CZSF_COMPRESSOR_RUNTIME, 516181 },
+		{ 85, CZSF_TOTAL_RUNTIME, 1376389 },
+		{ 86, CZSF_COMPRESSOR_ENERGY, 1868714 },
+		{ 86, CZSF_ADD_ENERGY, 73008 },
+		{ 86, CZSF_HOT_WATER_ENERGY, 826365 },
+		{ 86, CZSF_COMPRESSOR_RUNTIME, 516181 },
+		{ 86, CZSF_TOTAL_RUNTIME, 1376390 },
+		{ 91, CZSF_FAN_TIME_TO_FILTER_CHANGE, 37 },
+		{ 92, CZSF_FAN_TIME_TO_FILTER_CHANGE, 39 },
+		{ 93, CZSF_FAN_TIME_TO_FILTER_CHANGE, 41 },
+		{ 142, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0 },
+		{ 142, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 142, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0 },
+		{ 142, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0 },
+		{ 142, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 143, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0 },
+		{ 143, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 143, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0 },
+		{ 143, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0 },
+		{ 143, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 144, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0 },
+		{ 144, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 144, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0 },
+		{ 144, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0 },
+		{ 144, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 145, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0 },
+		{ 145, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 145, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0 },
+		{ 145, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0 },
+		{ 145, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 146, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0 },
+		{ 146, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 146, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0 },
+		{ 146, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0 },
+		{ 146, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 147, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0 },
+		{ 147, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 147, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0 },
+		{ 147, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0 },
+		{ 147, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 148, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0 },
+		{ 148, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 148, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0 },
+		{ 148, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0 },
+		{ 148, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 149, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0 },
+		{ 149, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 149, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0 },
+		{ 149, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0 },
+		{ 149, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 150, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0 },
+		{ 150, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 150, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0 },
+		{ 150, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0 },
+		{ 150, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 151, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0 },
+		{ 151, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 151, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0 },
+		{ 151, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0 },
+		{ 151, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 152, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0 },
+		{ 152, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 152, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0 },
+		{ 152, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0 },
+		{ 152, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 153, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0 },
+		{ 153, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 153, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0 },
+		{ 153, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0 },
+		{ 153, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 154, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0 },
+		{ 154, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 154, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0 },
+		{ 154, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0 },
+		{ 154, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 155, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0 },
+		{ 155, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 155, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0 },
+		{ 155, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0 },
+		{ 155, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 156, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0 },
+		{ 156, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 156, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0 },
+		{ 156, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0 },
+		{ 156, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 157, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0 },
+		{ 157, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 157, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0 },
+		{ 157, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0 },
+		{ 157, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 158, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0 },
+		{ 158, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 158, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0 },
+		{ 158, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0 },
+		{ 158, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 159, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0 },
+		{ 159, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 159, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0 },
+		{ 159, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0 },
+		{ 159, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 160, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0 },
+		{ 160, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 160, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0 },
+		{ 160, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0 },
+		{ 160, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 161, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0 },
+		{ 161, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 161, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0 },
+		{ 161, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0 },
+		{ 161, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 162, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 1646 },
+		{ 162, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 162, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 1646 },
+		{ 162, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 853 },
+		{ 162, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 163, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 1646 },
+		{ 163, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 163, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 1646 },
+		{ 163, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 854 },
+		{ 163, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 164, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 1646 },
+		{ 164, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 164, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 1646 },
+		{ 164, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 854 },
+		{ 164, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 165, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 1646 },
+		{ 165, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 165, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 1646 },
+		{ 165, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 854 },
+		{ 165, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 166, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 1646 },
+		{ 166, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 166, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 1646 },
+		{ 166, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 854 },
+		{ 166, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 167, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 1646 },
+		{ 167, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 167, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 1646 },
+		{ 167, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 854 },
+		{ 167, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 168, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 1646 },
+		{ 168, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 168, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 1646 },
+		{ 168, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 854 },
+		{ 168, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 169, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 1646 },
+		{ 169, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 169, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 1646 },
+		{ 169, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 854 },
+		{ 169, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 170, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 1646 },
+		{ 170, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 170, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 1646 },
+		{ 170, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 854 },
+		{ 170, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 171, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 1646 },
+		{ 171, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 171, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 1646 },
+		{ 171, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 854 },
+		{ 171, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 172, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 1646 },
+		{ 172, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 172, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 1646 },
+		{ 172, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 854 },
+		{ 172, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 173, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 1646 },
+		{ 173, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 173, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 1646 },
+		{ 173, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 854 },
+		{ 173, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 174, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 1646 },
+		{ 174, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 174, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 1646 },
+		{ 174, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 854 },
+		{ 174, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 175, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 1646 },
+		{ 175, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 175, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 1646 },
+		{ 175, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 854 },
+		{ 175, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 176, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 1646 },
+		{ 176, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 176, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 1646 },
+		{ 176, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 854 },
+		{ 176, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 177, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 1646 },
+		{ 177, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 177, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 1646 },
+		{ 177, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 854 },
+		{ 177, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 178, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 1646 },
+		{ 178, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 178, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 1646 },
+		{ 178, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 854 },
+		{ 178, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+		{ 179, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 1646 },
+		{ 179, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0 },
+		{ 179, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 1646 },
+		{ 179, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 856 },
+		{ 179, CZSF_ADDITIONAL_POWER_ENABLED, 0 },
+	};
+
+static const COMFORTZONE_CORPUS comfortzone_corpus =
+	{
+		HP_PROTOCOL_2_21,
+		comfortzone_corpus_frames, sizeof(comfortzone_corpus_frames), 215,
+		comfortzone_corpus_frame_types,
+		comfortzone_corpus_values, sizeof(comfortzone_corpus_values) / sizeof(comfortzone_corpus_values[0])
+	};
+#endif
+
+#if HP_PROTOCOL == HP_PROTOCOL_1_6
+static const COMFORTZONE_CORPUS comfortzone_corpus = { HP_PROTOCOL_1_6, NULL, 0, 0, NULL, NULL, 0 };
+#endif
+
+#endif
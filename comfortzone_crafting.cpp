@@ -11,7 +11,7 @@
 //		  9 byte array contaning register number
 //		 16bit value (it will be automatically stored into little endian)
 //		  1 CRC byte
-void czcraft::craft_w_cmd(comfortzone_heatpump *czhp, W_CMD *q, byte *reg_num, uint16_t value)
+void czcraft::craft_w_cmd(comfortzone_heatpump *czhp, W_CMD *q, const byte *reg_num, uint16_t value)
 {
 	byte comp1_dest[4];
 
@@ -41,7 +41,7 @@ void czcraft::craft_w_cmd(comfortzone_heatpump *czhp, W_CMD *q, byte *reg_num, u
 //		  9 byte array contaning register number
 //		  8bit value
 //		  1 CRC byte
-void czcraft::craft_w_small_cmd(comfortzone_heatpump *czhp, W_SMALL_CMD *q, byte *reg_num, byte value)
+void czcraft::craft_w_small_cmd(comfortzone_heatpump *czhp, W_SMALL_CMD *q, const byte *reg_num, byte value)
 {
 	byte comp1_dest[4];
 
@@ -71,7 +71,7 @@ void czcraft::craft_w_small_cmd(comfortzone_heatpump *czhp, W_SMALL_CMD *q, byte
 // input: pointer to output buffer
 //		9 byte array contaning register number
 //		expected 8bit value
-void czcraft::craft_w_reply(comfortzone_heatpump *czhp, W_REPLY *q, byte *reg_num, byte value)
+void czcraft::craft_w_reply(comfortzone_heatpump *czhp, W_REPLY *q, const byte *reg_num, byte value)
 {
 	byte comp1_dest[4];
 
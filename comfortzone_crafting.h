@@ -35,25 +35,27 @@ class czcraft
 		KR_TEMP_OFFSET_SENSOR7,	// set sensor 7 temperature offset, parameter => -100 (=-10°) to 100 (=10.0°)
 		KR_FIREPLACE_MODE_ENABLE, // enable temporary mode to start the fireplace (disables fan for 5 minutes, runs completely on electricity during that period)
 		KR_FIREPLACE_MODE_DISABLE, // disable temporary fireplace mode (shouldn't be needed normally as it is called automatically by heatpump after 5 minutes)
+
+		KR_NB_CRAFT_NAMES,		// number of craft names, must be the last one
 	} KNOWN_REGISTER_CRAFT_NAME;
 
 	// craft a W_CMD packet
 	// input: pointer to output buffer
 	//		  9 byte array contaning register number
 	//		 16bit value (it will be automatically stored into little endian)
-	static void craft_w_cmd(comfortzone_heatpump *czhp, W_CMD *output_buffer, byte *reg_num, uint16_t value);
+	static void craft_w_cmd(comfortzone_heatpump *czhp, W_CMD *output_buffer, const byte *reg_num, uint16_t value);
 
 	// craft a W_SMALL_CMD packet
 	// input: pointer to output buffer
 	//		  9 byte array contaning register number
 	//		  8bit value
-	static void craft_w_small_cmd(comfortzone_heatpump *czhp, W_SMALL_CMD *output_buffer, byte *reg_num, byte value);
+	static void craft_w_small_cmd(comfortzone_heatpump *czhp, W_SMALL_CMD *output_buffer, const byte *reg_num, byte value);
 
 	// craft a W_REPLY packet
 	// input: pointer to output buffer
 	//		  9 byte array contaning register number
 	//		  expected 8bit value
-	static void craft_w_reply(comfortzone_heatpump *czhp, W_REPLY *output_buffer, byte *reg_num, byte value);
+	static void craft_w_reply(comfortzone_heatpump *czhp, W_REPLY *output_buffer, const byte *reg_num, byte value);
 };
 
 
@@ -3,88 +3,95 @@
 
 #include "comfortzone_frame.h"
 #include "comfortzone_decoder.h"
+#include "comfortzone_tools.h"
+#include "comfortzone_frame_layout.h"
 
 #include "string.h"
 
-static czdec::KNOWN_REGISTER kr_decoder[] =
+// kr_decoder_vXXX[] are the reference tables of each protocol version, they are stored in read-only memory.
+// Dispatch tables below are generated from them at compile time.
+#if HP_WITH_PROTOCOL(HP_PROTOCOL_1_6)
+static constexpr czdec::KNOWN_REGISTER kr_decoder_v160[] =
 	{
-#if HP_PROTOCOL == HP_PROTOCOL_1_6
 		// don't know why but extra hot water off does not use the same message as extra hot water on
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x41, 0x19, 0x00}, czcraft::KR_EXTRA_HOT_WATER_OFF, "Extra hot water - off", czdec::cmd_r_generic, czdec::cmd_w_extra_hot_water, czdec::reply_r_extra_hot_water, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x81, 0x19, 0x00}, czcraft::KR_EXTRA_HOT_WATER_ON, "Extra hot water - on", czdec::cmd_r_generic, czdec::cmd_w_extra_hot_water, czdec::reply_r_extra_hot_water, czdec::reply_w_generic},
-
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x81, 0x29, 0x00}, czcraft::KR_UNCRAFTABLE, "Clear alarm", czdec::cmd_r_generic, czdec::cmd_w_clr_alarm, czdec::reply_r_clr_alarm, czdec::reply_w_generic},
-
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x40, 0x00, 0x00}, czcraft::KR_AUTO_DAYLIGHT_SAVING_OFF, "Daylight saving - off", czdec::cmd_r_generic, czdec::cmd_w_daylight_saving, czdec::reply_r_daylight_saving, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x80, 0x00, 0x00}, czcraft::KR_AUTO_DAYLIGHT_SAVING_ON, "Daylight saving - on", czdec::cmd_r_generic, czdec::cmd_w_daylight_saving, czdec::reply_r_daylight_saving, czdec::reply_w_generic},
-
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x80, 0x0E, 0x00}, czcraft::KR_UNCRAFTABLE, "Sanitary priority (set)", czdec::empty, czdec::empty, czdec::empty, czdec::reply_w_generic},	// this frame itself is not enough to set priority
-
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x00, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 09", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_09, czdec::reply_w_generic},	// 0xC2 bytes
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x00, 0x04}, czcraft::KR_FAN_SPEED, "Fan speed", czdec::cmd_r_generic, czdec::cmd_w_fan_speed, czdec::reply_r_fan_speed, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x05, 0x04}, czcraft::KR_UNCRAFTABLE, "Fan boost increase", czdec::cmd_r_generic, czdec::cmd_w_percentage, czdec::reply_r_percentage, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x0E, 0x00}, czcraft::KR_UNCRAFTABLE, "Sanitary priority (get)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_sanitary_priority, czdec::empty},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x16, 0x02}, czcraft::KR_UNCRAFTABLE, "Status 11", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_11, czdec::reply_w_generic},	// 0xC2 bytes
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x17, 0x04}, czcraft::KR_UNCRAFTABLE, "Supply fan T12 adjust", czdec::cmd_r_generic, czdec::cmd_w_percentage, czdec::reply_r_percentage, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x19, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 24", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_24, czdec::reply_w_generic},	// 0xC2 bytes
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x2E, 0x03}, czcraft::KR_UNCRAFTABLE, "Minimal return temperature", czdec::cmd_r_generic, czdec::cmd_w_temp, czdec::reply_r_temp, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x29, 0x04}, czcraft::KR_UNCRAFTABLE, "Room Heating - compressor max frequency", czdec::cmd_r_generic, czdec::cmd_w_freq, czdec::reply_r_freq, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x2C, 0x04}, czcraft::KR_UNCRAFTABLE, "Status 12", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_12, czdec::reply_w_generic},	// 0xC2 bytes
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x35, 0x04}, czcraft::KR_UNCRAFTABLE, "Heatpump - compressor - blocked frequency 1", czdec::cmd_r_generic, czdec::cmd_w_freq, czdec::reply_r_freq, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x37, 0x04}, czcraft::KR_UNCRAFTABLE, "Heatpump - compressor - blocked frequency 2", czdec::cmd_r_generic, czdec::cmd_w_freq, czdec::reply_r_freq, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x39, 0x04}, czcraft::KR_UNCRAFTABLE, "Heatpump - compressor - blocked frequency 3", czdec::cmd_r_generic, czdec::cmd_w_freq, czdec::reply_r_freq, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x64, 0x01}, czcraft::KR_UNCRAFTABLE, "Status 25", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_25, czdec::reply_w_generic},	// 0xC2 bytes
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x7A, 0x03}, czcraft::KR_UNCRAFTABLE, "Status 01", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_01, czdec::reply_w_generic},	// 0xC2 bytes
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x7B, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR0, "Hardware Settings - Adjustments - TE0 Adjust", czdec::cmd_r_generic, czdec::cmd_w_temp_1byte, czdec::reply_r_temp_1byte, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x7C, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR1, "Hardware Settings - Adjustments - TE1 Adjust", czdec::cmd_r_generic, czdec::cmd_w_temp_1byte, czdec::reply_r_temp_1byte, czdec::reply_w_generic},	// not tested
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x7D, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR2, "Hardware Settings - Adjustments - TE2 Adjust", czdec::cmd_r_generic, czdec::cmd_w_temp_1byte, czdec::reply_r_temp_1byte, czdec::reply_w_generic},	// not tested
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x7D, 0x03}, czcraft::KR_HOT_WATER_TEMP, "Hot water calculated setting", czdec::cmd_r_generic, czdec::cmd_w_temp, czdec::reply_r_temp, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x7E, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR3, "Hardware Settings - Adjustments - TE3 Adjust", czdec::cmd_r_generic, czdec::cmd_w_temp_1byte, czdec::reply_r_temp_1byte, czdec::reply_w_generic},	// not tested
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x7F, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR4, "Hardware Settings - Adjustments - TE4 Adjust", czdec::cmd_r_generic, czdec::cmd_w_temp_1byte, czdec::reply_r_temp_1byte, czdec::reply_w_generic},	// not tested
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x80, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR5, "Hardware Settings - Adjustments - TE5 Adjust", czdec::cmd_r_generic, czdec::cmd_w_temp_1byte, czdec::reply_r_temp_1byte, czdec::reply_w_generic},	// not tested
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x81, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR6, "Hardware Settings - Adjustments - TE6 Adjust", czdec::cmd_r_generic, czdec::cmd_w_temp_1byte, czdec::reply_r_temp_1byte, czdec::reply_w_generic},	// not tested
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x82, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR7, "Hardware Settings - Adjustments - TE7 Adjust", czdec::cmd_r_generic, czdec::cmd_w_temp_1byte, czdec::reply_r_temp_1byte, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0xA6, 0x04}, czcraft::KR_UNCRAFTABLE, "Heatpump - defrost delay", czdec::cmd_r_generic, czdec::cmd_w_time, czdec::reply_r_time, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0xA7, 0x02}, czcraft::KR_LED_LUMINOSITY, "LED luminosity", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0xAC, 0x02}, czcraft::KR_UNCRAFTABLE, "Holiday reduction", czdec::cmd_r_generic, czdec::cmd_w_day_delay, czdec::reply_r_day_delay, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0xC8, 0x02}, czcraft::KR_UNCRAFTABLE, "Status 10", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_10, czdec::reply_w_generic},	// 0xC2 bytes
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0xB0, 0x02}, czcraft::KR_ROOM_HEATING_TEMP, "Heating calculated setting", czdec::cmd_r_generic, czdec::cmd_w_temp, czdec::reply_r_temp, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0xB2, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 23", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_23, czdec::reply_w_generic},	// 0xC2 bytes
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0xDE, 0x04}, czcraft::KR_UNCRAFTABLE, "Status 13", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_13, czdec::reply_w_generic},	// 0x63 bytes
-
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0x00, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 02", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_02, czdec::reply_w_generic},	// 0xC2 bytes
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0x04, 0x00}, czcraft::KR_HOUR, "Hour", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0x05, 0x00}, czcraft::KR_MINUTE, "Minute", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0x07, 0x00}, czcraft::KR_DAY, "Day of Month", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0x08, 0x00}, czcraft::KR_MONTH, "Month (1=Jan)", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0x09, 0x00}, czcraft::KR_YEAR, "Year (20xx)", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0x16, 0x02}, czcraft::KR_UNCRAFTABLE, "Status 05", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_05, czdec::reply_w_generic},	// 0xC2 bytes
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0x19, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 22", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_22, czdec::reply_w_generic},	// 0xC2 bytes
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0x2C, 0x04}, czcraft::KR_UNCRAFTABLE, "Status 14", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_14, czdec::reply_w_generic},	// 0x48 bytes
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0x58, 0x04}, czcraft::KR_UNCRAFTABLE, "Language", czdec::cmd_r_generic, czdec::cmd_w_language, czdec::reply_r_language, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0x64, 0x01}, czcraft::KR_UNCRAFTABLE, "Status 04", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_04, czdec::reply_w_generic},	// 0xC2 bytes
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0x7A, 0x03}, czcraft::KR_UNCRAFTABLE, "Status 07", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_07, czdec::reply_w_generic},	// 0xC2 bytes
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0xB2, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 03", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_03, czdec::reply_w_generic},	// 0xC2 bytes
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0xC8, 0x02}, czcraft::KR_UNCRAFTABLE, "Status 06", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_06, czdec::reply_w_generic},	// 0xC2 bytes
-
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x03, 0x15, 0x0D}, czcraft::KR_UNCRAFTABLE, "Status 15", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_15, czdec::reply_w_generic},	// 0xC2 bytes
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x03, 0x2B, 0x0F}, czcraft::KR_UNCRAFTABLE, "Status 18", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_18, czdec::reply_w_generic},	// 0x5D bytes
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x03, 0x79, 0x0E}, czcraft::KR_UNCRAFTABLE, "Status 17", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_17, czdec::reply_w_generic},	// 0xC2 bytes
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x03, 0xC7, 0x0D}, czcraft::KR_UNCRAFTABLE, "Status 16", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_16, czdec::reply_w_generic},	// 0xC2 bytes
-
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x04, 0x4E, 0x3F}, czcraft::KR_UNCRAFTABLE, "Status 20", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_20, czdec::reply_w_generic},	// 0x26 bytes
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x04, 0x9C, 0x3E}, czcraft::KR_UNCRAFTABLE, "Status 19", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_19, czdec::reply_w_generic},	// 0xC2 bytes
-
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x05, 0x00, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 08", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_08, czdec::reply_w_generic},	// 0x50 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x41, 0x19, 0x00}, czcraft::KR_EXTRA_HOT_WATER_OFF, "Extra hot water - off", czdec::cmd_r_generic, czdec::cmd_w_extra_hot_water, czdec::reply_r_extra_hot_water, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x81, 0x19, 0x00}, czcraft::KR_EXTRA_HOT_WATER_ON, "Extra hot water - on", czdec::cmd_r_generic, czdec::cmd_w_extra_hot_water, czdec::reply_r_extra_hot_water, czdec::reply_w_generic, 0},
+
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x81, 0x29, 0x00}, czcraft::KR_UNCRAFTABLE, "Clear alarm", czdec::cmd_r_generic, czdec::cmd_w_clr_alarm, czdec::reply_r_clr_alarm, czdec::reply_w_generic, 0},
+
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x40, 0x00, 0x00}, czcraft::KR_AUTO_DAYLIGHT_SAVING_OFF, "Daylight saving - off", czdec::cmd_r_generic, czdec::cmd_w_daylight_saving, czdec::reply_r_daylight_saving, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x80, 0x00, 0x00}, czcraft::KR_AUTO_DAYLIGHT_SAVING_ON, "Daylight saving - on", czdec::cmd_r_generic, czdec::cmd_w_daylight_saving, czdec::reply_r_daylight_saving, czdec::reply_w_generic, 0},
+
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x80, 0x0E, 0x00}, czcraft::KR_UNCRAFTABLE, "Sanitary priority (set)", czdec::empty, czdec::empty, czdec::empty, czdec::reply_w_generic, 0},	// this frame itself is not enough to set priority
+
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x00, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 09", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_09, czdec::reply_w_generic, 0},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x00, 0x04}, czcraft::KR_FAN_SPEED, "Fan speed", czdec::cmd_r_generic, czdec::cmd_w_fan_speed, czdec::reply_r_fan_speed, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x05, 0x04}, czcraft::KR_UNCRAFTABLE, "Fan boost increase", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_PERCENTAGE>, czdec::reply_r_scalar<CZ_SCALAR_PERCENTAGE>, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x0E, 0x00}, czcraft::KR_UNCRAFTABLE, "Sanitary priority (get)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_sanitary_priority, czdec::empty, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x16, 0x02}, czcraft::KR_UNCRAFTABLE, "Status 11", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_11, czdec::reply_w_generic, 0},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x17, 0x04}, czcraft::KR_UNCRAFTABLE, "Supply fan T12 adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_PERCENTAGE>, czdec::reply_r_scalar<CZ_SCALAR_PERCENTAGE>, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x19, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 24", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_24, czdec::reply_w_generic, 0},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x2E, 0x03}, czcraft::KR_UNCRAFTABLE, "Minimal return temperature", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP>, czdec::reply_r_scalar<CZ_SCALAR_TEMP>, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x29, 0x04}, czcraft::KR_UNCRAFTABLE, "Room Heating - compressor max frequency", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_FREQ>, czdec::reply_r_scalar<CZ_SCALAR_FREQ>, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x2C, 0x04}, czcraft::KR_UNCRAFTABLE, "Status 12", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_12, czdec::reply_w_generic, 0},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x35, 0x04}, czcraft::KR_UNCRAFTABLE, "Heatpump - compressor - blocked frequency 1", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_FREQ>, czdec::reply_r_scalar<CZ_SCALAR_FREQ>, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x37, 0x04}, czcraft::KR_UNCRAFTABLE, "Heatpump - compressor - blocked frequency 2", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_FREQ>, czdec::reply_r_scalar<CZ_SCALAR_FREQ>, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x39, 0x04}, czcraft::KR_UNCRAFTABLE, "Heatpump - compressor - blocked frequency 3", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_FREQ>, czdec::reply_r_scalar<CZ_SCALAR_FREQ>, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x64, 0x01}, czcraft::KR_UNCRAFTABLE, "Status 25", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_25, czdec::reply_w_generic, 0},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x7A, 0x03}, czcraft::KR_UNCRAFTABLE, "Status 01", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_01, czdec::reply_w_generic, 0},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x7B, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR0, "Hardware Settings - Adjustments - TE0 Adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_r_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x7C, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR1, "Hardware Settings - Adjustments - TE1 Adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_r_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_w_generic, 0},	// not tested
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x7D, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR2, "Hardware Settings - Adjustments - TE2 Adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_r_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_w_generic, 0},	// not tested
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x7D, 0x03}, czcraft::KR_HOT_WATER_TEMP, "Hot water calculated setting", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP>, czdec::reply_r_scalar<CZ_SCALAR_TEMP>, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x7E, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR3, "Hardware Settings - Adjustments - TE3 Adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_r_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_w_generic, 0},	// not tested
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x7F, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR4, "Hardware Settings - Adjustments - TE4 Adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_r_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_w_generic, 0},	// not tested
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x80, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR5, "Hardware Settings - Adjustments - TE5 Adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_r_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_w_generic, 0},	// not tested
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x81, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR6, "Hardware Settings - Adjustments - TE6 Adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_r_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_w_generic, 0},	// not tested
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0x82, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR7, "Hardware Settings - Adjustments - TE7 Adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_r_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0xA6, 0x04}, czcraft::KR_UNCRAFTABLE, "Heatpump - defrost delay", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TIME>, czdec::reply_r_scalar<CZ_SCALAR_TIME>, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0xA7, 0x02}, czcraft::KR_LED_LUMINOSITY, "LED luminosity", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0xAC, 0x02}, czcraft::KR_UNCRAFTABLE, "Holiday reduction", czdec::cmd_r_generic, czdec::cmd_w_day_delay, czdec::reply_r_day_delay, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0xC8, 0x02}, czcraft::KR_UNCRAFTABLE, "Status 10", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_10, czdec::reply_w_generic, 0},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0xB0, 0x02}, czcraft::KR_ROOM_HEATING_TEMP, "Heating calculated setting", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP>, czdec::reply_r_scalar<CZ_SCALAR_TEMP>, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0xB2, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 23", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_23, czdec::reply_w_generic, 0},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x00, 0xDE, 0x04}, czcraft::KR_UNCRAFTABLE, "Status 13", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_13, czdec::reply_w_generic, 0},	// 0x63 bytes
+
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0x00, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 02", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_02, czdec::reply_w_generic, 0},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0x04, 0x00}, czcraft::KR_HOUR, "Hour", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0x05, 0x00}, czcraft::KR_MINUTE, "Minute", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0x07, 0x00}, czcraft::KR_DAY, "Day of Month", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0x08, 0x00}, czcraft::KR_MONTH, "Month (1=Jan)", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0x09, 0x00}, czcraft::KR_YEAR, "Year (20xx)", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0x16, 0x02}, czcraft::KR_UNCRAFTABLE, "Status 05", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_05, czdec::reply_w_generic, 0},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0x19, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 22", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_22, czdec::reply_w_generic, 0},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0x2C, 0x04}, czcraft::KR_UNCRAFTABLE, "Status 14", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_14, czdec::reply_w_generic, 0},	// 0x48 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0x58, 0x04}, czcraft::KR_UNCRAFTABLE, "Language", czdec::cmd_r_generic, czdec::cmd_w_language, czdec::reply_r_language, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0x64, 0x01}, czcraft::KR_UNCRAFTABLE, "Status 04", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_04, czdec::reply_w_generic, 0},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0x7A, 0x03}, czcraft::KR_UNCRAFTABLE, "Status 07", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_07, czdec::reply_w_generic, 0},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0xB2, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 03", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_03, czdec::reply_w_generic, 0},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x01, 0xC8, 0x02}, czcraft::KR_UNCRAFTABLE, "Status 06", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_06, czdec::reply_w_generic, 0},	// 0xC2 bytes
+
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x03, 0x15, 0x0D}, czcraft::KR_UNCRAFTABLE, "Status 15", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_15, czdec::reply_w_generic, 0},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x03, 0x2B, 0x0F}, czcraft::KR_UNCRAFTABLE, "Status 18", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_18, czdec::reply_w_generic, 0},	// 0x5D bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x03, 0x79, 0x0E}, czcraft::KR_UNCRAFTABLE, "Status 17", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_17, czdec::reply_w_generic, 0},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x03, 0xC7, 0x0D}, czcraft::KR_UNCRAFTABLE, "Status 16", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_16, czdec::reply_w_generic, 0},	// 0xC2 bytes
+
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x04, 0x4E, 0x3F}, czcraft::KR_UNCRAFTABLE, "Status 20", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_20, czdec::reply_w_generic, 0},	// 0x26 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x04, 0x9C, 0x3E}, czcraft::KR_UNCRAFTABLE, "Status 19", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_19, czdec::reply_w_generic, 0},	// 0xC2 bytes
+
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x07, 0x05, 0x00, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 08", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_08, czdec::reply_w_generic, 0},	// 0x50 bytes
 
+	};
 #endif
 
-#if HP_PROTOCOL == HP_PROTOCOL_1_7
+#if HP_WITH_PROTOCOL(HP_PROTOCOL_1_7)
+static constexpr czdec::KNOWN_REGISTER kr_decoder_v170[] =
+	{
 		// don't know why but extra hot water off does not use the same message as extra hot water on
 		// 656fde02d35e414444521857010203040b08411700feffa1
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x41, 0x17, 0x00}, czcraft::KR_EXTRA_HOT_WATER_OFF, "Extra hot water - off", czdec::cmd_r_generic, czdec::cmd_w_extra_hot_water, czdec::reply_r_extra_hot_water, czdec::reply_w_generic},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x41, 0x17, 0x00}, czcraft::KR_EXTRA_HOT_WATER_OFF, "Extra hot water - off", czdec::cmd_r_generic, czdec::cmd_w_extra_hot_water, czdec::reply_r_extra_hot_water, czdec::reply_w_generic, 0},
 		// 656fde02d35e414444521857010203040b08811700010037
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x81, 0x17, 0x00}, czcraft::KR_EXTRA_HOT_WATER_ON, "Extra hot water - on", czdec::cmd_r_generic, czdec::cmd_w_extra_hot_water, czdec::reply_r_extra_hot_water, czdec::reply_w_generic},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x81, 0x17, 0x00}, czcraft::KR_EXTRA_HOT_WATER_ON, "Extra hot water - on", czdec::cmd_r_generic, czdec::cmd_w_extra_hot_water, czdec::reply_r_extra_hot_water, czdec::reply_w_generic, 0},
 
 		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x81, 0x29, 0x00}, czcraft::KR_UNCRAFTABLE, "Clear alarm", czdec::cmd_r_generic, czdec::cmd_w_clr_alarm, czdec::reply_r_clr_alarm, czdec::reply_w_generic},
 
@@ -98,51 +105,51 @@ static czdec::KNOWN_REGISTER kr_decoder[] =
 		//Data: 656fde02d35e414444521757010203040b0800fa030291
     	//Data: 656fde02d35e414444521757010203040b0800fa0303cf
    	 	//Data: 656fde02d35e414444521757010203040b0800fa030173
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0xFA, 0x03}, czcraft::KR_FAN_SPEED, "Fan speed", czdec::cmd_r_generic, czdec::cmd_w_fan_speed, czdec::reply_r_fan_speed, czdec::reply_w_generic},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0xFA, 0x03}, czcraft::KR_FAN_SPEED, "Fan speed", czdec::cmd_r_generic, czdec::cmd_w_fan_speed, czdec::reply_r_fan_speed, czdec::reply_w_generic, 0},
 		// Extra short/unknown registers observed in data dumps — log raw payload for analysis
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x9E, 0x04}, czcraft::KR_UNCRAFTABLE, "Status (00 9E 04)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_log_raw, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x01, 0x45, 0x01}, czcraft::KR_UNCRAFTABLE, "Event (01 45 01)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_log_raw, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x05, 0x2C, 0x00}, czcraft::KR_UNCRAFTABLE, "Status (05 2C 00)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_log_raw, czdec::reply_w_generic},
-		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x05, 0x04}, czcraft::KR_UNCRAFTABLE, "Fan boost increase", czdec::cmd_r_generic, czdec::cmd_w_percentage, czdec::reply_r_percentage, czdec::reply_w_generic},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x9E, 0x04}, czcraft::KR_UNCRAFTABLE, "Status (00 9E 04)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_log_raw, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x01, 0x45, 0x01}, czcraft::KR_UNCRAFTABLE, "Event (01 45 01)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_log_raw, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x05, 0x2C, 0x00}, czcraft::KR_UNCRAFTABLE, "Status (05 2C 00)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_log_raw, czdec::reply_w_generic, 0},
+		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x05, 0x04}, czcraft::KR_UNCRAFTABLE, "Fan boost increase", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_PERCENTAGE>, czdec::reply_r_scalar<CZ_SCALAR_PERCENTAGE>, czdec::reply_w_generic},
 		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x0E, 0x00}, czcraft::KR_UNCRAFTABLE, "Sanitary priority (get)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_sanitary_priority, czdec::empty},
 		
 		//Status 11 LED luminosity, holiday reduction
 		//41  44  44  52  07  8a  65  6f  de  02  c8  72  01  02  03  04  0b  08    00  14  02    05  05  05  05  05  05  05  05  05  05  05  05  2e  2e  2e  2e  2e  2e  2e  2e  2e  2e  2e  2e  2e  2e  2e  2e  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  05  05  05  05  0f  0f  05  05  05  05  05  05  00  00  1e  14  a0  0a  0e  01  00  2c  01  14  2c  01  14  05  0f  00  00  0a  00  3c  00  e8  03  0a  00  3c  00  00  00  0a  00  3c  00  e8  03  0a  00  3c  00  00  00  01  01  03  01  04  03  01  00  00  00  01  00  01  00  01  00  b4  00  14  00  0a  00  0a  00  0a  00  02  06  00  00  ff  00  00  ff  06  fe  00  14  00  32  00  ce  ff  00  00  07  00  00  00  0e  01  3d  01  69  01  92  01  b9  01  df  01  1e  00  28  00  1e  00  23
 		//65  68  68  82  07  138 101 111 222 02  200 114 01  02  03  04  11  08    00  20  02    05  05  05  05  05  05  05  05  05  05  05  05  46  46  46  46  46  46  46  46  46  46  46  46  46  46  46  46  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  00  05  05  05  05  15  15  05  05  05  05  05  05  00  00  30  20  160 10  14  01  00  44  01  20  44  01  20  05  15  00  00  10  00  60  00  232 03  10  00  60  00  00  00  10  00  60  00  232 03  10  00  60  00  00  00  01  01  03  01  04  03  01  00  00  00  01  00  01  00  01  00  180 00  20  00  10  00  10  00  10  00  02  06  00  00  255 00  00  255 06  254 00  20  00  50  00  206 255 00  00  07  00  00  00  14  01  61  01  105 01  146 01  185 01  223 01  30  00  40  00  30  00  35
 		//A   D   D   R   .   .   e   o   .   .   .   r   .   .   .   .   .   .     .   .   .     .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   ,   .   .   ,   .   .   .   .   .   .   .   .   <   .   .   .   .   .   <   .   .   .   .   .   <   .   .   .   .   .   <   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   2   .   .   .   .   .   .   .   .   .   .   .   =   .   i   .   .   .   .   .   .   .   .   .   (   .   .   .   #
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x16, 0x02}, czcraft::KR_UNCRAFTABLE, "Status 11", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_11, czdec::reply_w_generic},	// 0xC2 bytes
-		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x17, 0x04}, czcraft::KR_UNCRAFTABLE, "Supply fan T12 adjust", czdec::cmd_r_generic, czdec::cmd_w_percentage, czdec::reply_r_percentage, czdec::reply_w_generic},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x16, 0x02}, czcraft::KR_UNCRAFTABLE, "Status 11", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_11, czdec::reply_w_generic, 0},	// 0xC2 bytes
+		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x17, 0x04}, czcraft::KR_UNCRAFTABLE, "Supply fan T12 adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_PERCENTAGE>, czdec::reply_r_scalar<CZ_SCALAR_PERCENTAGE>, czdec::reply_w_generic},
 		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x19, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 24", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_24, czdec::reply_w_generic},	// 0xC2 bytes
-		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x2E, 0x03}, czcraft::KR_UNCRAFTABLE, "Minimal return temperature", czdec::cmd_r_generic, czdec::cmd_w_temp, czdec::reply_r_temp, czdec::reply_w_generic},
+		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x2E, 0x03}, czcraft::KR_UNCRAFTABLE, "Minimal return temperature", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP>, czdec::reply_r_scalar<CZ_SCALAR_TEMP>, czdec::reply_w_generic},
 		//41444452078a656fde02c772010203040b08 002904 3403fc031a04fa004a010000000000000000280028002800280028002800d6002b0014052c01000084032c0104000400140014006c027d006affb5ff4100fa004c047d001400f40114001900f6ff64001400f6ff0f0001f401e
-		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x29, 0x04}, czcraft::KR_UNCRAFTABLE, "Room Heating - compressor max frequency", czdec::cmd_r_generic, czdec::cmd_w_freq, czdec::reply_r_freq, czdec::reply_w_generic},
+		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x29, 0x04}, czcraft::KR_UNCRAFTABLE, "Room Heating - compressor max frequency", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_FREQ>, czdec::reply_r_scalar<CZ_SCALAR_FREQ>, czdec::reply_w_generic},
 		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x2C, 0x04}, czcraft::KR_UNCRAFTABLE, "Status 12", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_12, czdec::reply_w_generic},	// 0xC2 bytes
-		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x35, 0x04}, czcraft::KR_UNCRAFTABLE, "Heatpump - compressor - blocked frequency 1", czdec::cmd_r_generic, czdec::cmd_w_freq, czdec::reply_r_freq, czdec::reply_w_generic},
-		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x37, 0x04}, czcraft::KR_UNCRAFTABLE, "Heatpump - compressor - blocked frequency 2", czdec::cmd_r_generic, czdec::cmd_w_freq, czdec::reply_r_freq, czdec::reply_w_generic},
-		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x39, 0x04}, czcraft::KR_UNCRAFTABLE, "Heatpump - compressor - blocked frequency 3", czdec::cmd_r_generic, czdec::cmd_w_freq, czdec::reply_r_freq, czdec::reply_w_generic},
+		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x35, 0x04}, czcraft::KR_UNCRAFTABLE, "Heatpump - compressor - blocked frequency 1", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_FREQ>, czdec::reply_r_scalar<CZ_SCALAR_FREQ>, czdec::reply_w_generic},
+		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x37, 0x04}, czcraft::KR_UNCRAFTABLE, "Heatpump - compressor - blocked frequency 2", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_FREQ>, czdec::reply_r_scalar<CZ_SCALAR_FREQ>, czdec::reply_w_generic},
+		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x39, 0x04}, czcraft::KR_UNCRAFTABLE, "Heatpump - compressor - blocked frequency 3", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_FREQ>, czdec::reply_r_scalar<CZ_SCALAR_FREQ>, czdec::reply_w_generic},
 		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x64, 0x01}, czcraft::KR_UNCRAFTABLE, "Status 25", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_25, czdec::reply_w_generic},	// 0xC2 bytes
 		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x7A, 0x03}, czcraft::KR_UNCRAFTABLE, "Status 01", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_01, czdec::reply_w_generic},	// 0xC2 bytes
-		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x7B, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR0, "Hardware Settings - Adjustments - TE0 Adjust", czdec::cmd_r_generic, czdec::cmd_w_temp_1byte, czdec::reply_r_temp_1byte, czdec::reply_w_generic},
-		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x7C, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR1, "Hardware Settings - Adjustments - TE1 Adjust", czdec::cmd_r_generic, czdec::cmd_w_temp_1byte, czdec::reply_r_temp_1byte, czdec::reply_w_generic},	// not tested
-		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x7D, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR2, "Hardware Settings - Adjustments - TE2 Adjust", czdec::cmd_r_generic, czdec::cmd_w_temp_1byte, czdec::reply_r_temp_1byte, czdec::reply_w_generic},	// not tested
-		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x7D, 0x03}, czcraft::KR_HOT_WATER_TEMP, "Hot water calculated setting", czdec::cmd_r_generic, czdec::cmd_w_temp, czdec::reply_r_temp, czdec::reply_w_generic},
-		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x7E, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR3, "Hardware Settings - Adjustments - TE3 Adjust", czdec::cmd_r_generic, czdec::cmd_w_temp_1byte, czdec::reply_r_temp_1byte, czdec::reply_w_generic},	// not tested
-		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x7F, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR4, "Hardware Settings - Adjustments - TE4 Adjust", czdec::cmd_r_generic, czdec::cmd_w_temp_1byte, czdec::reply_r_temp_1byte, czdec::reply_w_generic},	// not tested
-		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x80, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR5, "Hardware Settings - Adjustments - TE5 Adjust", czdec::cmd_r_generic, czdec::cmd_w_temp_1byte, czdec::reply_r_temp_1byte, czdec::reply_w_generic},	// not tested
-		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x81, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR6, "Hardware Settings - Adjustments - TE6 Adjust", czdec::cmd_r_generic, czdec::cmd_w_temp_1byte, czdec::reply_r_temp_1byte, czdec::reply_w_generic},	// not tested
-		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x82, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR7, "Hardware Settings - Adjustments - TE7 Adjust", czdec::cmd_r_generic, czdec::cmd_w_temp_1byte, czdec::reply_r_temp_1byte, czdec::reply_w_generic},
-		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0xA6, 0x04}, czcraft::KR_UNCRAFTABLE, "Heatpump - defrost delay", czdec::cmd_r_generic, czdec::cmd_w_time, czdec::reply_r_time, czdec::reply_w_generic},
+		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x7B, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR0, "Hardware Settings - Adjustments - TE0 Adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_r_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_w_generic},
+		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x7C, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR1, "Hardware Settings - Adjustments - TE1 Adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_r_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_w_generic},	// not tested
+		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x7D, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR2, "Hardware Settings - Adjustments - TE2 Adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_r_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_w_generic},	// not tested
+		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x7D, 0x03}, czcraft::KR_HOT_WATER_TEMP, "Hot water calculated setting", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP>, czdec::reply_r_scalar<CZ_SCALAR_TEMP>, czdec::reply_w_generic},
+		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x7E, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR3, "Hardware Settings - Adjustments - TE3 Adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_r_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_w_generic},	// not tested
+		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x7F, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR4, "Hardware Settings - Adjustments - TE4 Adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_r_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_w_generic},	// not tested
+		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x80, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR5, "Hardware Settings - Adjustments - TE5 Adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_r_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_w_generic},	// not tested
+		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x81, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR6, "Hardware Settings - Adjustments - TE6 Adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_r_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_w_generic},	// not tested
+		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x82, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR7, "Hardware Settings - Adjustments - TE7 Adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_r_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_w_generic},
+		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0xA6, 0x04}, czcraft::KR_UNCRAFTABLE, "Heatpump - defrost delay", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TIME>, czdec::reply_r_scalar<CZ_SCALAR_TIME>, czdec::reply_w_generic},
 		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0xA7, 0x02}, czcraft::KR_LED_LUMINOSITY, "LED luminosity", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic},
 		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0xAC, 0x02}, czcraft::KR_UNCRAFTABLE, "Holiday reduction", czdec::cmd_r_generic, czdec::cmd_w_day_delay, czdec::reply_r_day_delay, czdec::reply_w_generic},
 		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0xC8, 0x02}, czcraft::KR_UNCRAFTABLE, "Status 10", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_10, czdec::reply_w_generic},	// 0xC2 bytes
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0xA6, 0x02}, czcraft::KR_ROOM_HEATING_TEMP, "Heating calculated setting", czdec::cmd_r_generic, czdec::cmd_w_temp, czdec::reply_r_temp, czdec::reply_w_generic},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0xA6, 0x02}, czcraft::KR_ROOM_HEATING_TEMP, "Heating calculated setting", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP>, czdec::reply_r_scalar<CZ_SCALAR_TEMP>, czdec::reply_w_generic, 0},
 		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0xB2, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 23", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_23, czdec::reply_w_generic},	// 0xC2 bytes
 		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0xDE, 0x04}, czcraft::KR_UNCRAFTABLE, "Status 13", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_13, czdec::reply_w_generic},	// 0x63 bytes
 
 		// Status 02 - provides TEx temperatures from sensors
 		//41 44 44 52 07 8a 65 6f de 02 c8 72 01 02 03 04 0b 08 01 00 00 00 00 00 00 13 1f 39 19 0b 17 06 00 13 1f 39 00 00 40 00 40 00 00 00 38 2a 00 00 10 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 41 19 fc  19 fc  e3  ff  e4  01 08 01 d5  00 f2  02 c0  01 ed  ff  ed  ff  22 fc  22 fc  05 01 22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  0c 02 46 00 0c 00 4c 01 b7  00 00 00 e8  03 e8  03 00 00 46 00 81  00 a6  00 b7  00 00 00 00 00 00 00 e3  ff  d8  01 08 01 d5  00 f0  02 c0  01 f0  ff  dd  01 f1  ff  22 fc  22 fc  05 01 22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  c0
 		//41 44 44 52 07 8a 65 6f de 02 c8 72 01 02 03 04 0b 08 01 00 00 00 00 00 00 13 20 39 19 0b 17 06 00 13 20 39 00 00 40 00 40 00 00 00 38 2a 00 00 10 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 41 19 fc  19 fc  e3  ff  bc  01 08 01 d5  00 ae  02 c1  01 f7  ff  f8  ff  22 fc  22 fc  05 01 22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  0c 02 48 00 0c 00 3c 01 ab  00 00 00 e8  03 e8  03 00 00 48 00 7b  00 9e  00 ab  00 00 00 00 00 00 00 e3  ff  b6  01 08 01 d5  00 a7  02 c3  01 f9  ff  dd  01 fa  ff  22 fc  22 fc  05 01 22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  22 fc  ce
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x01, 0x00, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 02", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_02, czdec::reply_w_generic},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x01, 0x00, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 02", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_02, czdec::reply_w_generic, 0},	// 0xC2 bytes
 
 		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x01, 0x04, 0x00}, czcraft::KR_HOUR, "Hour", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic},
 		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x01, 0x05, 0x00}, czcraft::KR_MINUTE, "Minute", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic},
@@ -158,7 +165,7 @@ static czdec::KNOWN_REGISTER kr_decoder[] =
 		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x01, 0xB2, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 03", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_03, czdec::reply_w_generic},	// 0xC2 bytes
 
 		//41444452078a656fde02c672010203040b0801c70200008403cc0119014e002400db002d0100002d0138ff97ffb8fff8fd00002d012d012d012d0100000f013403740888133601000000000000000000005e01000000000000000000005c2b00004f09000000004f0900004809000
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x01, 0xC7, 0x02}, czcraft::KR_UNCRAFTABLE, "Status 06", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_06_v170, czdec::reply_w_generic},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x01, 0xC7, 0x02}, czcraft::KR_UNCRAFTABLE, "Status 06", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_06_v170, czdec::reply_w_generic, 0},	// 0xC2 bytes
 
 		// Status 15, just a bunch of timestamps?
 		//41  44  44  52  07  8a  65  6f  de  02  c8  72  01  02  03  04  0b  08  03  15  0d  17  0d  0b  17  14  36  32  00  00  00  00  00  00  00  00  0d  0b  17  16  1c  04  00  00  00  00  00  00  00  00  12  0b  17  11  2a  1b  00  00  00  00  00  00  00  00  13  0b  17  0b  2e  2d  00  00  00  00  00  00  00  00  13  0b  17  0d  0f  2c  00  00  00  00  00  00  00  00  13  0b  17  0d  26  1f  00  00  00  00  00  00  00  00  13  0b  17  0d  27  28  00  00  00  00  00  00  00  00  13  0b  17  0d  33  2f  00  00  00  00  00  00  00  00  13  0b  17  0d  35  12  00  00  00  00  00  00  00  00  13  0b  17  0d  36  0e  00  00  00  00  00  00  00  00  13  0b  17  0d  37  27  00  00  00  00  00  00  00  00  13  0b  17  0d  39  03  00  00  00  00  00  00  00  00  13  0b  17  16  27  26  00  00  00  c8
@@ -192,28 +199,28 @@ static czdec::KNOWN_REGISTER kr_decoder[] =
 		//31  21  126 255 116 255 146 255 136 255 206 255 196 255 241 255 231 255 45  01  37  02  38  02  30  00  187 02  170 00  50  00  10  10  38  02  51  00  88  02  01  102 03  212 254 44  01  00  00  44  01  72  03  138 02  238 02  72  03  182 03  232 03  212 254 188 02  00  00  50  00  70  00  208 07  166 14  136 19  250 00  52  03  38  02  188 02  52  03  252 03  26  04  250 00  74  01  00  00  169
 		//hwmax hwpause                                                           min fre max fre                 heatin  h-time              hw done on cond. temp           fan spd         300             300     840     650     750     840     694     1000            700             50      filter change   3750    5000            820     550     700     820     1020    1050    250     330
 		//		126		116		146		136		206		196		241		231		301		549		550		30		699		170						550     51      600         870                                                                                                                             2000
-        { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0xD2, 0x03}, czcraft::KR_UNCRAFTABLE, "Status v170 x79", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v170_x79, czdec::reply_w_generic},	// 0x79 bytes
+        { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0xD2, 0x03}, czcraft::KR_UNCRAFTABLE, "Status v170 x79", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v170_x79, czdec::reply_w_generic, 0},	// 0x79 bytes
 
 		// Provides additional energy, compressor energy, hot water energy, total runtime and compressor runtime (in minutes, CZ shows it in hours in the GUI)
 		//41  44  44  52  07  8a  65  6f  de  02  56  72  01  02  03  04  0b  08  05  00  00    59  31  19  07  25  11  23  00  00  00  00  00  30  30  30  30  13  47  00  00  b1  22  00  00  f9  14  00  00  41  09  00  00  00  00  00  00  00  00  00  00  00  00  00  00  33  8f  4c  00  3d  22  07  00  7f  40  0c  00  83  c6  10  00  ea  1a  31  00  a0
 		//65  68  68  82  07  138 101 111 222 02  86  114 01  02  03  04  11  08  05  00  00    89  49  25  07  37  17  35  00  00  00  00  00  48  48  48  48  19  71  00  00  177 34  00  00  249 20  00  00  65  09  00  00  00  00  00  00  00  00  00  00  00  00  00  00  51  143 76  00  61  34  07  00  127 64  12  00  131 198 16  00  234 26  49  00  160
 		//A   D   D   R   .   .   e   o   .   .   V   r   .   .   .   .   .   .   .   .   .     Y   1   .   .   %   .   #   .   .   .   .   .   0   0   0   0   .   G   .   .   .   "   .   .   .   .   .   .   A   .   .   .   .   .   .   .   .   .   .   .   .   .   .   .   3   .   L   .   =   "   .   .   .   @   .   .   .   .   .   .   .   .   1   .   .
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x05, 0x00, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 08", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_08, czdec::reply_w_generic},	// 0x50 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x05, 0x00, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 08", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_08, czdec::reply_w_generic, 0},	// 0x50 bytes
     	
 		//Data: 656fde02d35e414444521857010203040b0881130000049c
     	//Data: 41444452078a656fde021777010203040b088113000434
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x81, 0x13, 0x00}, czcraft::KR_FIREPLACE_MODE_ENABLE, "Enable fireplace mode", czdec::empty, czdec::cmd_w_generic_2byte, czdec::empty, czdec::reply_w_generic},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x81, 0x13, 0x00}, czcraft::KR_FIREPLACE_MODE_ENABLE, "Enable fireplace mode", czdec::empty, czdec::cmd_w_generic_2byte, czdec::empty, czdec::reply_w_generic, 0},
 
 		//    Data: 656fde02d35e414444521857010203040b08411300fffb0a
 		//    Data: 41444452078a656fde021777010203040b0841130008ae
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x41, 0x13, 0x00}, czcraft::KR_FIREPLACE_MODE_DISABLE, "Disable fireplace mode", czdec::empty, czdec::cmd_w_generic_2byte, czdec::empty, czdec::reply_w_generic},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x41, 0x13, 0x00}, czcraft::KR_FIREPLACE_MODE_DISABLE, "Disable fireplace mode", czdec::empty, czdec::cmd_w_generic_2byte, czdec::empty, czdec::reply_w_generic, 0},
 
 		// room temp
 		//41 44 44 52 07 8a 65 6f de 02 2d 72 01 02 03 04 0b 08 00 9d 02 02 06 00 00 ff 00 00 ff 06 d1 00 14 00 32 00 ce ff 00 00 07 00 00 00 fe
 		//41  44  44  52  07  8a  65  6f  de  02  2d  72  01  02  03  04  0b  08    00  9d  02    02  06  00  00  ff  00  00  ff  06  d1  00  14  00  32  00  ce  ff  00  00  07  00  00  00  fe
 		//65  68  68  82  07  138 101 111 222 02  45  114 01  02  03  04  11  08    00  157 02    02  06  00  00  255 00  00  255 06  209 00  20  00  50  00  206 255 00  00  07  00  00  00  254
 		//A   D   D   R   .   .   e   o   .   .   -   r   .   .   .   .   .   .     .   .   .     .   .   .   .   .   .   .   .   .   .   .   .   .   2   .   .   .   .   .   .   .   .   .   .
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x9D, 0x02}, czcraft::KR_UNCRAFTABLE, "Status 2D", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v170_status_2d, czdec::reply_w_generic},	// 0x45 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x08, 0x00, 0x9D, 0x02}, czcraft::KR_UNCRAFTABLE, "Status 2D", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v170_status_2d, czdec::reply_w_generic, 0},	// 0x45 bytes
 
 		// Change heating curve 6 -> 5 -> 4 -> 3 -> 6
 		// Data: 656fde02d35e414444521757010203040b0800a50205f2 6 to 5?
@@ -269,9 +276,12 @@ static czdec::KNOWN_REGISTER kr_decoder[] =
 		// some status
 		// 41444452078a656fde026b72010203040b0800da042d00bb03051e2c010af4013c0005f401f40178000ad200a000d00758021affffda0205500078b00478e803e80314018403080708075a00c003000000000000000000000000000000000000000000000000d2045555d5
 
+	};
 #endif
 
-#if HP_PROTOCOL == HP_PROTOCOL_1_8
+#if HP_WITH_PROTOCOL(HP_PROTOCOL_1_8)
+static constexpr czdec::KNOWN_REGISTER kr_decoder_v180[] =
+	{
 // status frame
 // not changed when hot water settings are modified
 // query 01 02 03 04 0B 09 00 00 00 16 ..  => 17
@@ -283,7 +293,7 @@ static czdec::KNOWN_REGISTER kr_decoder[] =
 */
 
 
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x00, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 20 (not decoded)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_20, czdec::reply_w_generic},	// 0x26 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x00, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 20 (not decoded)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_20, czdec::reply_w_generic, 0},	// 0x26 bytes
 
 
 
@@ -292,34 +302,34 @@ static czdec::KNOWN_REGISTER kr_decoder[] =
 
 
 
-		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x0B, 0x04}, czcraft::KR_UNCRAFTABLE, "Hot water extra setting", czdec::cmd_r_generic, czdec::cmd_w_temp, czdec::reply_r_temp, czdec::reply_w_generic},
+		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x0B, 0x04}, czcraft::KR_UNCRAFTABLE, "Hot water extra setting", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP>, czdec::reply_r_scalar<CZ_SCALAR_TEMP>, czdec::reply_w_generic, 0},
 
 // Write: 01 02 03 04 0B 09 00 0D 04 B4 00 ..  => 18  Reply: 01 02 03 04 0B 09 00 0D 04 00 ..  => 17
 // means 18.0°C ?
 // Read:  01 02 03 04 0B 09 00 0D 04 02 ..  => 17     Reply: 01 02 03 04 0B 09 00 0D 04 B4 00 ..  => 18
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x0D, 0x04}, czcraft::KR_UNCRAFTABLE, "Hot water extra time", czdec::cmd_r_generic, czdec::cmd_w_time_minutes, czdec::reply_r_time_minutes, czdec::reply_w_generic},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x0D, 0x04}, czcraft::KR_UNCRAFTABLE, "Hot water extra time", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TIME_MINUTES>, czdec::reply_r_scalar<CZ_SCALAR_TIME_MINUTES>, czdec::reply_w_generic, 0},
 
 
 // Write: 01 02 03 04 0b 09 81 13 00 00 04 ab
 // Write reply: 01 02 03 04 0b 09 81 13 00 04 f9
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x81, 0x13, 0x00}, czcraft::KR_FIREPLACE_MODE_ENABLE, "Enable fireplace mode", czdec::empty, czdec::cmd_w_generic_2byte, czdec::empty, czdec::reply_w_generic},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x81, 0x13, 0x00}, czcraft::KR_FIREPLACE_MODE_ENABLE, "Enable fireplace mode", czdec::empty, czdec::cmd_w_generic_2byte, czdec::empty, czdec::reply_w_generic, 0},
 
 // Write: 01 02 03 04 0b 09 41 13 00 ff fb 3d
 // Write reply: 01 02 03 04 0b 09 41 13 00 08 63
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x41, 0x13, 0x00}, czcraft::KR_FIREPLACE_MODE_DISABLE, "Disable fireplace mode", czdec::empty, czdec::cmd_w_generic_2byte, czdec::empty, czdec::reply_w_generic},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x41, 0x13, 0x00}, czcraft::KR_FIREPLACE_MODE_DISABLE, "Disable fireplace mode", czdec::empty, czdec::cmd_w_generic_2byte, czdec::empty, czdec::reply_w_generic, 0},
 
 
-		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x0E, 0x00}, czcraft::KR_UNCRAFTABLE, "Sanitary priority (get)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_sanitary_priority, czdec::empty},
+		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x0E, 0x00}, czcraft::KR_UNCRAFTABLE, "Sanitary priority (get)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_sanitary_priority, czdec::empty, 0},
 
 // read: 01 02 03 04 0B 09 00 14 02 => 17
 // only 1 reply: 41 44 44 52 07 8A 65 6F DE 02 C8 72 01 02 03 04 0B 09 00 14 02 E8 03 05 05 05 05 05 05 05 05 05 05 05 05 05 05 05 05 2E 2E 2E 2E 2E 2E 2E 2E 2E 2E 2E 2E 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 05 05 05 05 0F 0F 05 05 05 05 05 05 00 00 1E 14 A0 0A 0E 01 00 2C 01 14 2C 01 14 05 0F 00 00 0A 00 3C 00 E8 03 0A 00 3C 00 00 00 0A 00 3C 00 E8 03 0A 00 3C 00 00 00 01 01 03 01 04 03 01 00 00 00 01 00 01 00 01 00 B4 00 14 00 0A 00 0A 00 0A 00 01 06 00 00 FF 00 00 FF 46 D2 00 1E 00 32 00 CE FF 00 00 00 05 00 00 19 01 4E 01 80 01 AF 01 DB 01 05 02 28 00 3C 00 11  => C8
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x14, 0x02}, czcraft::KR_UNCRAFTABLE, "Status 11", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_11, czdec::reply_w_generic},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x14, 0x02}, czcraft::KR_UNCRAFTABLE, "Status 11", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_11, czdec::reply_w_generic, 0},	// 0xC2 bytes
 
-		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x1A, 0x04}, czcraft::KR_FAN_SPEED, "Fan speed", czdec::cmd_r_generic, czdec::cmd_w_fan_speed, czdec::reply_r_fan_speed, czdec::reply_w_generic},
+		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x1A, 0x04}, czcraft::KR_FAN_SPEED, "Fan speed", czdec::cmd_r_generic, czdec::cmd_w_fan_speed, czdec::reply_r_fan_speed, czdec::reply_w_generic, 0},
 
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x25, 0x01}, czcraft::KR_UNCRAFTABLE, "Hardware Settings - Adjustments - TE24 Adjust", czdec::cmd_r_generic, czdec::cmd_w_temp_1byte, czdec::reply_r_temp_1byte, czdec::reply_w_generic},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x25, 0x01}, czcraft::KR_UNCRAFTABLE, "Hardware Settings - Adjustments - TE24 Adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_r_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_w_generic, 0},
 
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x29, 0x04}, czcraft::KR_UNCRAFTABLE, "Junk packet, heatpump never replies to it", czdec::cmd_r_generic, czdec::empty, czdec::empty, czdec::reply_w_generic},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x29, 0x04}, czcraft::KR_UNCRAFTABLE, "Junk packet, heatpump never replies to it", czdec::cmd_r_generic, czdec::empty, czdec::empty, czdec::reply_w_generic, 0},
 /* reply:
 always:
 41 44 44 52 07 8A 65 6F DE 02 C8 72 01 02 03 04 0B 09 00 2C 03 64 00 64 00 B4 00 BC 02 C8 00 F4 01 78 00 58 02 00 00 02 64 00 05 78 00 1E 00 52 03 2C 01 0C FE C8 00 0A 00 8C 0A 0C FE 1E 0C FE 58 02 D0 07 58 02 9C FF AC 0D FA 00 2C 01 5E 01 90 01 90 01 90 01 5E 01 2C 01 14 14 14 14 14 14 14 14 00 00 00 12 90 01 C8 00 14 00 DE 00 F9 00 10 01 27 01 3B 01 4E 01 00 00 FF 1C 02 0F 00 92 FF 8D FF 88 FF 83 FF 7E FF 79 FF 74 FF 6F FF 6A FF 65 FF 60 FF 5B FF 5B FF 5B FF 5B FF CE FF CE FF CE FF C9 FF C4 FF C4 FF BF FF BF FF BA FF BA FF B5 FF B5 FF B5 FF B5 FF B5 FF F1 FF EC FF E7 FF E2 FF DD FF D8 FF C3  => C8
@@ -327,44 +337,44 @@ except one time:
 41 44 44 52 07 8A 65 6F DE 02 C8 72 01 02 03 04 0B 09 00 2C 03 64 00 64 00 B4 00 BC 02 C8 00 F4 01 78 00 58 02 00 00 02 64 00 05 78 00 1E 00 52 03 2C 01 0C FE C8 00 0A 00 8C 0A 0C FE 1E 0C FE 58 02 D0 07 58 02 9C FF AC 0D FA 00 2C 01 5E 01 90 01 90 01 90 01 5E 01 2C 01 14 14 14 14 14 14 14 14 00 00 00 12 90 01 C8 00 14 00 DE 00 F9 00 10 01 27 01 3B 01 4E 01 00 14 05 1C 02 0F 00 92 FF 8D FF 88 FF 83 FF 7E FF 79 FF 74 FF 6F FF 6A FF 65 FF 60 FF 5B FF 5B FF 5B FF 5B FF CE FF CE FF CE FF C9 FF C4 FF C4 FF BF FF BF FF BA FF BA FF B5 FF B5 FF B5 FF B5 FF B5 FF F1 FF EC FF E7 FF E2 FF DD FF D8 FF DD  => C8
 */
 
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x2C, 0x03}, czcraft::KR_UNCRAFTABLE, "Status (settings)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_settings, czdec::reply_w_generic},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x2C, 0x03}, czcraft::KR_UNCRAFTABLE, "Status (settings)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_settings, czdec::reply_w_generic, 0},	// 0xC2 bytes
 
-		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x39, 0x04}, czcraft::KR_UNCRAFTABLE, "Filter change countdown", czdec::cmd_r_generic, czdec::cmd_w_time_days, czdec::reply_r_time_days, czdec::reply_w_generic},
+		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x39, 0x04}, czcraft::KR_UNCRAFTABLE, "Filter change countdown", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TIME_DAYS>, czdec::reply_r_scalar<CZ_SCALAR_TIME_DAYS>, czdec::reply_w_generic, 0},
 
 // read: 01 02 03 04 0B 09 00 62 01 B2 68 => 17
 // reply (always): 41 44 44 52 07 8A 65 6F DE 02 C8 72 01 02 03 04 0B 09 00 62 01 00 00 00 00 00 00 00 00 00 00 00 00 AC 0D AC 0D AC 0D AC 0D AC 0D AC 0D AC 0D AC 0D AC 0D AC 0D AC 0D AC 0D AC 0D AC 0D AC 0D AC 0D AC 0D AC 0D AC 0D AC 0D AC 0D AC 0D AC 0D AC 0D AC 0D AC 0D AC 0D AC 0D 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 E8 03 E8 03 E8 03 E8 03 E8 03 E8 03 E8 03 E8 03 E8 03 E8 03 E8 03 E8 03 E8 03 E8 03 E8 03 E8 03 E8 03 E8 03 E8 03 E8 03 E8 03 E8 03 E8 03 E8 03 E8 03 E8 03 E8 03 92 => C8
 // looks like temperature history. AC 0D = 3500 (35.00°?), E8 03 = 1000 (10.00°?)
 
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x62, 0x01}, czcraft::KR_UNCRAFTABLE, "Status xx (random mapping 4, not decoded)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_19, czdec::reply_w_generic},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x62, 0x01}, czcraft::KR_UNCRAFTABLE, "Status xx (random mapping 4, not decoded)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_19, czdec::reply_w_generic, 0},	// 0xC2 bytes
 
-		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x7D, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR0, "Hardware Settings - Adjustments - TE0 Adjust", czdec::cmd_r_generic, czdec::cmd_w_temp_1byte, czdec::reply_r_temp_1byte, czdec::reply_w_generic},
-		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x7E, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR1, "Hardware Settings - Adjustments - TE1 Adjust", czdec::cmd_r_generic, czdec::cmd_w_temp_1byte, czdec::reply_r_temp_1byte, czdec::reply_w_generic},
-		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x7F, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR2, "Hardware Settings - Adjustments - TE2 Adjust", czdec::cmd_r_generic, czdec::cmd_w_temp_1byte, czdec::reply_r_temp_1byte, czdec::reply_w_generic},
-		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x80, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR3, "Hardware Settings - Adjustments - TE3 Adjust", czdec::cmd_r_generic, czdec::cmd_w_temp_1byte, czdec::reply_r_temp_1byte, czdec::reply_w_generic},
-		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x81, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR4, "Hardware Settings - Adjustments - TE4 Adjust", czdec::cmd_r_generic, czdec::cmd_w_temp_1byte, czdec::reply_r_temp_1byte, czdec::reply_w_generic},
-		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x82, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR5, "Hardware Settings - Adjustments - TE5 Adjust", czdec::cmd_r_generic, czdec::cmd_w_temp_1byte, czdec::reply_r_temp_1byte, czdec::reply_w_generic},
-		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x83, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR6, "Hardware Settings - Adjustments - TE6 Adjust", czdec::cmd_r_generic, czdec::cmd_w_temp_1byte, czdec::reply_r_temp_1byte, czdec::reply_w_generic},
-		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x84, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR7, "Hardware Settings - Adjustments - TE7 Adjust", czdec::cmd_r_generic, czdec::cmd_w_temp_1byte, czdec::reply_r_temp_1byte, czdec::reply_w_generic},
-		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x92, 0x03}, czcraft::KR_HOT_WATER_TEMP, "Hot water calculated setting", czdec::cmd_r_generic, czdec::cmd_w_temp, czdec::reply_r_temp, czdec::reply_w_generic},
-		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x9F, 0x02}, czcraft::KR_LED_LUMINOSITY, "LED luminosity", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic},
+		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x7D, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR0, "Hardware Settings - Adjustments - TE0 Adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_r_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_w_generic, 0},
+		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x7E, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR1, "Hardware Settings - Adjustments - TE1 Adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_r_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_w_generic, 0},
+		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x7F, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR2, "Hardware Settings - Adjustments - TE2 Adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_r_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_w_generic, 0},
+		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x80, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR3, "Hardware Settings - Adjustments - TE3 Adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_r_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_w_generic, 0},
+		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x81, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR4, "Hardware Settings - Adjustments - TE4 Adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_r_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_w_generic, 0},
+		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x82, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR5, "Hardware Settings - Adjustments - TE5 Adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_r_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_w_generic, 0},
+		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x83, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR6, "Hardware Settings - Adjustments - TE6 Adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_r_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_w_generic, 0},
+		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x84, 0x00}, czcraft::KR_TEMP_OFFSET_SENSOR7, "Hardware Settings - Adjustments - TE7 Adjust", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_r_scalar<CZ_SCALAR_TEMP_1BYTE>, czdec::reply_w_generic, 0},
+		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x92, 0x03}, czcraft::KR_HOT_WATER_TEMP, "Hot water calculated setting", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP>, czdec::reply_r_scalar<CZ_SCALAR_TEMP>, czdec::reply_w_generic, 0},
+		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0x9F, 0x02}, czcraft::KR_LED_LUMINOSITY, "LED luminosity", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic, 0},
 
-		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0xA4, 0x02}, czcraft::KR_UNCRAFTABLE, "Holiday reduction", czdec::cmd_r_generic, czdec::cmd_w_day_delay, czdec::reply_r_day_delay, czdec::reply_w_generic},
+		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0xA4, 0x02}, czcraft::KR_UNCRAFTABLE, "Holiday reduction", czdec::cmd_r_generic, czdec::cmd_w_day_delay, czdec::reply_r_day_delay, czdec::reply_w_generic, 0},
 
 // read: 01 02 03 04 0B 09 00 B1 00 => 17
 // reply always 41 44 44 52 07 8A 65 6F DE 02 C7 72 01 02 03 04 0B 09 00 B1 00 00 00 00 00 FF 03 FF 03 99 03 99 03 FF 03 FF 03 FF 03 FF 03 FF 03 FF 03 FF 03 FF 03 FF 03 FF 03 FF 03 FF 03 00 00 00 00 0A 00 0A 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 E8 03 E8 03 FF 03 E8 03 FE 01 6E 00 E8 03 E8 03 E8 03 E8 03 FF 03 E8 03 E8 03 E8 03 E8 03 E8 03 00 00 00 00 01 2E 3E 3E 2E 2E 2E 2E 40 2E 2E 2E 2E 2E 2E 2E 3C 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 48 => C7
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0xB1, 0x00}, czcraft::KR_UNCRAFTABLE, "Status xx (0xc72 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_xc72, czdec::reply_w_generic},	// 0xc1 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0xB1, 0x00}, czcraft::KR_UNCRAFTABLE, "Status xx (0xc72 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_xc72, czdec::reply_w_generic, 0},	// 0xc1 bytes
 
 // read:  01 02 03 04 0B 09 00 BF 04 8B 8C  => 17
 // always the same reply: 41 44 44 52 07 8A 65 6F DE 02 A1 72 01 02 03 04 0B 09 00 BF 04 B0 04 F4 01 96 00 58 02 00 00 50 00 19 00 C8 00 07 00 C8 00 40 01 B4 00 5E 01 05 05 F0 0A 09 01 60 09 AA 00 00 00 0A 0A 0A 01 C8 00 E8 03 E8 03 58 02 87 00 64 00 96 00 48 03 32 1E 00 14 14 14 00 E8 03 E8 03 00 05 01 64 00 00 2D 00 BB 03 05 1E 2C 01 0A F4 01 3C 00 05 46 00 FA 00 74 04 26 02 78 00 0A D2 00 F4 01 32 00 A0 00 D0 07 58 02 1A FF 2C 01 DA 02 05 50 00 78 B0 04 78 E8 03 E8 03 14 01 84 03 08 07 08 07 5A 00 D3 => A1
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0xBF, 0x04}, czcraft::KR_UNCRAFTABLE, "Status xx (0xa1 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_xa1, czdec::reply_w_generic},	// 0x9b bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0xBF, 0x04}, czcraft::KR_UNCRAFTABLE, "Status xx (0xa1 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_xa1, czdec::reply_w_generic, 0},	// 0x9b bytes
 
 // read:  01 02 03 04 0B 09 00 C6 02 B2 65  => 17
 // always the same reply: 41 44 44 52 07 8A 65 6F DE 02 C8 72 01 02 03 04 0B 09 00 C6 02 1E 00 64 00 32 00 B0 04 5A 00 B0 04 5A 00 46 00 B4 00 50 00 78 00 FA 00 32 00 12 FD 1E 00 A8 FD 80 0C E0 FC A0 0F DC 05 12 FD 1E 00 A8 FD 80 0C E0 FC A0 0F DC 05 3C 05 0F 0F 0A 06 05 00 05 00 05 00 2D 00 1E 00 19 00 19 00 19 00 05 00 06 00 32 00 00 00 00 00 00 00 00 00 00 60 6A 47 00 00 00 00 00 00 00 00 64 00 64 00 B4 00 BC 02 C8 00 F4 01 78 00 58 02 00 00 02 64 00 05 78 00 1E 00 52 03 2C 01 0C FE C8 00 0A 00 8C 0A 0C FE 1E 0C FE 58 02 D0 07 58 02 9C FF AC 0D FA 00 2C 01 5E 01 90 01 90 01 90 01 5E 01 2C 01 14 14 14 14 14 14 14 92 => C8
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0xC6, 0x02}, czcraft::KR_UNCRAFTABLE, "Status xx (random mapping 5, not decoded)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_19, czdec::reply_w_generic},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0xC6, 0x02}, czcraft::KR_UNCRAFTABLE, "Status xx (random mapping 5, not decoded)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_19, czdec::reply_w_generic, 0},	// 0xC2 bytes
 
 // read:  01 02 03 04 0B 09 00 DB 04 8D 6A  => 17
 // always the same reply: 41 44 44 52 07 8A 65 6F DE 02 A3 72 01 02 03 04 0B 09 00 DB 04 F0 0A 09 01 60 09 AA 00 00 00 0A 0A 0A 01 C8 00 E8 03 E8 03 58 02 87 00 64 00 96 00 48 03 32 1E 00 14 14 14 00 E8 03 E8 03 00 05 01 64 00 00 2D 00 BB 03 05 1E 2C 01 0A F4 01 3C 00 05 46 00 FA 00 74 04 26 02 78 00 0A D2 00 F4 01 32 00 A0 00 D0 07 58 02 1A FF 2C 01 DA 02 05 50 00 78 B0 04 78 E8 03 E8 03 14 01 84 03 08 07 08 07 5A 00 C0 03 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 D2 04 56 55 4D => A3
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0xDB, 0x04}, czcraft::KR_UNCRAFTABLE, "Status xx (0xa3 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_xa3, czdec::reply_w_generic},	// 0x9d bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0xDB, 0x04}, czcraft::KR_UNCRAFTABLE, "Status xx (0xa3 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_xa3, czdec::reply_w_generic, 0},	// 0x9d bytes
 
 // read:  01 02 03 04 0B 09 00 DE 03 77 3B  => 17 
 /* replies:
@@ -374,22 +384,22 @@ except one time:
 except 1 time:
 41 44 44 52 07 8A 65 6F DE 02 8D 72 01 02 03 04 0B 09 00 DE 03 D3 FF CE FF C9 FF C4 FF BF FF BA FF BA FF BA FF BA FF 05 1E 14 7E FF 74 FF 92 FF 88 FF CE FF C4 FF F1 FF E7 FF 2C 01 26 02 26 02 1E 00 8A 02 B4 00 DA 02 0A 0A 1E 26 02 32 00 58 02 04 0C 03 D4 FE 2C 01 00 00 2C 01 48 03 8A 02 EE 02 48 03 B6 03 E8 03 D4 FE BC 02 00 00 32 00 -5A- 00 A4 06 10 0E 88 13 D2 00 34 03 26 02 BC 02 34 03 FC 03 1A 04 00 00 00 00 00 00 31 => 8D
 */
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0xDE, 0x03}, czcraft::KR_UNCRAFTABLE, "Status xx (0x8d bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_x8d, czdec::reply_w_generic},	// 0x87 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x00, 0xDE, 0x03}, czcraft::KR_UNCRAFTABLE, "Status xx (0x8d bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_x8d, czdec::reply_w_generic, 0},	// 0x87 bytes
 
 /* replies => C8
 41 44 44 52 07 8A 65 6F DE 02 C8 72 01 02 03 04 0B 09 01 00 00 00 00 00 00 16 33 37 0C 01 17 04 00 16 33 37 00 00 40 00 44 00 00 20 0B 5E 00 01 16 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 41 19 FC 19 FC 2E 00 10 01 1D 01 E1 00 19 01 14 01 2C 00 08 00 22 FC 22 FC 04 01 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC D0 01 4B 00 1F 00 13 00 00 00 00 00 E8 03 93 03 00 00 4B 00 85 00 AC 00 00 00 00 00 00 00 55 00 2E 00 10 01 62 01 E1 00 1B 01 24 01 2F 00 94 01 08 00 22 FC 22 FC 04 01 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 57
 */
 
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x00, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 02", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_02, czdec::reply_w_generic},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x00, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 02", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_02, czdec::reply_w_generic, 0},	// 0xC2 bytes
 
-		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x04, 0x00}, czcraft::KR_HOUR, "Hour", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic},
-		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x05, 0x00}, czcraft::KR_MINUTE, "Minute", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x06, 0x00}, czcraft::KR_UNCRAFTABLE, "Second", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic},
-		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x07, 0x00}, czcraft::KR_DAY, "Day of Month", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic},
-		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x08, 0x00}, czcraft::KR_MONTH, "Month (1=Jan)", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic},
-		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x09, 0x00}, czcraft::KR_YEAR, "Year (20xx)", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic},
+		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x04, 0x00}, czcraft::KR_HOUR, "Hour", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic, 0},
+		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x05, 0x00}, czcraft::KR_MINUTE, "Minute", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x06, 0x00}, czcraft::KR_UNCRAFTABLE, "Second", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic, 0},
+		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x07, 0x00}, czcraft::KR_DAY, "Day of Month", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic, 0},
+		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x08, 0x00}, czcraft::KR_MONTH, "Month (1=Jan)", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic, 0},
+		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x09, 0x00}, czcraft::KR_YEAR, "Year (20xx)", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic, 0},
 
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x13, 0x02}, czcraft::KR_UNCRAFTABLE, "Junk packet 2, heatpump never replies to it", czdec::cmd_r_generic, czdec::empty, czdec::empty, czdec::reply_w_generic},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x13, 0x02}, czcraft::KR_UNCRAFTABLE, "Junk packet 2, heatpump never replies to it", czdec::cmd_r_generic, czdec::empty, czdec::empty, czdec::reply_w_generic, 0},
 
 /* replies => 18
 41 44 44 52 07 8A 65 6F DE 02 18 72 01 02 03 04 0B 09 01 17 00 08 4D 11
@@ -398,14 +408,14 @@ except 1 time:
 41 44 44 52 07 8A 65 6F DE 02 18 72 01 02 03 04 0B 09 01 17 00 0B 6C 39
 41 44 44 52 07 8A 65 6F DE 02 18 72 01 02 03 04 0B 09 01 17 00 0A 6C FD
 */
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x17, 0x00}, czcraft::KR_UNCRAFTABLE, "Status HP (short 2)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_short2, czdec::reply_w_generic},	// 0x18 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x17, 0x00}, czcraft::KR_UNCRAFTABLE, "Status HP (short 2)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_short2, czdec::reply_w_generic, 0},	// 0x18 bytes
 
 // read:  01 02 03 04 0B 09 01 24 04 => 17
 /* replies => BF
 41 44 44 52 07 8A 65 6F DE 02 BF 72 01 02 03 04 0B 09 01 24 04 00 00 00 00 10 12 00 01 00 00 0A 00 00 00 14 14 03 00 01 00 01 00 01 00 B4 00 14 00 0A 00 0A 00 0A 00 0A E0 2E 35 0D 2C 01 05 78 78 14 08 07 08 07 18 15 05 B0 04 8C 0A 1E 00 10 0E 10 0E 3C 00 3C 00 3C 00 3C 00 8C 0A 23 2C 01 80 16 C1 A8 0A C7 FF FF FF 00 C0 A8 0A 01 64 01 83 00 00 2C 01 18 01 C8 00 6C 02 2C 01 6A FF 78 00 2C 01 C8 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 26 02 00 02 06 00 05 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 68
 41 44 44 52 07 8A 65 6F DE 02 BF 72 01 02 03 04 0B 09 01 24 04 00 00 00 00 10 14 00 00 00 00 0A 00 00 00 14 14 03 00 01 00 01 00 01 00 B4 00 14 00 0A 00 0A 00 0A 00 0A E0 2E 10 0E 2C 01 05 78 78 14 08 07 08 07 18 15 05 B0 04 8C 0A 1E 00 10 0E 10 0E 3C 00 3C 00 3C 00 3C 00 8C 0A 1F 2C 01 80 16 C1 A8 0A C7 FF FF FF 00 C0 A8 0A 01 64 01 83 00 00 2C 01 18 01 C8 00 6C 02 2C 01 6A FF 78 00 2C 01 C8 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 26 02 00 02 06 00 05 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 94
 */
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x24, 0x04}, czcraft::KR_UNCRAFTABLE, "Status xx (0xbf bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_xbf, czdec::reply_w_generic},	// 0xb9 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x24, 0x04}, czcraft::KR_UNCRAFTABLE, "Status xx (0xbf bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_xbf, czdec::reply_w_generic, 0},	// 0xb9 bytes
 
 // read:  01 02 03 04 0B 09 01 47 01 02 44  => 17      reply: 41 44 44 52 07 8A 65 6F DE 02 18 72 01 02 03 04 0B 09 01 47 01 21 21 D7  => 18
 		//, 0xrelated to led luminosity.
@@ -428,7 +438,7 @@ except 1 time:
 41 44 44 52 07 8A 65 6F DE 02 18 72 01 02 03 04 0B 09 01 47 01 21 61 91
 41 44 44 52 07 8A 65 6F DE 02 18 72 01 02 03 04 0B 09 01 47 01 A1 87 8A  <== occurs when filter countdown read 0. bit 7 of A1 is related to global alarm or filter alarm
 */
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x47, 0x01}, czcraft::KR_UNCRAFTABLE, "Status HP (short)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_02, czdec::reply_w_generic},	// 0x18 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x47, 0x01}, czcraft::KR_UNCRAFTABLE, "Status HP (short)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_02, czdec::reply_w_generic, 0},	// 0x18 bytes
 
 // read: 01 02 03 04 0B 09 01 85 03 52 12  => 17
 // reply:
@@ -497,7 +507,7 @@ except 1 time:
 */
 //       41 44 44 52 07 8A 65 6F DE 02 68 72 01 02 03 04 0B 09 01 85 03 C6 00 02 00 00 00 00 00 3C 0A DF 00 87 00 48 03 00 00 14 4F 04 29 00 00 86 12 00 00 00 00 00 00 23 2D 00 00 00 00 00 22 FC FF FF 00 00 00 00 00 00 00 00 00 00 00 00 00 00 FF FF FF 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 8D  => 68
 
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03}, czcraft::KR_UNCRAFTABLE, "Status xx (0x68 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_x68, czdec::reply_w_generic},	// 0x62 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0x85, 0x03}, czcraft::KR_UNCRAFTABLE, "Status xx (0x68 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_x68, czdec::reply_w_generic, 0},	// 0x62 bytes
 
 // read: 01 02 03 04 0B 09 01 B2 00 => 17
 /* replies:  => C7
@@ -505,11 +515,11 @@ except 1 time:
 41 44 44 52 07 8A 65 6F DE 02 C7 72 01 02 03 04 0B 09 01 B2 00 22 FC 22 FC 22 FC 22 FC 22 FC 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 02 00 00 00 04 04 00 00 09 02 01 00 CF 7C 62 42 11 00 6F 43 73 90 D3 43 EF FF 61 43 1D FE B1 43 2A B3 D5 43 A9 A7 C4 42 08 79 EC 43 FA B5 14 43 00 00 00 00 00 00 00 00 00 00 82 43 33 8A 62 42 11 00 6F 43 05 C6 D3 43 D4 FF 61 43 0E 50 B2 43 66 DC D5 43 66 97 BF 42 2E 65 EC 43 BF 32 13 43 00 00 00 00 00 00 00 00 00 00 82 43 0D 00 00 C0 20 20 20 20 00 00 44 00 70 00 89 00 00 00 00 00 FF 03 B0 03 88 13 1F 16 D0 18 EC 15 27
 41 44 44 52 07 8A 65 6F DE 02 C7 72 01 02 03 04 0B 09 01 B2 00 22 FC 22 FC 22 FC 22 FC 22 FC 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 01 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 11 00 64 42 11 00 70 43 EC FB D8 43 EF FF 60 43 33 40 2B 44 D3 8D E8 43 3C 00 A0 C0 4F F6 E4 43 61 00 E0 C0 00 00 00 00 00 00 00 00 00 00 82 43 11 00 64 42 11 00 70 43 EE ED D8 43 D4 FF 60 43 4C 41 2B 44 D8 85 E8 43 9D 02 A0 C0 A8 DD E4 43 08 04 E0 C0 00 00 00 00 00 00 00 00 00 00 82 43 0D 00 7F C0 21 21 21 21 00 00 4B 00 65 00 A0 00 BF 00 00 00 FF 03 AC 03 89 13 21 16 FD 18 EA 15 90
 */
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xB2, 0x00}, czcraft::KR_UNCRAFTABLE, "Status xx (0xc7 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_xc7, czdec::reply_w_generic},	// 0xc1 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xB2, 0x00}, czcraft::KR_UNCRAFTABLE, "Status xx (0xc7 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_xc7, czdec::reply_w_generic, 0},	// 0xc1 bytes
 
 // read: 01 02 03 04 0B 09 01 B3 04 => 17
 // reply always: 41 44 44 52 07 8A 65 6F DE 02 20 72 01 02 03 04 0B 09 01 B3 04 02 06 00 05 00 00 00 00 00 00 C7 => 20
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xB3, 0x04}, czcraft::KR_UNCRAFTABLE, "Status UI versions", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_ui_versions, czdec::reply_w_generic},	// 0x1A bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xB3, 0x04}, czcraft::KR_UNCRAFTABLE, "Status UI versions", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_ui_versions, czdec::reply_w_generic, 0},	// 0x1A bytes
 
 // read: 01 02 03 04 0B 09 01 C4 02 => 17
 /* replies:  => C5
@@ -517,7 +527,7 @@ except 1 time:
 41 44 44 52 07 8A 65 6F DE 02 C5 72 01 02 03 04 0B 09 01 C4 02 00 00 00 00 22 FC C8 00 1C 02 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 03 0A 22 02 00 00 00 00 26 02 B7 01 0B 01 5B 00 1D 00 D2 00 2A 00 00 00 3C 01 00 00 CC FC CC FC CC FC CC FC 00 00 00 00 00 00 00 00 D2 00 00 00 D2 00 34 03 A4 06 88 13 EB 00 1D 01 E0 01 00 00 00 00 00 00 FF 00 3B 01 FE 01 00 00 00 00 00 00 B4 14 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 D4 00 00 00 00 00 04 00 00 3C 00 00 B8 0B 00 00 00 00 00 00 30 2A 85 00 5A 00 3C 01 00 00 00 00 F4 FF F4 FF 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC A5
 41 44 44 52 07 8A 65 6F DE 02 C5 72 01 02 03 04 0B 09 01 C4 02 00 00 00 00 22 FC C8 00 1C 02 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 03 0A 22 02 00 00 00 00 26 02 DD 01 24 01 4F 00 24 00 E2 00 FB FF 00 00 3C 01 3C 01 4E FF 94 FF B8 FF FA FD 00 00 3C 01 3C 01 3C 01 D2 00 00 00 E2 00 34 03 1F 07 88 13 EB 00 1D 01 E0 01 00 00 00 00 00 00 FF 00 3B 01 FE 01 00 00 00 00 00 00 B4 14 00 00 96 09 00 00 00 00 96 09 00 00 96 09 00 00 73 04 00 00 00 00 00 00 08 00 00 3C 00 00 0A 01 00 00 00 00 00 00 30 2A 00 00 E7 03 00 00 DC 00 02 00 DC 00 DC 00 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 0C
 */
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xC4, 0x02}, czcraft::KR_UNCRAFTABLE, "Status xx (0xc5 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_xc5, czdec::reply_w_generic},	// 0xbf bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xC4, 0x02}, czcraft::KR_UNCRAFTABLE, "Status xx (0xc5 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_xc5, czdec::reply_w_generic, 0},	// 0xbf bytes
 
 // read: 01 02 03 04 0B 09 01 CC 02 => 17
 /* replies:  => AD
@@ -530,7 +540,7 @@ except 1 time:
 41 44 44 52 07 8A 65 6F DE 02 AD 72 01 02 03 04 0B 09 01 CC 02 1C 02 00 00 F5 06 98 04 00 00 00 00 00 00 00 00 00 03 0A 22 02 00 00 00 00 26 02 74 01 E3 00 6F 00 14 00 B6 00 6A 00 00 00 3C 01 00 00 CC FC CC FC CC FC CC FC 00 00 00 00 00 00 00 00 00 00 00 00 D2 00 34 03 A4 06 88 13 EB 00 1D 01 E0 01 00 00 00 00 00 00 FF 00 3B 01 FE 01 00 00 00 00 00 00 B4 14 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 3B 00 00 00 00 00 01 00 00 3C 00 00 B8 0B 00 00 00 00 00 00 30 2A 00 00 5A 00 00 00 00 00 00 00 EE FF 56
 41 44 44 52 07 8A 65 6F DE 02 AD 72 01 02 03 04 0B 09 01 CC 02 1C 02 00 00 F7 05 9A 03 00 00 00 00 00 00 00 00 00 03 0A 22 02 00 00 00 00 26 02 E0 01 26 01 57 00 21 00 E3 00 19 00 00 00 3C 01 3C 01 51 FF 7D FF B0 FF AD FD 00 00 3C 01 3C 01 3C 01 00 00 00 00 E3 00 34 03 27 07 88 13 EB 00 1D 01 E0 01 00 00 00 00 00 00 FF 00 3B 01 FE 01 00 00 00 00 00 00 B4 14 00 00 96 09 00 00 00 00 96 09 00 00 96 09 00 00 79 04 00 00 00 00 C6 02 02 00 00 3C 00 00 F9 0A 00 00 00 00 00 00 30 2A 00 00 5A 00 00 00 DC 00 C0 FF 9C 00 ED
 */
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xCC, 0x02}, czcraft::KR_UNCRAFTABLE, "Status xx (0xad bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_xad, czdec::reply_w_generic},	// 0xa7 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xCC, 0x02}, czcraft::KR_UNCRAFTABLE, "Status xx (0xad bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_xad, czdec::reply_w_generic, 0},	// 0xa7 bytes
 
 // read: 01 02 03 04 0B 09 01 F5 01 => 18
 /* replies:  => 40
@@ -554,20 +564,20 @@ except 1 time:
 41 44 44 52 07 8A 65 6F DE 02 40 72 01 02 03 04 0B 09 01 F5 01 47 01 00 00 00 00 00 00 00 00 28 00 E2 00 E2 01 1B 01 00 00 FD 02 51 03 00 00 00 00 00 00 51 03 00 00 78 00 78 00 E0 01 D2 00 D8
 41 44 44 52 07 8A 65 6F DE 02 40 72 01 02 03 04 0B 09 01 F5 01 E2 00 9C FF 00 00 00 00 00 00 28 00 E1 00 71 03 8C FF 00 00 FD 02 51 03 00 00 00 00 00 00 51 03 00 00 78 00 78 00 E0 01 D2 00 44
 */
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xF5, 0x01}, czcraft::KR_UNCRAFTABLE, "Status xx (0x40 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_x40, czdec::reply_w_generic},	// 0x38 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x01, 0xF5, 0x01}, czcraft::KR_UNCRAFTABLE, "Status xx (0x40 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_x40, czdec::reply_w_generic, 0},	// 0x38 bytes
 
 
 // read: 01 02 03 04 0B 09 03 14 0F => 17 ?? Always the same reply:
 // 41 44 44 52 07 8A 65 6F DE 02 26 72 01 02 03 04 0B 09 03 14 0F 09 00 00 08 09 17 32 07 00 00 00 08 00 00 00 07 2D => 26
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x03, 0x14, 0x0F}, czcraft::KR_UNCRAFTABLE, "Status xx (0x26 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_x26, czdec::reply_w_generic},	// 0x1E bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x03, 0x14, 0x0F}, czcraft::KR_UNCRAFTABLE, "Status xx (0x26 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_x26, czdec::reply_w_generic, 0},	// 0x1E bytes
 
 // read: 01 02 03 04 0B 09 03 21 0F => 17
 // reply: always 41 44 44 52 07 8A 65 6F DE 02 6D 72 01 02 03 04 0B 09 03 21 0F 00 00 07 01 02 00 06 00 01 01 00 00 01 01 00 00 01 01 00 00 01 01 00 00 01 01 00 00 01 01 00 00 01 01 00 00 01 01 00 00 01 01 00 00 01 01 00 00 01 01 00 00 01 01 00 00 01 01 00 00 01 01 00 00 01 01 00 00 01 01 00 00 01 01 00 00 01 01 00 00 01 01 00 00 01 01 00 77 => 6D
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x03, 0x21, 0x0F}, czcraft::KR_UNCRAFTABLE, "Status xx (0x6d bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_x6d, czdec::reply_w_generic},	// 0x69 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x03, 0x21, 0x0F}, czcraft::KR_UNCRAFTABLE, "Status xx (0x6d bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_x6d, czdec::reply_w_generic, 0},	// 0x69 bytes
 
 // 01 02 03 04 0B 09 03 6F 0E ?? Always the same reply:
 // 41 44 44 52 07 8A 65 6F DE 02 58 72 01 02 03 04 0B 09 03 6F 0E 11 03 12 00 00 00 00 00 00 1D 0C 16 0C 00 00 01 12 00 00 00 00 00 00 07 01 17 12 30 15 02 12 00 00 00 00 00 00 07 01 17 12 30 19 03 12 00 00 00 00 00 00 08 01 17 0B 39 17 00 00 00 00 00 00 00 00 00 E1 => 58
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x03, 0x6F, 0x0E}, czcraft::KR_UNCRAFTABLE, "Status xx (0x58 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_x58, czdec::reply_w_generic},	// 0x52 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x03, 0x6F, 0x0E}, czcraft::KR_UNCRAFTABLE, "Status xx (0x58 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_x58, czdec::reply_w_generic, 0},	// 0x52 bytes
 
 
 // read:  01 02 03 04 0B 09 03 BD 0D B2 DB  => 17 ??? no reply
@@ -577,11 +587,11 @@ except 1 time:
 
 // read: 01 02 03 04 0B 09 04 4E 3F => 17
 // reply always : 41 44 44 52 07 8A 65 6F DE 02 2C 72 01 02 03 04 0B 09 04 4E 3F 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 6A => 2C
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x04, 0x4E, 0x3F}, czcraft::KR_UNCRAFTABLE, "Status xx (0x2c bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_x2c, czdec::reply_w_generic},	// 0x26 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x04, 0x4E, 0x3F}, czcraft::KR_UNCRAFTABLE, "Status xx (0x2c bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_x2c, czdec::reply_w_generic, 0},	// 0x26 bytes
 
 // read: 01 02 03 04 0B 09 04 9C 3E => 17
 // reply always : 41 44 44 52 07 8A 65 6F DE 02 C8 72 01 02 03 04 0B 09 04 9C 3E 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 EF  => C8
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x04, 0x9C, 0x3E}, czcraft::KR_UNCRAFTABLE, "Status xx (random mapping 6, not decoded)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_19, czdec::reply_w_generic},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x04, 0x9C, 0x3E}, czcraft::KR_UNCRAFTABLE, "Status xx (random mapping 6, not decoded)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_19, czdec::reply_w_generic, 0},	// 0xC2 bytes
 
 // 01 02 03 04 0B 09 05 28 00  => 17
 /* replies: => 2E
@@ -616,7 +626,7 @@ except 1 time:
 41 44 44 52 07 8A 65 6F DE 02 2E 72 01 02 03 04 0B 09 05 28 00 00 00 00 00 0E FC 3A 00 77 71 05 00 14 42 0F 00 27 87 0B 00 79 56 1D 00 AB
 41 44 44 52 07 8A 65 6F DE 02 2E 72 01 02 03 04 0B 09 05 28 00 00 00 00 00 0F FC 3A 00 77 71 05 00 14 42 0F 00 27 87 0B 00 79 56 1D 00 60
 */
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00}, czcraft::KR_UNCRAFTABLE, "Status HP runtime and energy", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_runtime_and_energy, czdec::reply_w_generic},	// 0x28 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x28, 0x00}, czcraft::KR_UNCRAFTABLE, "Status HP runtime and energy", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_runtime_and_energy, czdec::reply_w_generic, 0},	// 0x28 bytes
 
 // 01 02 03 04 0B 09 04 9C 3E ??
 
@@ -624,8 +634,8 @@ except 1 time:
 //        01 02 03 04 0B 09 41 17 00 FE FF ..  => 18    reply: 41 44 44 52 07 8A 65 6F DE 02 17 77 01 02 03 04 0B 09 41 17 00 6E ..  => 17
 // write: 01 02 03 04 0B 09 41 17 00 FF FE ..  => 18    reply: 41 44 44 52 07 8A 65 6F DE 02 17 77 01 02 03 04 0B 09 41 17 00 4A ..  => 17
 // read:  01 02 03 04 0B 09 01 17 00 02 ..  => 17       reply: 41 44 44 52 07 8A 65 6F DE 02 18 72 01 02 03 04 0B 09 01 17 00 08 4A ..  => 18
-		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x41, 0x17, 0x00}, czcraft::KR_EXTRA_HOT_WATER_OFF, "Extra hot water - off", czdec::cmd_r_generic, czdec::cmd_w_extra_hot_water, czdec::reply_r_extra_hot_water, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x81, 0x17, 0x00}, czcraft::KR_EXTRA_HOT_WATER_ON, "Extra hot water - on", czdec::cmd_r_generic, czdec::cmd_w_extra_hot_water, czdec::reply_r_extra_hot_water, czdec::reply_w_generic},
+		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x41, 0x17, 0x00}, czcraft::KR_EXTRA_HOT_WATER_OFF, "Extra hot water - off", czdec::cmd_r_generic, czdec::cmd_w_extra_hot_water, czdec::reply_r_extra_hot_water, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x81, 0x17, 0x00}, czcraft::KR_EXTRA_HOT_WATER_ON, "Extra hot water - on", czdec::cmd_r_generic, czdec::cmd_w_extra_hot_water, czdec::reply_r_extra_hot_water, czdec::reply_w_generic, 0},
 
 /* read:  01 02 04 0B 09 00 2C 03 B2 0C 41  => 17 ???   reply:
 41 44 44 52 07 8A 65 6F DE 02 C8 72 01 02 03 04 0B 09 00 2C 03 64 00 64 00 B4 00 BC 02 C8 00 F4 01 78 00 58 02 00 00 02 64 00 05 78 00 1E 00 52 03 2C 01 0C FE C8 00 0A 00 8C 0A 0C FE 1E 0C FE 58 02 D0 07 58 02 9C FF AC 0D FA 00 2C 01 5E 01 90 01 90 01 90 01 5E 01 2C 01 14 14 14 14 14 14 14 14 00 00 00 12 90 01 C8 00 14 00 DE 00 F9 00 10 01 27 01 3B 01 4E 01 00 00 FF 1C 02 0F 00 92 FF 8D FF 88 FF 83 FF 7E FF 79 FF 74 FF 6F FF 6A FF 65 FF 60 FF 5B FF 5B FF 5B FF 5B FF CE FF CE FF CE FF C9 FF C4 FF C4 FF BF FF BF FF BA FF BA FF B5 FF B5 FF B5 FF B5 FF B5 FF F1 FF EC FF E7 FF E2 FF DD FF D8 FF C3  => C8
@@ -636,7 +646,7 @@ except 1 time:
 // 01 02 03 04 0B 09 03 0B 0D => 17
 // always same reply: 41 44 44 52 07 8A 65 6F DE 02 C8 72 01 02 03 04 0B 09 03 0B 0D 0C 08 01 17 0C 00 00 01 12 00 00 00 00 00 00 09 01 17 00 02 0F 02 12 00 00 00 00 00 00 09 01 17 00 02 11 03 12 00 00 00 00 00 00 09 01 17 00 02 32 01 12 00 00 00 00 00 00 09 01 17 06 0D 39 02 12 00 00 00 00 00 00 09 01 17 06 0E 00 03 12 00 00 00 00 00 00 09 01 17 0C 00 00 01 12 00 00 00 00 00 00 09 01 17 0C 00 26 02 12 00 00 00 00 00 00 09 01 17 0C 00 2A 03 12 00 00 00 00 00 00 09 01 17 0C 33 17 01 12 00 00 00 00 00 00 09 01 17 0C 33 21 02 12 00 00 00 00 00 00 09 01 17 0C 33 26 03 12 00 00 00 00 00 00 0E 0C 16 0C 38 09 00 00 00 A6 => C8
 
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x03, 0x0B, 0x0D}, czcraft::KR_UNCRAFTABLE, "Status xx (random mapping 3, not decoded)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_19, czdec::reply_w_generic},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x03, 0x0B, 0x0D}, czcraft::KR_UNCRAFTABLE, "Status xx (random mapping 3, not decoded)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_19, czdec::reply_w_generic, 0},	// 0xC2 bytes
 
 // 01 02 03 04 0B 09 03 BD 0D B2 DB  => 17
 //   reply: 41 44 44 52 07 8A 65 6F DE 02 C8 72 01 02 03 04 0B 09 03 BD 0D 00 00 00 00 00 0B 01 17 16 10 30 02 12 00 00 00 00 00 00 0B 01 17 16 10 32 03 12 00 00 00 00 00 00 0B 01 17 16 11 15 01 12 00 00 00 00 00 00 0B 01 17 16 11 21 02 12 00 00 00 00 00 00 1A ** 0C 16 0C 00 00 01 12 ** 00 00 00 00 00 00 1A 0C 16 10 37 37 02 12 00 00 00 00 00 00 1A 0C 16 10 3A 21 03 12 00 00 00 00 00 00 1B 0C 16 0C 00 00 01 12 00 00 00 00 00 00 1B 0C 16 0D 16 26 02 12 00 00 00 00 00 00 1B 0C 16 0D 16 2A 03 12 00 00 00 00 00 00 1C 0C 16 0C 00 00 01 12 00 00 00 00 00 00 1C 0C 16 0D 2F 0E 02 12 00 00 00 00 00 00 1C 0C 16 0D 2F 2A  => C8
@@ -644,7 +654,7 @@ except 1 time:
 //   reply: 41 44 44 52 07 8A 65 6F DE 02 C8 72 01 02 03 04 0B 09 03 BD 0D 00 00 00 00 00 0B 01 17 16 10 30 02 12 00 00 00 00 00 00 0B 01 17 16 10 32 03 12 00 00 00 00 00 00 0B 01 17 16 11 15 01 12 00 00 00 00 00 00 0B 01 17 16 11 21 02 12 00 00 00 00 00 00 0B ** 01 17 16 11 25 03 12 ** 00 00 00 00 00 00 1A 0C 16 10 37 37 02 12 00 00 00 00 00 00 1A 0C 16 10 3A 21 03 12 00 00 00 00 00 00 1B 0C 16 0C 00 00 01 12 00 00 00 00 00 00 1B 0C 16 0D 16 26 02 12 00 00 00 00 00 00 1B 0C 16 0D 16 2A 03 12 00 00 00 00 00 00 1C 0C 16 0C 00 00 01 12 00 00 00 00 00 00 1C 0C 16 0D 2F 0E 02 12 00 00 00 00 00 00 1C 0C 16 0D 2F 18  => C8
 
 		//{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x03, 0xBD, 0x0D}, czcraft::KR_UNCRAFTABLE, "Status xx (random mapping 2, not decoded)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_19, czdec::reply_w_generic},	// 0xC2 bytes
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x03, 0xBD, 0x0D}, czcraft::KR_UNCRAFTABLE, "Status C8A", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_c8a, czdec::reply_w_generic},	// 0xC2 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x03, 0xBD, 0x0D}, czcraft::KR_UNCRAFTABLE, "Status C8A", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_c8a, czdec::reply_w_generic, 0},	// 0xC2 bytes
 
 // read:  01 90 01 C8 00 14 00 DE 00 F9 00  => 17 ??? no reply
 
@@ -652,7 +662,7 @@ except 1 time:
 41 44 44 52 07 8A 65 6F DE 02 56 72 01 02 03 04 0B 09 05 00 00 37 07 22 01 11 01 23 00 00 00 00 00 01 01 01 01 56 14 00 00 17 0F 00 00 9F 0A 00 00 65 06 00 00 00 00 00 00 BC 34 00 00 00 00 00 00 33 FC 3A 00 77 71 05 00 39 42 0F 00 30 87 0B 00 86 56 1D 00 0E
 41 44 44 52 07 8A 65 6F DE 02 56 72 01 02 03 04 0B 09 05 00 00 33 59 21 01 11 01 23 00 00 00 00 00 00 00 00 00 56 14 00 00 17 0F 00 00 9F 0A 00 00 65 06 00 00 00 00 00 00 BC 34 00 00 00 00 00 00 21 FC 3A 00 77 71 05 00 26 42 0F 00 2C 87 0B 00 7E 56 1D 00 A3
 */
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x00, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 08", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_08, czdec::reply_w_generic},	// 0x50 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x09, 0x05, 0x00, 0x00}, czcraft::KR_UNCRAFTABLE, "Status 08", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_08, czdec::reply_w_generic, 0},	// 0x50 bytes
 
 // write:  01 02 03 04 0B 09 81 17 00 ???
 /*
@@ -676,16 +686,19 @@ reply 41 44 44 52 07 8A 65 6F DE 02 17 77 01 02 03 04 0B 09 81 17 00 6C C0  => 1
 // read:  01 02 03 04 0B 09 01 29 00 02 D1  => 17 
 // reply: 01 02 03 04 0B 09 01 29 00 02 00 10  => 18
 
+	};
 #endif
 
-#if HP_PROTOCOL == HP_PROTOCOL_2_21
+#if HP_WITH_PROTOCOL(HP_PROTOCOL_2_21)
+static constexpr czdec::KNOWN_REGISTER kr_decoder_v221[] =
+	{
 		// 41 44 44 52 07 8A 65 6F DE 02 C1 72 01 02 03 04 0B 0D 00 87 02 - 00 06 00 00 FF 00 00 FF 28 F0 00 14 00 32 00 CE FF 05 FA ED E8 E9 E8 F6 00 1C 01 3E 01 5E 01 7D 01 9B 01 1E 00 28 00 1E 00 64 00 32 00 B0 04 5A 00 B0 04 5A 00 46 00 B4 00 50 00 78 00 FA 00 32 00 12 FD 1E 00 A8 FD 80 0C E0 FC A0 0F DC 05 1E 00 64 00 64 00 96 00 C2 01 BC 02 C8 00 F4 01 78 00 58 02 EC FF 02 64 00 05 78 00 1E 00 EE 02 FA 00 FF 0C FE C8 00 0A 00 8C 0A 0C FE 1E 0C FE 58 02 D0 07 58 02 9C FF 54 0B FA 00 2C 01 5E 01 90 01 C2 01 90 01 5E 01 2C 01 14 14 14 14 14 14 14 14 00 00 00 1E 90 01 C8 00 14 00 73
 		// 41 44 44 52 07 8A 65 6F DE 02 C1 72 01 02 03 04 0B 0D 00 87 02 - 00 06 00 00 FF 01 00 07 28 F0 00 14 00 32 00 CE FF 05 FA ED E8 E9 E8 F6 00 1C 01 3E 01 5E 01 7D 01 9B 01 1E 00 28 00 1E 00 64 00 32 00 B0 04 5A 00 B0 04 5A 00 46 00 B4 00 50 00 78 00 FA 00 32 00 12 FD 1E 00 A8 FD 80 0C E0 FC A0 0F DC 05 1E 00 64 00 64 00 96 00 C2 01 BC 02 C8 00 F4 01 78 00 58 02 EC FF 02 64 00 05 78 00 1E 00 EE 02 FA 00 FF 0C FE C8 00 0A 00 8C 0A 0C FE 1E 0C FE 58 02 D0 07 58 02 9C FF 54 0B FA 00 2C 01 5E 01 90 01 C2 01 90 01 5E 01 2C 01 14 14 14 14 14 14 14 14 00 00 00 1E 90 01 C8 00 14 00 1C
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x87, 0x02}, czcraft::KR_UNCRAFTABLE, "Status xx (0xc1 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v221_xc1, czdec::reply_w_generic},	// 0xc1 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x87, 0x02}, czcraft::KR_UNCRAFTABLE, "Status xx (0xc1 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v221_xc1, czdec::reply_w_generic, 0},	// 0xc1 bytes
 
-		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x90, 0x02}, czcraft::KR_ROOM_HEATING_TEMP, "Heating calculated setting", czdec::cmd_r_generic, czdec::cmd_w_temp, czdec::reply_r_temp, czdec::reply_w_generic},
+		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x90, 0x02}, czcraft::KR_ROOM_HEATING_TEMP, "Heating calculated setting", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP>, czdec::reply_r_scalar<CZ_SCALAR_TEMP>, czdec::reply_w_generic, 0},
 
-		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0xD5, 0x03}, czcraft::KR_FAN_SPEED, "Fan speed", czdec::cmd_r_generic, czdec::cmd_w_fan_speed, czdec::reply_r_fan_speed, czdec::reply_w_generic},
+		/* @OK */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0xD5, 0x03}, czcraft::KR_FAN_SPEED, "Fan speed", czdec::cmd_r_generic, czdec::cmd_w_fan_speed, czdec::reply_r_fan_speed, czdec::reply_w_generic, 0},
 
 		// 41 44 44 52 07 8A 65 6F DE 02 88 72 01 02 03 04 0B 0D 01 04 00 - 0F 18 08 0A 0C 17 07 00 0F 18 08 00 00 40 00 41 00 00 04 08 2C 00 81 10 00 04 00 00 08 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 41*19 FC 19 FC 76 00 F1 00 A4 01 F0 00 FA 01 B1 01 61 00 1E 00 22 FC 22 FC D4 FE 22 FC 22 FC*22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 92 01 4C 00 1A 00 0F 00*8B 00 00 00 E8 03 3B
 		// 41 44 44 52 07 8A 65 6F DE 02 88 72 01 02 03 04 0B 0D 01 04 00 - 0F 18 0A 0A 0C 17 07 00 0F 18 0A 00 00 40 00 41 00 00 04 08 2C 00 81 10 00 04 00 00 08 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 41 19 FC 19 FC 76 00 F1 00 A5 01 F0 00 FA 01 B2 01 60 00 1E 00 22 FC 22 FC D4 FE 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 92 01 3A 00 0D 00 16 00 8B 00 00 00 E8 03 01
@@ -726,7 +739,8 @@ reply 41 44 44 52 07 8A 65 6F DE 02 17 77 01 02 03 04 0B 09 81 17 00 6C C0  => 1
 		// 41 44 44 52 07 8A 65 6F DE 02 88 72 01 02 03 04 0B 0D 01 04 00 - 10 00 2E 0A 0C 17 07 00 10 00 2E 00 00 40 00 41 00 00 04 08 08 00 89 10 00 04 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 41 19 FC 19 FC 74 00 F3 00 E3 00 F4 00 49 01 DA 00 B3 00 AE 00 22 FC 22 FC D4 FE 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC C7 01 36 00 15 00 11 00 00 00 00 00 E8 03 ED
 		// 41 44 44 52 07 8A 65 6F DE 02 88 72 01 02 03 04 0B 0D 01 04 00 - 10 00 31 0A 0C 17 07 00 10 00 31 00 00 40 00 41 00 00 04 08 08 00 89 10 00 04 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 41 19 FC 19 FC 74 00 F3 00 E3 00 F4 00 48 01 DA 00 B3 00 AE 00 22 FC 22 FC D4 FE 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC C7 01 40 00 14 00 11 00 00 00 00 00 E8 03 E6
 		// 41 44 44 52 07 8A 65 6F DE 02 88 72 01 02 03 04 0B 0D 01 04 00 - 10 00 34 0A 0C 17 07 00 10 00 34 00 00 40 00 41 00 00 04 08 08 00 89 10 00 04 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 41 19 FC 19 FC 74 00 F1 00 E3 00 F4 00 48 01 DA 00 B3 00 AE 00 22 FC 22 FC D4 FE 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC 22 FC C7 01 3C 00 12 00 14 00 00 00 00 00 E8 03 98
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00}, czcraft::KR_UNCRAFTABLE, "Status xx (0x88 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v221_x88, czdec::reply_w_generic},	// 0x88 bytes
+		// same reg_num as "Hour" (other reply sizes)
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00}, czcraft::KR_UNCRAFTABLE, "Status xx (0x88 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v221_x88, czdec::reply_w_generic, sizeof(R_REPLY_STATUS_V221_x88)},	// 0x88 bytes
 
 		// 41 44 44 52 07 8A 65 6F DE 02 51 72 01 02 03 04 0B 0D 01 CD 02 - 01 02 F8 02 00 00 00 00 C2 01 5E 01 EE 02 00*B9 01 11 01 6D 00 19 00 D3 00 61 00 61 00 00 00 D3 00 D3 00*53 FF 9E FF 9C FF DA FD 00 00 D3 00 D3 00 D3 00 00 00 00 00 00 00 00 00 2D
 		// 41 44 44 52 07 8A 65 6F DE 02 51 72 01 02 03 04 0B 0D 01 CD 02 - 01 02 F8 02 00 00 00 00 C2 01 5E 01 EE 02 00 BA 01 12 01 6C 00 19 00 D3 00 5C 00 5C 00 00 00 D3 00 D3 00 54 FF A0 FF 9C FF DA FD 00 00 D3 00 D3 00 D3 00 00 00 00 00 00 00 00 00 76
@@ -748,7 +762,7 @@ reply 41 44 44 52 07 8A 65 6F DE 02 17 77 01 02 03 04 0B 09 81 17 00 6C C0  => 1
 		// 41 44 44 52 07 8A 65 6F DE 02 51 72 01 02 03 04 0B 0D 01 CD 02 - 01 02 F8 02 00 00 00 00 FA 00 5E 01 EE 02 00 DF 00 9D 00 8A 00 0B 00 75 00 AF 00 AF 00 00 00 00 00 00 00 DA FD DA FD DA FD DA FD 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 F7
 		// 41 44 44 52 07 8A 65 6F DE 02 51 72 01 02 03 04 0B 0D 01 CD 02 - 01 02 F8 02 00 00 00 00 FA 00 5E 01 EE 02 00 E0 00 9D 00 89 00 0B 00 75 00 AE 00 AE 00 00 00 00 00 00 00 DA FD DA FD DA FD DA FD 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 B3
 		// 41 44 44 52 07 8A 65 6F DE 02 51 72 01 02 03 04 0B 0D 01 CD 02 - 01 02 F8 02 00 00 00 00 FA 00 5E 01 EE 02 00 E1 00 9E 00 89 00 0B 00 76 00 AE 00 AE 00 00 00 00 00 00 00 DA FD DA FD DA FD DA FD 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 53
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xCD, 0x02}, czcraft::KR_UNCRAFTABLE, "Status xx (0x51 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v221_x51, czdec::reply_w_generic},	// 0x51 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0xCD, 0x02}, czcraft::KR_UNCRAFTABLE, "Status xx (0x51 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v221_x51, czdec::reply_w_generic, 0},	// 0x51 bytes
 
 		// UNK:41 44 44 52 07 8A 65 6F DE 02 17 77 01 02 03 04 0B 0D 00 41 03 - 01 EE  => 17
 		// UNK:65 6F DE 02 D3 5E 41 44 44 52 18 57 01 02 03 04 0B 0D 00 41 03 B8 01 01  => 18
@@ -757,7 +771,8 @@ reply 41 44 44 52 07 8A 65 6F DE 02 17 77 01 02 03 04 0B 09 81 17 00 6C C0  => 1
 		// UNK:41 44 44 52 07 8A 65 6F DE 02 C5 72 01 02 03 04 0B 0D 00 41 03 C2 01 0F 00 92 FF 8D FF 88 FF 83 FF 7E FF 79 FF 74 FF 6F FF 6A FF 65 FF 60 FF 5B FF 5B FF 5B FF 5B FF CE FF CE FF C9 FF C9 FF C4 FF C4 FF BF FF BF FF BA FF BA FF B5 FF B5 FF B5 FF B5 FF B5 FF F1 FF EC FF E7 FF E2 FF DD FF D8 FF D3 FF CE FF C9 FF C4 FF BF FF BA FF BA FF BA FF BA FF 05 1E 14 7E FF 74 FF 92 FF 88 FF CE FF C4 FF F1 FF E7 FF 96 00 68 01 C2 01 7E FF 26 02 B4 00 8A 02 DA 02 0A 1E 1E F4 01 32 00 58 02 68 01 90 01 26 02 58 02 58 02 02 F8 02 D4 FE E8 03 00 00 FA 00 8A 02 8A 02 EE 02 48 03 B6 03 E8 03 D4 FE BC 02 AF  => C5
 		// this command is weird, the write command works like a 2-bytes parameter command.
 		// the read command is a 1-byte parameter command. However, if the read parameter is 0x02, the reply is like a 2-bytes parameter command reply but if the read parameter is 0xAF, the reply is a status frame
-		/* @OK* */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x41, 0x03}, czcraft::KR_HOT_WATER_TEMP, "Hot water calculated setting", czdec::cmd_r_generic, czdec::cmd_w_temp, czdec::reply_r_temp_or_r_status_v221_xc5, czdec::reply_w_generic},
+		/* @OK* */ { {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x41, 0x03}, czcraft::KR_HOT_WATER_TEMP, "Hot water calculated setting", czdec::cmd_r_generic, czdec::cmd_w_scalar<CZ_SCALAR_TEMP>, czdec::reply_r_scalar<CZ_SCALAR_TEMP>, czdec::reply_w_generic, sizeof(R_REPLY)},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0x41, 0x03}, czcraft::KR_UNCRAFTABLE, "Status xx (0xc5 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v221_xc5, czdec::reply_w_generic, sizeof(R_REPLY_STATUS_V221_xc5)},
 
 		// 41 44 44 52 07 8A 65 6F DE 02 17 77 01 02 03 04 0B 0D 00 8C 02 - 00 37  => 17
 
@@ -791,7 +806,7 @@ reply 41 44 44 52 07 8A 65 6F DE 02 17 77 01 02 03 04 0B 09 81 17 00 6C C0  => 1
 		// 41 44 44 52 07 8A 65 6F DE 02 2E 72 01 02 03 04 0B 0D 05 28 00 - 00 00 00 00 53 83 1C 00 30 1D 01 00 A6 9B 0C 00 37 E0 07 00 62 00 15 00 35  => 2E
 		// 41 44 44 52 07 8A 65 6F DE 02 2E 72 01 02 03 04 0B 0D 05 28 00 - 00 00 00 00 AA 83 1C 00 30 1D 01 00 FD 9B 0C 00 55 E0 07 00 85 00 15 00 9A  => 2E
 		// 41 44 44 52 07 8A 65 6F DE 02 2E 72 01 02 03 04 0B 0D 05 28 00 - 00 00 00 00 AA 83 1C 00 30 1D 01 00 FD 9B 0C 00 55 E0 07 00 86 00 15 00 12  => 2E
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x05, 0x28, 0x00}, czcraft::KR_UNCRAFTABLE, "Status HP runtime and energy", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_runtime_and_energy, czdec::reply_w_generic},	// 0x2e bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x05, 0x28, 0x00}, czcraft::KR_UNCRAFTABLE, "Status HP runtime and energy", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v180_runtime_and_energy, czdec::reply_w_generic, 0},	// 0x2e bytes
 
 		// 41 44 44 52 07 8A 65 6F DE 02 32 72 01 02 03 04 0B 0D 01 4B 05 - 02 0C 01 06 03 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 25  => 32
 
@@ -804,7 +819,7 @@ reply 41 44 44 52 07 8A 65 6F DE 02 17 77 01 02 03 04 0B 09 81 17 00 6C C0  => 1
 		// 41 44 44 52 07 8A 65 6F DE 02 51 72 01 02 03 04 0B 0D 00 F2 03 - 32 00 25 00 2C 01 0A 01 14 05 28 0A 00 1E 32 90 01 2C 01 28 14 05 05 0A B0 04 C4 09 AC 0D 96 00 26 02 26 02 FA 00 14 26 02 BC 02 34 03 FC 03 1A 04 00 00 00 00 00 00 00 00 00 00 FE  => 51
 		// 41 44 44 52 07 8A 65 6F DE 02 51 72 01 02 03 04 0B 0D 00 F2 03 - 32 00 27 00 2C 01 0A 01 14 05 28 0A 00 1E 32 90 01 2C 01 28 14 05 05 0A B0 04 C4 09 AC 0D 96 00 26 02 26 02 FA 00 14 26 02 BC 02 34 03 FC 03 1A 04 00 00 00 00 00 00 00 00 00 00 D7  => 51
 		// 41 44 44 52 07 8A 65 6F DE 02 51 72 01 02 03 04 0B 0D 00 F2 03 - 32 00 29 00 2C 01 0A 01 14 05 28 0A 00 1E 32 90 01 2C 01 28 14 05 05 0A B0 04 C4 09 AC 0D 96 00 26 02 26 02 FA 00 14 26 02 BC 02 34 03 FC 03 1A 04 00 00 00 00 00 00 00 00 00 00 08  => 51
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0xF2, 0x03}, czcraft::KR_UNCRAFTABLE, "Status xx (0xF2 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v221_xf2, czdec::reply_w_generic},	// 0x51 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x00, 0xF2, 0x03}, czcraft::KR_UNCRAFTABLE, "Status xx (0xF2 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v221_xf2, czdec::reply_w_generic, 0},	// 0x51 bytes
 
 
 		// 41 44 44 52 07 8A 65 6F DE 02 56 72 01 02 03 04 0B 0D 05 00 00 - 05 01 16 01 10 12 23 00 00 00 00 00 28 28 28 28 04 03 00 00 B9 02 00 00 83 02 00 00 56 02 00 00 00 00 00 00 40 1F 00 00 00 00 00 00 AA 83 1C 00 30 1D 01 00 FD 9B 0C 00 55 E0 07 00 86 00 15 00 34
@@ -899,7 +914,7 @@ reply 41 44 44 52 07 8A 65 6F DE 02 17 77 01 02 03 04 0B 09 81 17 00 6C C0  => 1
 		// 41 44 44 52 07 8A 65 6F DE 02 B9 72 01 02 03 04 0B 0D 01 3C 03 - 6E 06 00 00 00 00 6E 06 00 00 6E 06 00 00 56 03 00 00 00 00 BD 01 00 0A 00 00 3C 00 00 FA 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 FF FF 00 00 00 00 00 00 00 00 00 00 B8 0B 00 00 00 00 00 00 30 2A 00 00 60 00 00 00 25 01 1B FF 40 00 92 00 92 00 05 00 00 00 00 00 E5 10 5F 03 50 00 48 03 00 00 52 89 30 75 00 00 DE 62 00 00 00 00 00 00 2A 24 00 00 00 00 00 22 FC FF FF 00 00 00 00 00 00 00 00 00 00 00 00 01 07 AA 05 AA 05 AA 05 FF FF 00 00 FF FF FF 13 00 00 0D 2C  => B9
 		// 41 44 44 52 07 8A 65 6F DE 02 B9 72 01 02 03 04 0B 0D 01 3C 03 - 6E 06 00 00 00 00 6E 06 00 00 6E 06 00 00 56 03 00 00 00 00 BF 01 00 0C 00 00 3C 00 00 FA 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 FF FF 00 00 00 00 00 00 00 00 00 00 B8 0B 00 00 00 00 00 00 30 2A 00 00 60 00 00 00 25 01 1C FF 40 00 93 00 93 00 00 00 00 00 00 00 E5 10 5F 03 50 00 48 03 00 00 76 7C 30 75 00 00 02 56 00 00 00 00 00 00 28 22 00 00 00 00 00 22 FC FF FF 00 00 00 00 00 00 00 00 00 00 00 00 01 07 AA 05 AA 05 AA 05 FF FF 00 00 FF FF FF 12 00 00 0D E0  => B9
 		// 41 44 44 52 07 8A 65 6F DE 02 B9 72 01 02 03 04 0B 0D 01 3C 03 - 6E 06 00 00 00 00 6E 06 00 00 6E 06 00 00 58 03 00 00 00 00 91 01 00 0B 00 00 3C 00 00 FA 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 FF FF 00 00 00 00 00 00 00 00 00 00 B8 0B 00 00 00 00 00 00 30 2A 00 00 60 00 00 00 25 01 1D FF 42 00 90 00 90 00 00 00 00 00 00 00 E5 10 5F 03 50 00 48 03 00 00 FA 8A 30 75 00 00 86 64 00 00 00 00 00 00 1A 14 00 00 00 00 00 22 FC FF FF 00 00 00 00 00 00 00 00 00 00 00 00 01 07 AA 05 AA 05 AA 05 FF FF 00 00 FF FF FF 13 00 00 0D 2F  => B9
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03}, czcraft::KR_UNCRAFTABLE, "Status xx (0xb9 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v221_xb9, czdec::reply_w_generic},	// 0xb9 bytes
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x3C, 0x03}, czcraft::KR_UNCRAFTABLE, "Status xx (0xb9 bytes long frame)", czdec::cmd_r_generic, czdec::empty, czdec::reply_r_status_v221_xb9, czdec::reply_w_generic, 0},	// 0xb9 bytes
 
 
 		// 41 44 44 52 07 8A 65 6F DE 02 C5 72 01 02 03 04 0B 0D 00 41 03 - B8 01 0F 00 92 FF 8D FF 88 FF 83 FF 7E FF 79 FF 74 FF 6F FF 6A FF 65 FF 60 FF 5B FF 5B FF 5B FF 5B FF CE FF CE FF C9 FF C9 FF C4 FF C4 FF BF FF BF FF BA FF BA FF B5 FF B5 FF B5 FF B5 FF B5 FF F1 FF EC FF E7 FF E2 FF DD FF D8 FF D3 FF CE FF C9 FF C4 FF BF FF BA FF BA FF BA FF BA FF 05 1E 14 7E FF 74 FF 92 FF 88 FF CE FF C4 FF F1 FF E7 FF 96 00 68 01 C2 01 7E FF 26 02 B4 00 8A 02 DA 02 0A 1E 1E F4 01 32 00 58 02 68 01 90 01 26 02 58 02 58 02 02 F8 02 D4 FE E8 03 00 00 FA 00 8A 02 8A 02 EE 02 48 03 B6 03 E8 03 D4 FE BC 02 E6  => C5
@@ -963,137 +978,773 @@ reply 41 44 44 52 07 8A 65 6F DE 02 17 77 01 02 03 04 0B 09 81 17 00 6C C0  => 1
 
 		// 41 44 44 52 07 8A 65 6F DE 02 C8 72 01 02 03 04 0B 0D 04 9C 3E - 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 7D  => C8
 
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00}, czcraft::KR_HOUR, "Hour", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x05, 0x00}, czcraft::KR_MINUTE, "Minute", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x06, 0x00}, czcraft::KR_UNCRAFTABLE, "Second", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x07, 0x00}, czcraft::KR_DAY, "Day of Month", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x08, 0x00}, czcraft::KR_MONTH, "Month (1=Jan)", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x09, 0x00}, czcraft::KR_YEAR, "Year (20xx)", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x04, 0x00}, czcraft::KR_HOUR, "Hour", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x05, 0x00}, czcraft::KR_MINUTE, "Minute", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x06, 0x00}, czcraft::KR_UNCRAFTABLE, "Second", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x07, 0x00}, czcraft::KR_DAY, "Day of Month", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x08, 0x00}, czcraft::KR_MONTH, "Month (1=Jan)", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x01, 0x09, 0x00}, czcraft::KR_YEAR, "Year (20xx)", czdec::cmd_r_generic, czdec::cmd_w_digit, czdec::reply_r_digit, czdec::reply_w_generic, 0},
+
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x41, 0x1D, 0x00}, czcraft::KR_EXTRA_HOT_WATER_OFF, "Extra hot water - off", czdec::cmd_r_generic, czdec::cmd_w_extra_hot_water, czdec::reply_r_extra_hot_water, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x81, 0x1D, 0x00}, czcraft::KR_EXTRA_HOT_WATER_ON, "Extra hot water - on", czdec::cmd_r_generic, czdec::cmd_w_extra_hot_water, czdec::reply_r_extra_hot_water, czdec::reply_w_generic, 0},
+
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x81, 0x13, 0x00}, czcraft::KR_FIREPLACE_MODE_ENABLE, "Enable fireplace mode", czdec::empty, czdec::cmd_w_generic_2byte, czdec::empty, czdec::reply_w_generic, 0},
+		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x41, 0x13, 0x00}, czcraft::KR_FIREPLACE_MODE_DISABLE, "Disable fireplace mode", czdec::empty, czdec::cmd_w_generic_2byte, czdec::empty, czdec::reply_w_generic, 0},
+
+
+	};
+#endif
+
+// compile-time generation of dispatch tables.
+// Functions below are C++11 constexpr (recursion, no loop), they are only evaluated by the compiler
+// except kr_hash() which is also used at runtime.
+// t = register table, n = number of registers in t
+#define KR_HASH_SIZE 256
+
+// hash of a register key (see cz_reg_key(), reg_num byte 5 is identical for all registers of a protocol)
+static constexpr byte kr_hash(uint32_t key)
+{
+	return (byte)(((key >> 16) & 0xFF) ^ (((key >> 8) & 0xFF) << 1) ^ ((key & 0xFF) << 2));
+}
+
+static constexpr bool kr_same_reg_num(const byte *a, const byte *b, unsigned int i = 0)
+{
+	return (i == 9) ? true : ((a[i] == b[i]) && kr_same_reg_num(a, b, i + 1));
+}
+
+// position of entry e in the dispatch table (sorted by hash then table order)
+static constexpr unsigned int kr_dispatch_position(const czdec::KNOWN_REGISTER *t, unsigned int n, unsigned int e, unsigned int i = 0)
+{
+	return (i == n) ? 0 :
+			(((kr_hash(cz_reg_key(t[i].reg_num)) < kr_hash(cz_reg_key(t[e].reg_num)))
+			|| ((kr_hash(cz_reg_key(t[i].reg_num)) == kr_hash(cz_reg_key(t[e].reg_num))) && (i < e))) ? 1 : 0)
+			+ kr_dispatch_position(t, n, e, i + 1);
+}
+
+// first dispatch table position of hash h
+static constexpr unsigned int kr_bucket_start(const czdec::KNOWN_REGISTER *t, unsigned int n, unsigned int h, unsigned int i = 0)
+{
+	return (i == n) ? 0 : ((kr_hash(cz_reg_key(t[i].reg_num)) < h) ? 1 : 0) + kr_bucket_start(t, n, h, i + 1);
+}
+
+// first entry having the given craftname (NULL = craftname not available with this protocol)
+static constexpr const czdec::KNOWN_REGISTER *kr_craft_entry(const czdec::KNOWN_REGISTER *t, unsigned int n, unsigned int reg_cname, unsigned int i = 0)
+{
+	return ((i == n) || (reg_cname == czcraft::KR_UNCRAFTABLE)) ? NULL :
+			((unsigned int)t[i].reg_cname == reg_cname) ? &t[i] : kr_craft_entry(t, n, reg_cname, i + 1);
+}
+
+// number of entries after entry e which never receive r replies because entry e has the same reg_num
+// and accepts the same reply size
+static constexpr unsigned int kr_nb_same_reg_num(const czdec::KNOWN_REGISTER *t, unsigned int n, unsigned int e, unsigned int i)
+{
+	return (i >= n) ? 0 :
+			((kr_same_reg_num(t[e].reg_num, t[i].reg_num) && ((t[e].reply_size == 0) || (t[e].reply_size == t[i].reply_size))) ? 1 : 0)
+			+ kr_nb_same_reg_num(t, n, e, i + 1);
+}
+
+static constexpr unsigned int kr_nb_duplicate_reg_num(const czdec::KNOWN_REGISTER *t, unsigned int n, unsigned int e = 0)
+{
+	return (e >= n) ? 0 : kr_nb_same_reg_num(t, n, e, e + 1) + kr_nb_duplicate_reg_num(t, n, e + 1);
+}
+
+// number of entries after entry e having the same craftname (uncraftable entries excluded)
+static constexpr unsigned int kr_nb_same_reg_cname(const czdec::KNOWN_REGISTER *t, unsigned int n, unsigned int e, unsigned int i)
+{
+	return (i >= n) ? 0 :
+			(((t[e].reg_cname != czcraft::KR_UNCRAFTABLE) && (t[e].reg_cname == t[i].reg_cname)) ? 1 : 0)
+			+ kr_nb_same_reg_cname(t, n, e, i + 1);
+}
+
+static constexpr unsigned int kr_nb_duplicate_reg_cname(const czdec::KNOWN_REGISTER *t, unsigned int n, unsigned int e = 0)
+{
+	return (e >= n) ? 0 : kr_nb_same_reg_cname(t, n, e, e + 1) + kr_nb_duplicate_reg_cname(t, n, e + 1);
+}
+
+// integer sequence 0..N-1 (std::make_index_sequence is C++14)
+template<unsigned int... I> struct kr_sequence {};
+template<unsigned int N, unsigned int... I> struct kr_make_sequence : kr_make_sequence<N - 1, N - 1, I...> {};
+template<unsigned int... I> struct kr_make_sequence<0, I...> { typedef kr_sequence<I...> type; };
+
+template<unsigned int N>
+struct KR_POSITIONS
+{
+	byte position[N];		// dispatch table position of each table entry
+};
+
+template<unsigned int N, unsigned int... E>
+static constexpr KR_POSITIONS<N> kr_build_positions(const czdec::KNOWN_REGISTER *t, kr_sequence<E...>)
+{
+	return { { (byte)kr_dispatch_position(t, N, E)... } };
+}
+
+// table entry stored at dispatch table position p
+template<unsigned int N>
+static constexpr unsigned int kr_entry_at(const KR_POSITIONS<N> &pos, unsigned int p, unsigned int e = 0)
+{
+	return (pos.position[e] == p) ? e : kr_entry_at(pos, p, e + 1);
+}
 
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x41, 0x1D, 0x00}, czcraft::KR_EXTRA_HOT_WATER_OFF, "Extra hot water - off", czdec::cmd_r_generic, czdec::cmd_w_extra_hot_water, czdec::reply_r_extra_hot_water, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x81, 0x1D, 0x00}, czcraft::KR_EXTRA_HOT_WATER_ON, "Extra hot water - on", czdec::cmd_r_generic, czdec::cmd_w_extra_hot_water, czdec::reply_r_extra_hot_water, czdec::reply_w_generic},
+template<unsigned int N>
+struct KR_DISPATCH
+{
+	uint32_t key[N];																// register key of each table entry
+	const czdec::KNOWN_REGISTER *entry[N];									// table entries sorted by hash
+	uint32_t entry_key[N];														// register key of each entry[] entry
+	byte bucket[KR_HASH_SIZE + 1];												// first entry of each hash, bucket[h + 1] = end of hash h
+	const czdec::KNOWN_REGISTER *craft[czcraft::KR_NB_CRAFT_NAMES];	// entry of each craftname
+};
+
+template<unsigned int N, unsigned int... P, unsigned int... H, unsigned int... C>
+static constexpr KR_DISPATCH<N> kr_build_dispatch(const czdec::KNOWN_REGISTER *t, const KR_POSITIONS<N> &pos, kr_sequence<P...>, kr_sequence<H...>, kr_sequence<C...>)
+{
+	return { { cz_reg_key(t[P].reg_num)... }, { &t[kr_entry_at(pos, P)]... }, { cz_reg_key(t[kr_entry_at(pos, P)].reg_num)... },
+				{ (byte)kr_bucket_start(t, N, H)... }, { kr_craft_entry(t, N, C)... } };
+}
 
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x81, 0x13, 0x00}, czcraft::KR_FIREPLACE_MODE_ENABLE, "Enable fireplace mode", czdec::empty, czdec::cmd_w_generic_2byte, czdec::empty, czdec::reply_w_generic},
-		{ {0x01, 0x02, 0x03, 0x04, 0x0B, 0x0D, 0x41, 0x13, 0x00}, czcraft::KR_FIREPLACE_MODE_DISABLE, "Disable fireplace mode", czdec::empty, czdec::cmd_w_generic_2byte, czdec::empty, czdec::reply_w_generic},
+#define KR_TABLE_SIZE(t) (sizeof(t) / sizeof(t[0]))
+
+// register index and reply flag must fit in a poll key (see comfortzone_heatpump::poll_next)
+static_assert(HP_MAX_REGISTERS <= 127, "HP_MAX_REGISTERS is too big");
+
+// generate dispatch tables of a protocol version
+// shared_reg_num: number of entries hidden by a previous entry having the same reg_num and reply size
+// (see KNOWN_REGISTER.reply_size)
+#define KR_DISPATCH_TABLES(version, shared_reg_num) \
+	static_assert(KR_TABLE_SIZE(kr_decoder_##version) <= HP_MAX_REGISTERS, "kr_decoder_" #version "[] is bigger than HP_MAX_REGISTERS"); \
+	static_assert(kr_nb_duplicate_reg_num(kr_decoder_##version, KR_TABLE_SIZE(kr_decoder_##version)) == shared_reg_num, "kr_decoder_" #version "[] contains duplicated reg_num"); \
+	static_assert(kr_nb_duplicate_reg_cname(kr_decoder_##version, KR_TABLE_SIZE(kr_decoder_##version)) == 0, "kr_decoder_" #version "[] contains duplicated reg_cname"); \
+	static constexpr KR_POSITIONS<KR_TABLE_SIZE(kr_decoder_##version)> kr_positions_##version = \
+			kr_build_positions<KR_TABLE_SIZE(kr_decoder_##version)>(kr_decoder_##version, kr_make_sequence<KR_TABLE_SIZE(kr_decoder_##version)>::type()); \
+	static constexpr KR_DISPATCH<KR_TABLE_SIZE(kr_decoder_##version)> kr_dispatch_##version = \
+			kr_build_dispatch(kr_decoder_##version, kr_positions_##version, kr_make_sequence<KR_TABLE_SIZE(kr_decoder_##version)>::type(), \
+									kr_make_sequence<KR_HASH_SIZE + 1>::type(), kr_make_sequence<czcraft::KR_NB_CRAFT_NAMES>::type());
+
+#if HP_WITH_PROTOCOL(HP_PROTOCOL_1_6)
+KR_DISPATCH_TABLES(v160, 0)
+#endif
+#if HP_WITH_PROTOCOL(HP_PROTOCOL_1_7)
+KR_DISPATCH_TABLES(v170, 0)
+#endif
+#if HP_WITH_PROTOCOL(HP_PROTOCOL_1_8)
+KR_DISPATCH_TABLES(v180, 0)
+#endif
+#if HP_WITH_PROTOCOL(HP_PROTOCOL_2_21)
+KR_DISPATCH_TABLES(v221, 0)
+#endif
 
+#define CZ_PROTOCOL_ENTRY(protocol, version, fan_speed_min, fan_speed_max) \
+	{ protocol, kr_decoder_##version, KR_TABLE_SIZE(kr_decoder_##version), kr_dispatch_##version.key, \
+	  kr_dispatch_##version.entry, kr_dispatch_##version.entry_key, kr_dispatch_##version.bucket, kr_dispatch_##version.craft, \
+	  { fan_speed_min, fan_speed_max } }
 
+static const CZ_PROTOCOL cz_protocols[] =
+	{
+#if HP_WITH_PROTOCOL(HP_PROTOCOL_1_6)
+		CZ_PROTOCOL_ENTRY(HP_PROTOCOL_1_6, v160, 1, 3),
+#endif
+#if HP_WITH_PROTOCOL(HP_PROTOCOL_1_7)
+		CZ_PROTOCOL_ENTRY(HP_PROTOCOL_1_7, v170, 0, 255),		// fan speed not checked
+#endif
+#if HP_WITH_PROTOCOL(HP_PROTOCOL_1_8)
+		CZ_PROTOCOL_ENTRY(HP_PROTOCOL_1_8, v180, 1, 4),
+#endif
+#if HP_WITH_PROTOCOL(HP_PROTOCOL_2_21)
+		CZ_PROTOCOL_ENTRY(HP_PROTOCOL_2_21, v221, 0, 255),		// fan speed not checked
 #endif
-		{ {0}, czcraft::KR_UNCRAFTABLE, NULL, NULL, NULL, NULL, NULL}
 	};
 
-// convert a craftname into index into kr_decoder_array
-czdec::KNOWN_REGISTER *czdec::kr_craft_name_to_index(czcraft::KNOWN_REGISTER_CRAFT_NAME reg_cname)
+#define NB_CZ_PROTOCOLS (sizeof(cz_protocols) / sizeof(cz_protocols[0]))
+
+static_assert(NB_CZ_PROTOCOLS == HP_NB_PROTOCOLS, "HP_NB_PROTOCOLS must be the number of cz_protocols[] entries");
+
+// get tables of a protocol version
+// output: NULL if protocol version is not supported
+const CZ_PROTOCOL *czdec::get_protocol(uint16_t protocol)
+{
+	unsigned int i;
+
+	for(i = 0; i < NB_CZ_PROTOCOLS; i++)
+	{
+		if(cz_protocols[i].version == protocol)
+			return &cz_protocols[i];
+	}
+
+	return NULL;
+}
+
+// iterate over the registers of a protocol version
+// output: NULL if protocol version is not supported or idx is after the last register
+const czdec::KNOWN_REGISTER *czdec::get_register(uint16_t protocol, unsigned int idx)
+{
+	const CZ_PROTOCOL *tables = get_protocol(protocol);
+
+	if((tables == NULL) || (idx >= tables->nb_registers))
+		return NULL;
+
+	return &(tables->registers[idx]);
+}
+
+// check if a frame can be decoded by a register (r replies must have its reply size)
+static inline bool kr_accepts_frame(const czdec::KNOWN_REGISTER *kr, const CZ_PACKET_HEADER *czph)
+{
+	return (czph->cmd != 'r') || (kr->reply_size == 0) || (kr->reply_size == czph->packet_size);
+}
+
+// find the first register having the given reg_num (key = cz_reg_key(reg_num)) and accepting r replies of reply_size bytes
+// (reply_size = 0: first register having the given reg_num)
+static const czdec::KNOWN_REGISTER *kr_key_to_index(const CZ_PROTOCOL *protocol, uint32_t key, const byte *reg_num, byte reply_size)
+{
+	byte h = kr_hash(key);
+	const czdec::KNOWN_REGISTER *kr;
+	unsigned int i;
+
+	for(i = protocol->bucket[h]; i < protocol->bucket[h + 1]; i++)
+	{
+		if(protocol->entry_key[i] != key)
+			continue;
+
+		kr = protocol->entry[i];
+
+		if((key == CZ_REG_KEY_IRREGULAR) && (memcmp(kr->reg_num, reg_num, 9)))
+			continue;
+
+		if((reply_size == 0) || (kr->reply_size == 0) || (kr->reply_size == reply_size))
+			return kr;
+	}
+
+	return NULL;
+}
+
+static inline const czdec::KNOWN_REGISTER *kr_reg_num_to_index(const CZ_PROTOCOL *protocol, const byte *reg_num, byte reply_size = 0)
+{
+	return kr_key_to_index(protocol, cz_reg_key(reg_num), reg_num, reply_size);
+}
+
+// find the register decoding a frame (reg_num and, for r replies, reply size)
+static inline const czdec::KNOWN_REGISTER *kr_frame_to_index(const CZ_PROTOCOL *protocol, const CZ_PACKET_HEADER *czph, uint32_t key)
 {
-	int i = 0;
+	return kr_key_to_index(protocol, key, czph->reg_num, (czph->cmd == 'r') ? czph->packet_size : 0);
+}
+
+// find the register of a received frame. The register predicted from the control panel poll sequence
+// is checked first, the dispatch table is only used when prediction fails.
+// Frames of unknown registers are ignored by prediction: the register following the last known one
+// is learned across them, and they are not counted as hits or misses. A prediction is only replaced
+// after 2 misses in a row, so an occasional different register does not cost a second miss.
+const czdec::KNOWN_REGISTER *czdec::poll_lookup(comfortzone_heatpump *czhp, CZ_PACKET_HEADER *czph)
+{
+	const CZ_PROTOCOL *protocol = czhp->protocol;
+	const czdec::KNOWN_REGISTER *kr = NULL;
+	uint32_t key = cz_reg_key(czph->reg_num);
+	byte predicted;
+
+	if(czhp->poll_last != POLL_NONE)
+	{
+		predicted = czhp->poll_next[czhp->poll_last];
+
+		if((predicted != POLL_NONE) && (cz_same_reg(protocol->key[predicted], protocol->registers[predicted].reg_num, key, czph->reg_num))
+			&& (kr_accepts_frame(&protocol->registers[predicted], czph)))
+			kr = &protocol->registers[predicted];
+	}
 
-	while(kr_decoder[i].reg_name != NULL)
+	if(kr != NULL)
+	{
+		czhp->poll_hits++;
+		czhp->poll_weak[czhp->poll_last >> 3] &= ~(1 << (czhp->poll_last & 7));
+	}
+	else
 	{
-		if(reg_cname == kr_decoder[i].reg_cname)
+		kr = kr_frame_to_index(protocol, czph, key);
+
+		if(kr == NULL)
+			return NULL;
+
+		czhp->poll_misses++;
+
+		if(czhp->poll_last != POLL_NONE)
 		{
-			return &(kr_decoder[i]);
+			byte bit = 1 << (czhp->poll_last & 7);
+
+			if((czhp->poll_next[czhp->poll_last] == POLL_NONE) || (czhp->poll_weak[czhp->poll_last >> 3] & bit))
+				czhp->poll_next[czhp->poll_last] = kr - protocol->registers;
+			else
+				czhp->poll_weak[czhp->poll_last >> 3] |= bit;
 		}
+	}
+
+	czhp->poll_last = ((kr - protocol->registers) << 1) | (((czph->cmd == 'r') || (czph->cmd == 'w')) ? 1 : 0);
+
+	return kr;
+}
+
+// check if a reply frame is identical to the previous reply of its register
+// frame CRC is already checked. With HP_REPLY_STORE_SIZE, the frame is compared with the kept reply
+// (a reply which cannot be kept is never reported as unchanged). Without it, a 32 bits hash (FNV-1a)
+// of the whole frame is kept per register and remembered here: 2 different frames having the same
+// hash are seen as identical (see HP_SKIP_UNCHANGED_REPLIES)
+bool czdec::reply_unchanged(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, CZ_PACKET_HEADER *czph)
+{
+	const byte *frame = (const byte *)czph;
+	unsigned int idx = kr - czhp->protocol->registers;
+	bool refresh = (czhp->reply_refresh[idx >> 3] & (1 << (idx & 7))) ? true : false;
+
+#ifdef HP_REPLY_STORE_SIZE
+	if(refresh)
+		return false;
+
+	// last reply is in reply_store only if it had the size of the slot
+	if((czhp->reply_slot_size[idx] != czph->packet_size) || (czhp->reply_last_size[idx] != czph->packet_size))
+		return false;
+
+	return (memcmp(czhp->reply_store + czhp->reply_slot[idx], frame, czph->packet_size) == 0);
+#else
+	uint32_t *last_hash = &czhp->reply_hash[idx];
+	uint32_t hash = 2166136261UL;
+	int i;
 
-		i++;
+	for(i = 0; i < czph->packet_size; i++)
+	{
+		hash ^= frame[i];
+		hash *= 16777619UL;
 	}
 
-	DPRINT("kr_craft_name_to_index failed to find craftname ");
-	DPRINTLN(reg_cname);
+	// 0 means no reply received
+	if(hash == 0)
+		hash = 1;
 
-	return NULL;
+	if((*last_hash == hash) && (!refresh))
+		return true;
+
+	*last_hash = hash;
+	return false;
+#endif
 }
 
-// process a received frame and adjust comfortzone_status accordingly
-comfortzone_heatpump::PROCESSED_FRAME_TYPE czdec::process_frame(comfortzone_heatpump *cz_class, CZ_PACKET_HEADER *czph)
+// compute reply_changes of a reply frame and keep the frame to compare it with the next reply of its register
+// all bytes are considered as changed for the first reply, when reply size changes, when reply store is full
+// or when interest decoding added fields (see comfortzone_heatpump::set_interest_mask())
+void czdec::update_reply_changes(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, CZ_PACKET_HEADER *czph)
 {
-	int i = 0;
+	unsigned int idx = kr - czhp->protocol->registers;
+
+	memset(czhp->reply_changes, 0xFF, sizeof(czhp->reply_changes));
 
-	while(kr_decoder[i].reg_name != NULL)
+#ifdef HP_REPLY_STORE_SIZE
+	bool refresh = (czhp->reply_refresh[idx >> 3] & (1 << (idx & 7))) ? true : false;
+#endif
+
+	czhp->reply_refresh[idx >> 3] &= ~(1 << (idx & 7));
+
+#ifdef HP_REPLY_STORE_SIZE
+	czhp->reply_stored = false;
+	const byte *frame = (const byte *)czph;
+	int size = czph->packet_size;
+	byte *last;
+	byte bits;
+	int i;
+	int j;
+
+	if(czhp->reply_slot_size[idx] == 0)
 	{
-		if(!memcmp(czph->reg_num, kr_decoder[i].reg_num, 9))
+		if((czhp->reply_store_used + size) > HP_REPLY_STORE_SIZE)
+			return;
+
+		czhp->reply_slot[idx] = czhp->reply_store_used;
+		czhp->reply_slot_size[idx] = size;
+		czhp->reply_last_size[idx] = size;
+		czhp->reply_store_used += size;
+
+		memcpy(czhp->reply_store + czhp->reply_slot[idx], frame, size);
+		czhp->reply_generation[idx]++;
+		czhp->reply_stored = true;
+		return;
+	}
+
+	czhp->reply_last_size[idx] = size;
+
+	if(czhp->reply_slot_size[idx] != size)
+		return;
+
+	last = czhp->reply_store + czhp->reply_slot[idx];
+
+	if(refresh)
+	{
+		// keep all bytes flagged as changed
+		memcpy(last, frame, size);
+		czhp->reply_generation[idx]++;
+		czhp->reply_stored = true;
+		return;
+	}
+
+	memset(czhp->reply_changes, 0, sizeof(czhp->reply_changes));
+
+	// compare 8 bytes at once (= 1 byte of reply_changes), most blocks are unchanged
+	for(i = 0; i < size; i += 8)
+	{
+		int nb = ((size - i) < 8) ? (size - i) : 8;
+
+		if(!memcmp(frame + i, last + i, nb))
+			continue;
+
+		bits = 0;
+		for(j = 0; j < nb; j++)
 		{
-			switch(czph->cmd)
-			{
-				case 'R':
-							DPRINT(kr_decoder[i].reg_name);
-							DPRINTLN(" (get): ");
+			if(frame[i + j] != last[i + j])
+				bits |= (1 << j);
+		}
 
-							kr_decoder[i].cmd_r(cz_class, &kr_decoder[i], (R_CMD*)czph);
+		czhp->reply_changes[i >> 3] = bits;
+	}
 
-							DPRINTLN("====================================================");
-							return comfortzone_heatpump::PFT_QUERY;
+	memcpy(last, frame, size);
+	czhp->reply_generation[idx]++;
+	czhp->reply_stored = true;
+#endif
+}
 
-				case 'W':
-						{
-						int j;
-						W_CMD *w_cmd = (W_CMD*)czph;
-						
-						DPRINT("[COMMAND] ");
-						DPRINT(kr_decoder[i].reg_name);
-						DPRINT(" - Reg: ");
-						
-						for(j = 0; j < 9; j++)
-						{
-							if(w_cmd->cz_head.reg_num[j] < 0x10) DPRINT("0");
-							DPRINT(w_cmd->cz_head.reg_num[j], HEX);
-							if(j < 8) DPRINT(" ");
-						}
-						
-						DPRINT(" Value: ");
-						if(w_cmd->reg_value[0] < 0x10) DPRINT("0");
-						DPRINT(w_cmd->reg_value[0], HEX);
-						DPRINT(" ");
-						if(w_cmd->reg_value[1] < 0x10) DPRINT("0");
-						DPRINT(w_cmd->reg_value[1], HEX);
-						DPRINTLN("");
+// add a register unknown to the register tables
+// output: false if decoder is NULL or HP_MAX_EXTRA_REGISTERS registers are already added
+bool czdec::add_extra_register(comfortzone_heatpump *czhp, const byte reg_num[9], const char *name, byte frame_size, comfortzone_heatpump::EXTRA_REGISTER_DECODER decoder, void *context)
+{
+#ifdef HP_MAX_EXTRA_REGISTERS
+	comfortzone_heatpump::EXTRA_REGISTER *er;
+
+	if((decoder == NULL) || (czhp->nb_extra_registers >= HP_MAX_EXTRA_REGISTERS))
+		return false;
+
+	er = &czhp->extra_registers[czhp->nb_extra_registers++];
+
+	memcpy(er->reg_num, reg_num, 9);
+	er->reg_key = cz_reg_key(reg_num);
+	er->frame_size = frame_size;
+	er->name = name;
+	er->decoder = decoder;
+	er->context = context;
+
+	czhp->extra_hash_mask |= (1UL << (kr_hash(er->reg_key) & 31));
+	return true;
+#else
+	return false;
+#endif
+}
+
+// give a frame of a register unknown to the register tables to the added registers
+// output: PFT_UNKNOWN if no added register matches the frame
+comfortzone_heatpump::PROCESSED_FRAME_TYPE czdec::process_extra_register(comfortzone_heatpump *czhp, CZ_PACKET_HEADER *czph)
+{
+#ifdef HP_MAX_EXTRA_REGISTERS
+	const comfortzone_heatpump::EXTRA_REGISTER *er;
+	uint32_t key = cz_reg_key(czph->reg_num);
+	int i;
+
+	if(!(czhp->extra_hash_mask & (1UL << (kr_hash(key) & 31))))
+		return comfortzone_heatpump::PFT_UNKNOWN;
+
+	for(i = 0; i < czhp->nb_extra_registers; i++)
+	{
+		er = &czhp->extra_registers[i];
+
+		if((er->frame_size != 0) && (er->frame_size != czph->packet_size))
+			continue;
+
+		if(!cz_same_reg(er->reg_key, er->reg_num, key, czph->reg_num))
+			continue;
+
+		DPRINT(er->name);
+		DPRINTLN(" (added register)");
 
-						kr_decoder[i].cmd_w(cz_class, &kr_decoder[i], (W_CMD*)czph);
+		er->decoder(czhp, (const byte *)czph, czph->packet_size, er->context);
+
+		if((czph->cmd == 'r') || (czph->cmd == 'w'))
+			return comfortzone_heatpump::PFT_REPLY;
+
+		return comfortzone_heatpump::PFT_QUERY;
+	}
+#endif
+
+	return comfortzone_heatpump::PFT_UNKNOWN;
+}
+
+// keep the value of a write command or read reply frame as last value of its register
+// if kr is NULL, register is searched using frame reg_num
+void czdec::update_shadow(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, CZ_PACKET_HEADER *czph, byte source)
+{
+#ifdef HP_REGISTER_SHADOW
+	comfortzone_heatpump::REGISTER_VALUE *v;
+	const byte *value = ((const byte *)czph) + sizeof(CZ_PACKET_HEADER);
+
+	if(kr == NULL)
+	{
+		if(czhp->protocol_detection)
+			return;
+
+		kr = kr_frame_to_index(czhp->protocol, czph, cz_reg_key(czph->reg_num));
+		if(kr == NULL)
+			return;
+	}
+
+	v = &czhp->shadow[kr - czhp->protocol->registers];
+
+	// value is between header and crc
+	v->size = czph->packet_size - sizeof(CZ_PACKET_HEADER) - 1;
+
+	switch(v->size)
+	{
+		case 1:	v->value = value[0];
+					break;
+
+		case 2:	v->value = get_uint16(value);
+					break;
+
+		case 4:	v->value = get_uint32(value);
+					break;
+
+		default:	v->value = 0;
+					break;
+	}
+
+	v->source = source;
+	v->timestamp = millis();
+#endif
+}
+
+// get the last value of a register
+// output: false if the register is unknown or was not seen yet
+bool czdec::get_register_value(comfortzone_heatpump *czhp, const byte reg_num[9], comfortzone_heatpump::REGISTER_VALUE *value, byte frame_size)
+{
+#ifdef HP_REGISTER_SHADOW
+	const KNOWN_REGISTER *kr;
+
+	if(czhp->protocol_detection)
+		return false;
+
+	kr = kr_reg_num_to_index(czhp->protocol, reg_num, frame_size);
+	if(kr == NULL)
+		return false;
+
+	*value = czhp->shadow[kr - czhp->protocol->registers];
+
+	return (value->source != comfortzone_heatpump::RS_NONE);
+#else
+	return false;
+#endif
+}
+
+// copy bytes of the last reply frame of a register
+// output: #bytes copied (less than length if the frame is shorter), -1 if the last reply is not kept
+int czdec::get_raw_reply(comfortzone_heatpump *czhp, const byte reg_num[9], uint16_t offset, byte *buffer, uint16_t length, byte frame_size)
+{
+#ifdef HP_REPLY_STORE_SIZE
+	const KNOWN_REGISTER *kr;
+	unsigned int idx;
+	int size;
+
+	if(czhp->protocol_detection)
+		return -1;
+
+	kr = kr_reg_num_to_index(czhp->protocol, reg_num, frame_size);
+	if(kr == NULL)
+		return -1;
+
+	idx = kr - czhp->protocol->registers;
+	size = czhp->reply_slot_size[idx];
+
+	// no reply yet, reply store full or last reply has another size
+	if((size == 0) || (czhp->reply_last_size[idx] != size))
+		return -1;
+
+	if(offset >= size)
+		return 0;
+
+	if(length > (size - offset))
+		length = size - offset;
+
+	memcpy(buffer, czhp->reply_store + czhp->reply_slot[idx] + offset, length);
+	return length;
+#else
+	return -1;
+#endif
+}
+
+// convert a craftname into index into register table of the heatpump protocol
+const czdec::KNOWN_REGISTER *czdec::kr_craft_name_to_index(comfortzone_heatpump *czhp, czcraft::KNOWN_REGISTER_CRAFT_NAME reg_cname)
+{
+	const KNOWN_REGISTER *kr = NULL;
+
+	if((reg_cname > czcraft::KR_UNCRAFTABLE) && (reg_cname < czcraft::KR_NB_CRAFT_NAMES))
+		kr = czhp->protocol->craft[reg_cname];
+
+	if(kr == NULL)
+	{
+		DPRINT("kr_craft_name_to_index failed to find craftname ");
+		DPRINTLN(reg_cname);
+	}
+
+	return kr;
+}
+
+// process a received frame and adjust comfortzone_status accordingly
+comfortzone_heatpump::PROCESSED_FRAME_TYPE czdec::process_frame(comfortzone_heatpump *cz_class, CZ_PACKET_HEADER *czph)
+{
+	const KNOWN_REGISTER *kr;
+	comfortzone_heatpump::PROCESSED_FRAME_TYPE pft;
+
+	kr = poll_lookup(cz_class, czph);
+
+	if(kr != NULL)
+	{
+		switch(czph->cmd)
+		{
+			case 'R':
+						DPRINT(kr->reg_name);
+						DPRINTLN(" (get): ");
+
+						kr->cmd_r(cz_class, kr, (R_CMD*)czph);
 
 						DPRINTLN("====================================================");
 						return comfortzone_heatpump::PFT_QUERY;
+
+			case 'W':
+					{
+					int j;
+					W_CMD *w_cmd = (W_CMD*)czph;
+					
+					DPRINT("[COMMAND] ");
+					DPRINT(kr->reg_name);
+					DPRINT(" - Reg: ");
+					
+					for(j = 0; j < 9; j++)
+					{
+						if(w_cmd->cz_head.reg_num[j] < 0x10) DPRINT("0");
+						DPRINT(w_cmd->cz_head.reg_num[j], HEX);
+						if(j < 8) DPRINT(" ");
+					}
+					
+					DPRINT(" Value: ");
+					if(w_cmd->reg_value[0] < 0x10) DPRINT("0");
+					DPRINT(w_cmd->reg_value[0], HEX);
+					DPRINT(" ");
+					if(w_cmd->reg_value[1] < 0x10) DPRINT("0");
+					DPRINT(w_cmd->reg_value[1], HEX);
+					DPRINTLN("");
+
+					update_shadow(cz_class, kr, czph, comfortzone_heatpump::RS_PANEL_WRITE);
+
+					kr->cmd_w(cz_class, kr, (W_CMD*)czph);
+
+					DPRINTLN("====================================================");
+					return comfortzone_heatpump::PFT_QUERY;
+					}
+			case 'r':
+						DPRINT(kr->reg_name);
+						DPRINTLN(" (reply get): ");
+
+						update_shadow(cz_class, kr, czph, comfortzone_heatpump::RS_READ_REPLY);
+
+#ifdef HP_SKIP_UNCHANGED_REPLIES
+						if(reply_unchanged(cz_class, kr, czph))
+						{
+							DPRINTLN("unchanged");
+							return comfortzone_heatpump::PFT_REPLY;
 						}
-				case 'r':
-							DPRINT(kr_decoder[i].reg_name);
-							DPRINTLN(" (reply get): ");
+#endif
 
-							kr_decoder[i].reply_r(cz_class, &kr_decoder[i], (R_REPLY*)czph);
+						update_reply_changes(cz_class, kr, czph);
 
-							DPRINTLN("====================================================");
-							return comfortzone_heatpump::PFT_REPLY;
+						kr->reply_r(cz_class, kr, (R_REPLY*)czph);
 
-				case 'w':
-							DPRINT(kr_decoder[i].reg_name);
-							DPRINTLN(" (reply set): ");
+						DPRINTLN("====================================================");
+						return comfortzone_heatpump::PFT_REPLY;
 
-							kr_decoder[i].reply_w(cz_class, &kr_decoder[i], (W_REPLY*)czph);
+			case 'w':
+						DPRINT(kr->reg_name);
+						DPRINTLN(" (reply set): ");
 
-							DPRINTLN("====================================================");
-							return comfortzone_heatpump::PFT_REPLY;
-			}
-		}
+						kr->reply_w(cz_class, kr, (W_REPLY*)czph);
 
-		i++;
+						DPRINTLN("====================================================");
+						return comfortzone_heatpump::PFT_REPLY;
+		}
 	}
 
+	// registers added using comfortzone_heatpump::add_register()
+	pft = process_extra_register(cz_class, czph);
+	if(pft != comfortzone_heatpump::PFT_UNKNOWN)
+		return pft;
+
 	DPRINTLN("unknown register");
 	dump_frame(cz_class, "UNK:");
 	return comfortzone_heatpump::PFT_UNKNOWN;
 }
 
-czdec::KNOWN_REGISTER* czdec::get_decoder_for_frame(CZ_PACKET_HEADER *czph)
+// a frame is recognized by a protocol version if its register is known and, for reply frames
+// having known layouts, if its size matches one of them
+comfortzone_heatpump::PROCESSED_FRAME_TYPE czdec::detect_protocol(comfortzone_heatpump *czhp, CZ_PACKET_HEADER *czph)
 {
-	int i = 0;
+	const KNOWN_REGISTER *kr;
+	uint32_t key = cz_reg_key(czph->reg_num);
+	uint16_t *scores = czhp->protocol_detection_scores;
+	unsigned int best = 0;
+	uint16_t second_score = 0;
+	unsigned int i;
+
+	for(i = 0; i < NB_CZ_PROTOCOLS; i++)
+	{
+		kr = kr_frame_to_index(&cz_protocols[i], czph, key);
 
-	while(kr_decoder[i].reg_name != NULL)
+		if(kr == NULL)
+			continue;
+
+		if((czph->cmd == 'r') && (czlayout::has_layout(kr)) && (czlayout::get_layout(kr, czph->packet_size) == NULL))
+			continue;
+
+		scores[i]++;
+	}
+
+	czhp->protocol_detection_frames++;
+
+	for(i = 1; i < NB_CZ_PROTOCOLS; i++)
 	{
-		if(!memcmp(czph->reg_num, kr_decoder[i].reg_num, 9))
-		{
-			return &kr_decoder[i];
-		}
-		i++;
+		if(scores[i] > scores[best])
+			best = i;
 	}
 
-	DPRINTLN("unknown register");
-	return NULL;
+	for(i = 0; i < NB_CZ_PROTOCOLS; i++)
+	{
+		if((i != best) && (scores[i] > second_score))
+			second_score = scores[i];
+	}
+
+	if(((scores[best] >= HP_PROTOCOL_DETECTION_MIN_FRAMES) && (second_score == 0))
+		|| ((czhp->protocol_detection_frames >= HP_PROTOCOL_DETECTION_MAX_FRAMES) && (scores[best] > second_score)))
+	{
+		czhp->protocol = &cz_protocols[best];
+		czhp->protocol_detection = false;
+		czhp->reset_register_cache();
+
+		DPRINT("Detected protocol: ");
+		DPRINTLN(cz_protocols[best].version);
+	}
+
+	if((czph->cmd == 'r') || (czph->cmd == 'w'))
+		return comfortzone_heatpump::PFT_REPLY;
+
+	return comfortzone_heatpump::PFT_QUERY;
+}
+
+const czdec::KNOWN_REGISTER *czdec::get_decoder_for_frame(uint16_t protocol, CZ_PACKET_HEADER *czph)
+{
+	const CZ_PROTOCOL *tables = get_protocol(protocol);
+	const KNOWN_REGISTER *kr = NULL;
+
+	if(tables != NULL)
+		kr = kr_frame_to_index(tables, czph, cz_reg_key(czph->reg_num));
+
+	if(kr == NULL)
+		DPRINTLN("unknown register");
+
+	return kr;
 }
 
 void czdec::dump_frame(comfortzone_heatpump *cz_class, const char *prefix)
@@ -1118,7 +1769,7 @@ void czdec::dump_frame(comfortzone_heatpump *cz_class, const char *prefix)
 }
 
 // debug helper: print raw payload (hex) for frames matched to unknown short registers
-void czdec::reply_r_log_raw(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_log_raw(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 	#ifdef USE_ESPHOME
 	// In ESPHome, store the payload for external logging via grab_buffer or callback
@@ -5,6 +5,24 @@
 #include "comfortzone_frame.h"
 #include "comfortzone_crafting.h"
 
+struct cz_protocol;
+
+// units of scalar values
+extern const char cz_unit_celsius[];
+extern const char cz_unit_hz[];
+extern const char cz_unit_minutes[];
+extern const char cz_unit_days[];
+extern const char cz_unit_percent[];
+
+// scalar value formats (template parameters of czdec::cmd_w_scalar and czdec::reply_r_scalar)
+#define CZ_SCALAR_TEMP				2, false, 10, cz_unit_celsius		// °C, * 10
+#define CZ_SCALAR_TEMP_1BYTE		1, false, 10, cz_unit_celsius		// °C, * 10
+#define CZ_SCALAR_FREQ				2, false, 10, cz_unit_hz			// Hz, * 10
+#define CZ_SCALAR_TIME				2, false, 10, cz_unit_minutes		// minutes, * 10
+#define CZ_SCALAR_TIME_MINUTES	2, false, 1, cz_unit_minutes		// minutes
+#define CZ_SCALAR_TIME_DAYS		2, false, 1, cz_unit_days			// days
+#define CZ_SCALAR_PERCENTAGE		2, true, 10, cz_unit_percent		// %, * 10
+
 class czdec
 {
 	public:
@@ -15,124 +33,184 @@ class czdec
 		czcraft::KNOWN_REGISTER_CRAFT_NAME reg_cname;
 		const char *reg_name;
 
-		void (*cmd_r)(comfortzone_heatpump *czhp, struct known_register *kr, R_CMD *p);	  // FRAME_TYPE_02_CMD_p2, R command
-		void (*cmd_w)(comfortzone_heatpump *czhp, struct known_register *kr, W_CMD *p);	  // FRAME_TYPE_02_CMD_p2, W command
-		void (*reply_r)(comfortzone_heatpump *czhp, struct known_register *kr, R_REPLY *p); // FRAME_TYPE_02_REPLY, r reply
-		void (*reply_w)(comfortzone_heatpump *czhp, struct known_register *kr, W_REPLY *p); // FRAME_TYPE_P2_REPLY, w reply
+		void (*cmd_r)(comfortzone_heatpump *czhp, const struct known_register *kr, R_CMD *p);	  // FRAME_TYPE_02_CMD_p2, R command
+		void (*cmd_w)(comfortzone_heatpump *czhp, const struct known_register *kr, W_CMD *p);	  // FRAME_TYPE_02_CMD_p2, W command
+		void (*reply_r)(comfortzone_heatpump *czhp, const struct known_register *kr, R_REPLY *p); // FRAME_TYPE_02_REPLY, r reply
+		void (*reply_w)(comfortzone_heatpump *czhp, const struct known_register *kr, W_REPLY *p); // FRAME_TYPE_P2_REPLY, w reply
+
+		// size of r reply frames (0 = any size). Several entries can share a reg_num when they have
+		// different reply sizes, r replies are then dispatched by size, other frames use the first entry
+		byte reply_size;
 	} KNOWN_REGISTER;
 
+	// description of a status frame value copied into comfortzone_status
+	typedef struct
+	{
+		byte offset;							// offset of the value in the frame
+		byte width;								// value size in bytes (1, 2 or 4, little endian)
+		bool is_signed;
+		COMFORTZONE_STATUS_FIELD status_field;	// updated comfortzone_status field
+		int16_t bias;							// added to the frame value (status value = frame value + bias)
+		uint16_t scale;						// status value = physical value * scale
+		const char *unit;
+		const char *name;						// display name
+	} STATUS_FIELD;
+
+	// get tables of a protocol version (HP_PROTOCOL_x_y)
+	// output: NULL if protocol version is not supported
+	static const struct cz_protocol *get_protocol(uint16_t protocol);
+
+	// iterate over the registers of a protocol version
+	// output: NULL if protocol version is not supported or idx is after the last register
+	static const KNOWN_REGISTER *get_register(uint16_t protocol, unsigned int idx);
+
+	// status field table used to decode a frame (NULL = none, see comfortzone_decoder_status.cpp)
+	static const STATUS_FIELD *get_status_fields(const KNOWN_REGISTER *kr, byte frame_size, int *nb_fields);
+
 	static comfortzone_heatpump::PROCESSED_FRAME_TYPE process_frame(comfortzone_heatpump *cz_class, CZ_PACKET_HEADER *czph);
+
+	// protocol detection: score a received frame against all protocol versions and select
+	// the heatpump protocol when detection is complete
+	static comfortzone_heatpump::PROCESSED_FRAME_TYPE detect_protocol(comfortzone_heatpump *czhp, CZ_PACKET_HEADER *czph);
 	static void dump_frame(comfortzone_heatpump *cz_class, const char *prefix);
-	static czdec::KNOWN_REGISTER *kr_craft_name_to_index(czcraft::KNOWN_REGISTER_CRAFT_NAME reg_cname);
-	static czdec::KNOWN_REGISTER* get_decoder_for_frame(CZ_PACKET_HEADER *czph);
+	static const czdec::KNOWN_REGISTER *kr_craft_name_to_index(comfortzone_heatpump *czhp, czcraft::KNOWN_REGISTER_CRAFT_NAME reg_cname);
+	static const czdec::KNOWN_REGISTER *get_decoder_for_frame(uint16_t protocol, CZ_PACKET_HEADER *czph);
+	static const czdec::KNOWN_REGISTER *poll_lookup(comfortzone_heatpump *czhp, CZ_PACKET_HEADER *czph);
+	static bool reply_unchanged(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, CZ_PACKET_HEADER *czph);
+	static void update_reply_changes(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, CZ_PACKET_HEADER *czph);
+	static void update_shadow(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, CZ_PACKET_HEADER *czph, byte source);
+	static bool get_register_value(comfortzone_heatpump *czhp, const byte reg_num[9], comfortzone_heatpump::REGISTER_VALUE *value, byte frame_size);
+	static bool add_extra_register(comfortzone_heatpump *czhp, const byte reg_num[9], const char *name, byte frame_size, comfortzone_heatpump::EXTRA_REGISTER_DECODER decoder, void *context);
+	static comfortzone_heatpump::PROCESSED_FRAME_TYPE process_extra_register(comfortzone_heatpump *czhp, CZ_PACKET_HEADER *czph);
+	static int get_raw_reply(comfortzone_heatpump *czhp, const byte reg_num[9], uint16_t offset, byte *buffer, uint16_t length, byte frame_size);
+
+	// copy values described by a status field table from a frame into comfortzone_status
+	static void decode_status_fields(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p, const STATUS_FIELD *fields, int nb_fields);
+
+	// lazy decoding: decode a status field from the kept reply frame if it changed since the last read
+	static void decode_lazy_field(comfortzone_heatpump *czhp, COMFORTZONE_STATUS_FIELD field);
 
 	// command and reply decoder
-	static void cmd_r_generic(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_CMD *p);
-	static void cmd_w_generic_2byte(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p);
-	static void cmd_w_temp(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p);
-	static void cmd_w_temp_1byte(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p);
-	static void cmd_w_freq(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p);
-	static void cmd_w_time(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p);
-	static void cmd_w_time_minutes(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p);
-	static void cmd_w_time_days(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p);
-	static void cmd_w_percentage(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p);
-	static void cmd_w_extra_hot_water(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p);
-	static void cmd_w_daylight_saving(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p);
-	static void cmd_w_sanitary_priority(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p);
-	static void cmd_w_day_delay(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p);
-	static void cmd_w_fan_speed(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p);
-	static void cmd_w_language(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p);
-	static void cmd_w_digit(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p);
-	static void cmd_w_clr_alarm(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p);
-
-	static void reply_r_generic_2byte(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_temp(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_temp_1byte(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_freq(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_time(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_time_minutes(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_time_days(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_percentage(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_extra_hot_water(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_daylight_saving(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_sanitary_priority(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_day_delay(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_fan_speed(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
+	static void cmd_r_generic(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_CMD *p);
+	static void cmd_w_generic_2byte(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_CMD *p);
+	// scalar value decoders (see CZ_SCALAR_*): value is WIDTH bytes (1 or 2), displayed value is value / SCALE followed by UNIT
+	template <int WIDTH, bool IS_SIGNED, int SCALE, const char *UNIT> static void cmd_w_scalar(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_CMD *p);
+	template <int WIDTH, bool IS_SIGNED, int SCALE, const char *UNIT> static void reply_r_scalar(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+
+	static void cmd_w_extra_hot_water(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_CMD *p);
+	static void cmd_w_daylight_saving(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_CMD *p);
+	static void cmd_w_sanitary_priority(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_CMD *p);
+	static void cmd_w_day_delay(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_CMD *p);
+	static void cmd_w_fan_speed(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_CMD *p);
+	static void cmd_w_language(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_CMD *p);
+	static void cmd_w_digit(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_CMD *p);
+	static void cmd_w_clr_alarm(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_CMD *p);
+
+	static void reply_r_generic_2byte(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_extra_hot_water(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_daylight_saving(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_sanitary_priority(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_day_delay(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_fan_speed(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
 	// debug: log raw payload for unknown short registers
-	static void reply_r_log_raw(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_language(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_digit(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_clr_alarm(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_w_generic(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_REPLY *p);
-
-	static void empty(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p);
-	static void empty(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_SMALL_CMD *p);
-	static void empty(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_CMD *p);
-	static void empty(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void empty(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_REPLY *p);
+	static void reply_r_log_raw(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_language(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_digit(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_clr_alarm(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_w_generic(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_REPLY *p);
+
+	static void empty(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_CMD *p);
+	static void empty(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_SMALL_CMD *p);
+	static void empty(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_CMD *p);
+	static void empty(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void empty(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_REPLY *p);
 
 	// status decoder
 	// protocol version 1.60
-	static void reply_r_status_01(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_02(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_03(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_04(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_05(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_06(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_07(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_08(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_09(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_10(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_11(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_12(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_13(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_14(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_15(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_16(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_17(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_18(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_19(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_20(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_22(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_23(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_24(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_25(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_01(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_02(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	template <typename STATUS_02> static void reply_r_status_02_decode(comfortzone_heatpump *czhp, STATUS_02 *q);
+	static void reply_r_status_03(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_04(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_05(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_06(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_07(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_08(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_09(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_10(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_11(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_12(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_13(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_14(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_15(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_16(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_17(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_18(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_19(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_20(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_22(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_23(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_24(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_25(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
 
 	// protocol version 1.70
-	static void reply_r_status_v170_x79(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_v170_status_2d(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_06_v170(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v170_x79(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v170_status_2d(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_06_v170(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
 
 	// protocol version 1.80
-	static void reply_r_status_v180_x58(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_v180_x68(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_v180_x40(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_v180_x26(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_v180_x8d(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_v180_runtime_and_energy(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_v180_xa1(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_v180_02(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_v180_xa3(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_v180_xad(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_v180_xc7(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_v180_xc5(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_v180_xbf(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_v180_x6d(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_v180_x56(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_v180_short2(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_v180_ui_versions(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_v180_x2c(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_v180_xc72(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_v180_settings(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_v180_c8a(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v180_x58(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v180_x68(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v180_x40(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v180_x26(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v180_x8d(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v180_runtime_and_energy(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v180_xa1(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v180_02(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v180_xa3(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v180_xad(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v180_xc7(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v180_xc5(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v180_xbf(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v180_x6d(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v180_x56(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v180_short2(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v180_ui_versions(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v180_x2c(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v180_xc72(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v180_settings(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v180_c8a(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
 
 	// protocol version 2.21
-	static void reply_r_status_v221_xc1(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_temp_or_r_status_v221_xc5(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_v221_x51(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_v221_x88(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_v221_xf2(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
-	static void reply_r_status_v221_xb9(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v221_xc1(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v221_xc5(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v221_x51(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v221_x88(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v221_xf2(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
+	static void reply_r_status_v221_xb9(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
 };
 
+// register and dispatch tables of a protocol version (generated at compile time)
+typedef struct cz_protocol
+{
+	uint16_t version;									// HP_PROTOCOL_x_y
+
+	const czdec::KNOWN_REGISTER *registers;	// register table
+	unsigned int nb_registers;
+
+	const uint32_t *key;							// cz_reg_key() of each register (registers[] order)
+
+	const czdec::KNOWN_REGISTER * const *entry;	// registers sorted by reg_num hash
+	const uint32_t *entry_key;					// cz_reg_key() of each entry (entry[] order)
+	const byte *bucket;							// first entry of each hash, bucket[hash + 1] = end of hash entries
+	const czdec::KNOWN_REGISTER * const *craft;	// register of each craftname (NULL = not available)
+
+	// values accepted by comfortzone_heatpump::set_* methods
+	struct
+	{
+		byte fan_speed_min;
+		byte fan_speed_max;
+	} limits;
+} CZ_PROTOCOL;
+
 #endif
@@ -6,7 +6,7 @@
 // this file contains basic decoding function for commands and replies.
 // Unless debug mode is set, nothing is done here
 
-void czdec::cmd_r_generic(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_CMD *p)
+void czdec::cmd_r_generic(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_CMD *p)
 {
 #ifdef DEBUG
 	NPRINT("Wanted reply size: ");
@@ -22,7 +22,7 @@ void czdec::cmd_r_generic(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_CMD
 #endif
 }
 
-void czdec::cmd_w_generic_2byte(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p)
+void czdec::cmd_w_generic_2byte(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_CMD *p)
 {
 #ifdef DEBUG
 	int reg_v;
@@ -48,153 +48,81 @@ void czdec::cmd_w_generic_2byte(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr,
 #endif
 }
 
-void czdec::cmd_w_temp(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p)
-{
-#ifdef DEBUG
-	int reg_v;
-	float reg_v_f;
-
-	reg_v = get_uint16(p->reg_value);
-
-	reg_v_f = reg_v;
-	reg_v_f /= 10.0;
+const char cz_unit_celsius[] = "°C";
+const char cz_unit_hz[] = "Hz";
+const char cz_unit_minutes[] = "min";
+const char cz_unit_days[] = "days";
+const char cz_unit_percent[] = "%";
 
-	NPRINT(reg_v_f);
-	NPRINTLN("°C");
-
-	NPRINT("crc: ");
-	if(p->crc < 0x10)
-		NPRINT("0");
-	NPRINTLN(p->crc, HEX);
-	return;
-#endif
-}
-
-void czdec::cmd_w_temp_1byte(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p)
-{
 #ifdef DEBUG
-	int reg_v;
-	float reg_v_f;
-
-	reg_v = ((W_SMALL_CMD*)p)->reg_value;
-
-	reg_v_f = reg_v;
-	reg_v_f /= 10.0;
-
-	NPRINT(reg_v_f);
-	NPRINTLN("°C");
-
-	NPRINT("crc: ");
-	if(p->crc < 0x10)
-		NPRINT("0");
-	NPRINTLN(p->crc, HEX);
-	return;
-#endif
-}
-
-void czdec::cmd_w_freq(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p)
+// read a scalar value from a frame (little endian)
+static int get_scalar(const byte *ptr, int width, bool is_signed)
 {
-#ifdef DEBUG
-	int reg_v;
-	float reg_v_f;
-
-	reg_v = get_uint16(p->reg_value);
+	if(width == 1)
+		return (is_signed) ? (int8_t)ptr[0] : ptr[0];
 
-	reg_v_f = reg_v;
-	reg_v_f /= 10.0;
-
-	NPRINT(reg_v_f);
-	NPRINTLN("Hz");
-
-	NPRINT("crc: ");
-	if(p->crc < 0x10)
-		NPRINT("0");
-	NPRINTLN(p->crc, HEX);
-	return;
-#endif
+	return (is_signed) ? get_int16(ptr) : get_uint16(ptr);
 }
 
-void czdec::cmd_w_time(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p)
+// print value / scale followed by unit, then crc (last byte of the frame)
+static void dump_scalar(CZ_PACKET_HEADER *czph, const byte *ptr, int width, bool is_signed, int scale, const char *unit)
 {
-#ifdef DEBUG
 	int reg_v;
 	float reg_v_f;
+	byte crc;
 
-	reg_v = get_uint16(p->reg_value);
+	reg_v = get_scalar(ptr, width, is_signed);
 
-	reg_v_f = reg_v;
-	reg_v_f /= 10.0;
+	if(scale == 1)
+		NPRINT(reg_v);
+	else
+	{
+		reg_v_f = reg_v;
+		reg_v_f /= scale;
 
-	NPRINT(reg_v_f);
-	NPRINTLN("min");
+		NPRINT(reg_v_f);
+	}
+	NPRINTLN(unit);
+
+	crc = ((byte *)czph)[czph->packet_size - 1];
 
 	NPRINT("crc: ");
-	if(p->crc < 0x10)
+	if(crc < 0x10)
 		NPRINT("0");
-	NPRINTLN(p->crc, HEX);
-	return;
-#endif
+	NPRINTLN(crc, HEX);
 }
+#endif
 
-void czdec::cmd_w_time_minutes(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p)
+template <int WIDTH, bool IS_SIGNED, int SCALE, const char *UNIT>
+void czdec::cmd_w_scalar(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_CMD *p)
 {
 #ifdef DEBUG
-	int reg_v;
-
-	reg_v = get_uint16(p->reg_value);
-
-	NPRINT(reg_v);
-	NPRINTLN("min");
-
-	NPRINT("crc: ");
-	if(p->crc < 0x10)
-		NPRINT("0");
-	NPRINTLN(p->crc, HEX);
-	return;
+	dump_scalar(&p->cz_head, p->reg_value, WIDTH, IS_SIGNED, SCALE, UNIT);
 #endif
 }
 
-void czdec::cmd_w_time_days(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p)
+template <int WIDTH, bool IS_SIGNED, int SCALE, const char *UNIT>
+void czdec::reply_r_scalar(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
-	int reg_v;
-
-	reg_v = get_uint16(p->reg_value);
-
-	NPRINT(reg_v);
-	NPRINTLN("days");
-
-	NPRINT("crc: ");
-	if(p->crc < 0x10)
-		NPRINT("0");
-	NPRINTLN(p->crc, HEX);
-	return;
+	dump_scalar(&p->cz_head, p->reg_value, WIDTH, IS_SIGNED, SCALE, UNIT);
 #endif
 }
 
-void czdec::cmd_w_percentage(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p)
-{
-#ifdef DEBUG
-	int reg_v;
-	float reg_v_f;
-
-	reg_v = get_int16(p->reg_value);
+// scalar value formats used by register tables
+#define CZ_SCALAR_INSTANCE(format) \
+	template void czdec::cmd_w_scalar<format>(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_CMD *p); \
+	template void czdec::reply_r_scalar<format>(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p);
 
-	reg_v_f = reg_v;
-	reg_v_f /= 10.0;
-
-	NPRINT(reg_v_f);
-	NPRINTLN("%");
-
-	NPRINT("crc: ");
-	if(p->crc < 0x10)
-		NPRINT("0");
-	NPRINTLN(p->crc, HEX);
-	return;
-#endif
-}
+CZ_SCALAR_INSTANCE(CZ_SCALAR_TEMP)
+CZ_SCALAR_INSTANCE(CZ_SCALAR_TEMP_1BYTE)
+CZ_SCALAR_INSTANCE(CZ_SCALAR_FREQ)
+CZ_SCALAR_INSTANCE(CZ_SCALAR_TIME)
+CZ_SCALAR_INSTANCE(CZ_SCALAR_TIME_MINUTES)
+CZ_SCALAR_INSTANCE(CZ_SCALAR_TIME_DAYS)
+CZ_SCALAR_INSTANCE(CZ_SCALAR_PERCENTAGE)
 
-void czdec::cmd_w_extra_hot_water(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p)
+void czdec::cmd_w_extra_hot_water(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_CMD *p)
 {
 #ifdef DEBUG
 	int reg_v;
@@ -216,7 +144,7 @@ void czdec::cmd_w_extra_hot_water(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr
 #endif
 }
 
-void czdec::cmd_w_clr_alarm(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p)
+void czdec::cmd_w_clr_alarm(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_CMD *p)
 {
 #ifdef DEBUG
 	int reg_v;
@@ -237,7 +165,7 @@ void czdec::cmd_w_clr_alarm(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CM
 #endif
 }
 
-void czdec::cmd_w_daylight_saving(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p)
+void czdec::cmd_w_daylight_saving(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_CMD *p)
 {
 #ifdef DEBUG
 	int reg_v;
@@ -259,7 +187,7 @@ void czdec::cmd_w_daylight_saving(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr
 #endif
 }
 
-void czdec::cmd_w_sanitary_priority(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p)
+void czdec::cmd_w_sanitary_priority(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_CMD *p)
 {
 #ifdef DEBUG
 	int reg_v;
@@ -283,7 +211,7 @@ void czdec::cmd_w_sanitary_priority(comfortzone_heatpump *czhp, KNOWN_REGISTER *
 #endif
 }
 
-void czdec::cmd_w_day_delay(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p)
+void czdec::cmd_w_day_delay(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_CMD *p)
 {
 #ifdef DEBUG
 	int reg_v;
@@ -306,7 +234,7 @@ void czdec::cmd_w_day_delay(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CM
 #endif
 }
 
-void czdec::cmd_w_fan_speed(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p)
+void czdec::cmd_w_fan_speed(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_CMD *p)
 {
 #ifdef DEBUG
 	int reg_v;
@@ -319,10 +247,8 @@ void czdec::cmd_w_fan_speed(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CM
 		NPRINTLN("normal");
 	else if(reg_v == 0x03)
 		NPRINTLN("high");
-#if HP_PROTOCOL == HP_PROTOCOL_1_7 || HP_PROTOCOL == HP_PROTOCOL_1_8
-	else if(reg_v == 0x04)
+	else if((reg_v == 0x04) && ((czhp->protocol->version == HP_PROTOCOL_1_7) || (czhp->protocol->version == HP_PROTOCOL_1_8)))
 		NPRINTLN("on timer");
-#endif
 	else
 		NPRINTLN(reg_v, HEX);
 
@@ -334,7 +260,7 @@ void czdec::cmd_w_fan_speed(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CM
 #endif
 }
 
-void czdec::cmd_w_language(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p)
+void czdec::cmd_w_language(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_CMD *p)
 {
 #ifdef DEBUG
 	int reg_v;
@@ -356,7 +282,7 @@ void czdec::cmd_w_language(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD
 #endif
 }
 
-void czdec::cmd_w_digit(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p)
+void czdec::cmd_w_digit(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_CMD *p)
 {
 #ifdef DEBUG
 	int reg_v;
@@ -379,7 +305,7 @@ void czdec::cmd_w_digit(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p
 #endif
 }
 
-void czdec::reply_r_generic_2byte(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_generic_2byte(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	int reg_v;
@@ -407,153 +333,7 @@ void czdec::reply_r_generic_2byte(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr
 #endif
 }
 
-void czdec::reply_r_temp(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
-{
-#ifdef DEBUG
-	int reg_v;
-	float reg_v_f;
-
-	reg_v = get_uint16(p->reg_value);
-
-	reg_v_f = reg_v;
-	reg_v_f /= 10.0;
-
-	NPRINT(reg_v_f);
-	NPRINTLN("°C");
-
-	NPRINT("crc: ");
-	if(p->crc < 0x10)
-		NPRINT("0");
-	NPRINTLN(p->crc, HEX);
-	return;
-#endif
-}
-
-void czdec::reply_r_temp_1byte(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
-{
-#ifdef DEBUG
-	int reg_v;
-	float reg_v_f;
-
-	reg_v = ((R_SMALL_REPLY*)p)->reg_value;
-
-	reg_v_f = reg_v;
-	reg_v_f /= 10.0;
-
-	NPRINT(reg_v_f);
-	NPRINTLN("°C");
-
-	NPRINT("crc: ");
-	if(p->crc < 0x10)
-		NPRINT("0");
-	NPRINTLN(p->crc, HEX);
-	return;
-#endif
-}
-
-void czdec::reply_r_freq(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
-{
-#ifdef DEBUG
-	int reg_v;
-	float reg_v_f;
-
-	reg_v = get_uint16(p->reg_value);
-
-	reg_v_f = reg_v;
-	reg_v_f /= 10.0;
-
-	NPRINT(reg_v_f);
-	NPRINTLN("Hz");
-
-	NPRINT("crc: ");
-	if(p->crc < 0x10)
-		NPRINT("0");
-	NPRINTLN(p->crc, HEX);
-	return;
-#endif
-}
-
-void czdec::reply_r_time(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
-{
-#ifdef DEBUG
-	int reg_v;
-	float reg_v_f;
-
-	reg_v = get_uint16(p->reg_value);
-
-	reg_v_f = reg_v;
-	reg_v_f /= 10.0;
-
-	NPRINT(reg_v_f);
-	NPRINTLN("min");
-
-	NPRINT("crc: ");
-	if(p->crc < 0x10)
-		NPRINT("0");
-	NPRINTLN(p->crc, HEX);
-	return;
-#endif
-}
-
-void czdec::reply_r_time_minutes(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
-{
-#ifdef DEBUG
-	int reg_v;
-
-	reg_v = get_uint16(p->reg_value);
-
-	NPRINT(reg_v);
-	NPRINTLN("min");
-
-	NPRINT("crc: ");
-	if(p->crc < 0x10)
-		NPRINT("0");
-	NPRINTLN(p->crc, HEX);
-	return;
-#endif
-}
-
-void czdec::reply_r_time_days(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
-{
-#ifdef DEBUG
-	int reg_v;
-
-	reg_v = get_uint16(p->reg_value);
-
-	NPRINT(reg_v);
-	NPRINTLN("days");
-
-	NPRINT("crc: ");
-	if(p->crc < 0x10)
-		NPRINT("0");
-	NPRINTLN(p->crc, HEX);
-	return;
-#endif
-}
-
-void czdec::reply_r_percentage(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
-{
-#ifdef DEBUG
-	int reg_v;
-	float reg_v_f;
-
-	reg_v = get_int16(p->reg_value);
-
-	reg_v_f = reg_v;
-	reg_v_f /= 10.0;
-
-	NPRINT(reg_v_f);
-	NPRINTLN("%");
-
-	NPRINT("crc: ");
-	if(p->crc < 0x10)
-		NPRINT("0");
-	NPRINTLN(p->crc, HEX);
-	return;
-#endif
-}
-
-void czdec::reply_r_extra_hot_water(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_extra_hot_water(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	int reg_v;
@@ -578,7 +358,7 @@ void czdec::reply_r_extra_hot_water(comfortzone_heatpump *czhp, KNOWN_REGISTER *
 #endif
 }
 
-void czdec::reply_r_daylight_saving(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_daylight_saving(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	// not tested
@@ -601,7 +381,7 @@ void czdec::reply_r_daylight_saving(comfortzone_heatpump *czhp, KNOWN_REGISTER *
 #endif
 }
 
-void czdec::reply_r_sanitary_priority(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_sanitary_priority(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	int reg_v;
@@ -625,7 +405,7 @@ void czdec::reply_r_sanitary_priority(comfortzone_heatpump *czhp, KNOWN_REGISTER
 #endif
 }
 
-void czdec::reply_r_clr_alarm(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_clr_alarm(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	int reg_v;
@@ -646,7 +426,7 @@ void czdec::reply_r_clr_alarm(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_day_delay(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_day_delay(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	int reg_v;
@@ -669,7 +449,7 @@ void czdec::reply_r_day_delay(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_fan_speed(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_fan_speed(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	int reg_v;
@@ -693,7 +473,7 @@ void czdec::reply_r_fan_speed(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_language(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_language(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	int reg_v;
@@ -716,7 +496,7 @@ void czdec::reply_r_language(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_R
 }
 
 
-void czdec::reply_r_digit(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_digit(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	int reg_v;
@@ -735,7 +515,7 @@ void czdec::reply_r_digit(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPL
 #endif
 }
 
-void czdec::reply_w_generic(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_REPLY *p)
+void czdec::reply_w_generic(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_REPLY *p)
 {
 #ifdef DEBUG
 	NPRINT("Value: ");
@@ -755,23 +535,23 @@ void czdec::reply_w_generic(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_RE
 #endif
 }
 
-void czdec::empty(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_CMD *p)
+void czdec::empty(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_CMD *p)
 {
 }
 
-void czdec::empty(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_SMALL_CMD *p)
+void czdec::empty(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_SMALL_CMD *p)
 {
 }
 
-void czdec::empty(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_CMD *p)
+void czdec::empty(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_CMD *p)
 {
 }
 
-void czdec::empty(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::empty(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 }
 
-void czdec::empty(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, W_REPLY *p)
+void czdec::empty(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, W_REPLY *p)
 {
 }
 
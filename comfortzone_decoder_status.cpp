@@ -4,6 +4,128 @@
 #include "comfortzone_tools.h"
 #include "comfortzone_status.h"
 
+#include <stddef.h>
+
+// status field table entry (see czdec::STATUS_FIELD)
+#define CZ_STATUS_FIELD(s, f, is_signed, status_field, bias, scale, unit, name)	{ offsetof(s, f), sizeof(((s *)0)->f), is_signed, status_field, bias, scale, unit, name }
+#define CZ_STATUS_FIELDS(t)	t, (sizeof(t) / sizeof(t[0]))
+
+// check if at least one byte of a value changed since the previous reply (see czdec::update_reply_changes())
+static inline bool value_changed(const byte *changes, byte offset, byte width)
+{
+	uint16_t bits;
+
+	// width <= 4, value bits are in 2 consecutive bytes at most
+	bits = changes[offset >> 3] | (changes[(offset >> 3) + 1] << 8);
+
+	return ((bits >> (offset & 7)) & ((1 << width) - 1)) ? true : false;
+}
+
+// check if at least one byte of a block changed since the previous reply
+static bool block_changed(const byte *changes, byte offset, byte length)
+{
+	int i;
+
+	for(i = offset; i < offset + length; i++)
+	{
+		if(changes[i >> 3] & (1 << (i & 7)))
+			return true;
+	}
+
+	return false;
+}
+
+// read the value described by a status field table entry
+static int32_t get_status_value(const byte *frame, const czdec::STATUS_FIELD *field)
+{
+	const byte *v = frame + field->offset;
+	int32_t value;
+
+	switch(field->width)
+	{
+		case 1:	value = (field->is_signed) ? (int8_t)v[0] : v[0];
+					break;
+
+		case 2:	value = (field->is_signed) ? get_int16(v) : get_uint16(v);
+					break;
+
+		default:	value = get_uint32(v);
+					break;
+	}
+
+	return value + field->bias;
+}
+
+// copy values described by a status field table from a frame into comfortzone_status
+// only values whose bytes changed since the previous reply are decoded
+// with HP_LAZY_DECODING, values of kept frames are only decoded when read (see decode_lazy_field()),
+// except values having a subscriber or reported by the status change callback
+void czdec::decode_status_fields(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p, const STATUS_FIELD *fields, int nb_fields)
+{
+	int i;
+
+#ifdef HP_LAZY_DECODING
+	if(czhp->reply_stored)
+	{
+		uint64_t notified = (czhp->status_change_callback != NULL) ? czhp->status_change_fields : 0;
+
+		for(i = 0; i < nb_fields; i++)
+		{
+			if(!(czhp->interest_mask & ((uint64_t)1 << fields[i].status_field)))
+				continue;
+
+			if((notified & ((uint64_t)1 << fields[i].status_field))
+				|| (czstatus::has_subscriber(&czhp->comfortzone_status, fields[i].status_field)))
+			{
+				// a value still waiting for lazy decoding is decoded even if its bytes did not change
+				if((czhp->lazy_field[fields[i].status_field] == NULL) && (!value_changed(czhp->reply_changes, fields[i].offset, fields[i].width)))
+					continue;
+
+				czhp->lazy_field[fields[i].status_field] = NULL;
+				czstatus::set_field(&czhp->comfortzone_status, fields[i].status_field, get_status_value((const byte *)p, &fields[i]));
+				continue;
+			}
+
+			czhp->lazy_field[fields[i].status_field] = &fields[i];
+			czhp->lazy_register[fields[i].status_field] = kr - czhp->protocol->registers;
+			czhp->lazy_generation[fields[i].status_field] = czhp->reply_generation[czhp->lazy_register[fields[i].status_field]] - 1;
+		}
+		return;
+	}
+#endif
+
+	for(i = 0; i < nb_fields; i++)
+	{
+		if(!(czhp->interest_mask & ((uint64_t)1 << fields[i].status_field)))
+			continue;
+
+		if(!value_changed(czhp->reply_changes, fields[i].offset, fields[i].width))
+			continue;
+
+#ifdef HP_LAZY_DECODING
+		czhp->lazy_field[fields[i].status_field] = NULL;
+#endif
+
+		czstatus::set_field(&czhp->comfortzone_status, fields[i].status_field, get_status_value((const byte *)p, &fields[i]));
+	}
+}
+
+// lazy decoding: decode a status field from the kept reply frame if it changed since the last read
+void czdec::decode_lazy_field(comfortzone_heatpump *czhp, COMFORTZONE_STATUS_FIELD field)
+{
+#ifdef HP_LAZY_DECODING
+	const STATUS_FIELD *desc = (const STATUS_FIELD *)czhp->lazy_field[field];
+	byte idx = czhp->lazy_register[field];
+
+	if((desc == NULL) || (czhp->lazy_generation[field] == czhp->reply_generation[idx]))
+		return;
+
+	czhp->lazy_generation[field] = czhp->reply_generation[idx];
+
+	czstatus::set_field(&czhp->comfortzone_status, field, get_status_value(czhp->reply_store + czhp->reply_slot[idx], desc));
+#endif
+}
+
 #ifdef DEBUG
 static void dump_unknown(const char *prefix, byte *start, int length)
 {
@@ -26,14 +148,36 @@ static void dump_unknown(const char *prefix, byte *start, int length)
 }
 #endif
 
-void czdec::reply_r_status_01(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+static const czdec::STATUS_FIELD status_01_fields[] =
+	{
+		CZ_STATUS_FIELD(R_REPLY_STATUS_01, fan_time_to_filter_change, false, CZSF_FAN_TIME_TO_FILTER_CHANGE, 0, 1, "days", "Fan - time to filter change"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_01, hot_water_user_setting, false, CZSF_HOT_WATER_SETTING, 0, 10, "°C", "Hot water User setting"),
+	};
+
+static_assert((STATUS_01_NB_HW_NORMAL_STEPS == CZ_NB_HOT_WATER_STEPS)
+					&& (STATUS_01_NB_HW_HIGH_STEPS == CZ_NB_HOT_WATER_STEPS)
+					&& (STATUS_01_NB_HW_EXTRA_STEPS == CZ_NB_HOT_WATER_STEPS), "hot water steps mismatch");
+
+void czdec::reply_r_status_01(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
-	R_REPLY_STATUS_01 *q = (R_REPLY_STATUS_01 *)p;
+	R_REPLY_STATUS_01 *s = (R_REPLY_STATUS_01 *)p;
+
+	decode_status_fields(czhp, kr, p, CZ_STATUS_FIELDS(status_01_fields));
+
+	// hot water steps follow interest of hot water setting, each array is only copied when its bytes changed
+	if(czhp->interest_mask & ((uint64_t)1 << CZSF_HOT_WATER_SETTING))
+	{
+		if(block_changed(czhp->reply_changes, offsetof(R_REPLY_STATUS_01, hot_water_normal_steps), sizeof(s->hot_water_normal_steps)))
+			get_int16_array(czhp->comfortzone_status.hot_water_normal_steps, s->hot_water_normal_steps[0], CZ_NB_HOT_WATER_STEPS);
 
-	czhp->comfortzone_status.fan_time_to_filter_change = get_uint16(q->fan_time_to_filter_change);
+		if(block_changed(czhp->reply_changes, offsetof(R_REPLY_STATUS_01, hot_water_high_steps), sizeof(s->hot_water_high_steps)))
+			get_int16_array(czhp->comfortzone_status.hot_water_high_steps, s->hot_water_high_steps[0], CZ_NB_HOT_WATER_STEPS);
 
-	czhp->comfortzone_status.hot_water_setting = get_uint16(q->hot_water_user_setting);
+		if(block_changed(czhp->reply_changes, offsetof(R_REPLY_STATUS_01, hot_water_extra_steps), sizeof(s->hot_water_extra_steps)))
+			get_int16_array(czhp->comfortzone_status.hot_water_extra_steps, s->hot_water_extra_steps[0], CZ_NB_HOT_WATER_STEPS);
+	}
 #ifdef DEBUG
+	R_REPLY_STATUS_01 *q = (R_REPLY_STATUS_01 *)p;
 	int reg_v;
 	float reg_v_f;
 	int i;
@@ -280,65 +424,38 @@ void czdec::reply_r_status_01(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_status_02(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
-{
-
-#if HP_PROTOCOL != HP_PROTOCOL_1_7
-	R_REPLY_STATUS_02 *q = (R_REPLY_STATUS_02 *)p;
-#endif
-
-#if HP_PROTOCOL == HP_PROTOCOL_1_7
-	R_REPLY_STATUS_02_V170 *q = (R_REPLY_STATUS_02_V170 *)p;
-#endif
-
-	uint16_t active_alarm;
-
-	czhp->comfortzone_status.sensors_te0_outdoor_temp = get_int16(q->sensors[0]);
-	czhp->comfortzone_status.sensors_te1_flow_water = get_int16(q->sensors[1]);
-	czhp->comfortzone_status.sensors_te2_return_water = get_int16(q->sensors[2]);
-	czhp->comfortzone_status.sensors_te3_indoor_temp= get_int16(q->sensors[3]);
-	czhp->comfortzone_status.sensors_te4_hot_gas_temp = get_int16(q->sensors[4]);
-	czhp->comfortzone_status.sensors_te5_exchanger_out = get_int16(q->sensors[5]);
-	czhp->comfortzone_status.sensors_te6_evaporator_in = get_int16(q->sensors[6]);
-	czhp->comfortzone_status.sensors_te7_exhaust_air = get_int16(q->sensors[7]);
-	czhp->comfortzone_status.sensors_te24_hot_water_temp = get_int16(q->sensors[24]);
-
-#if HP_PROTOCOL == HP_PROTOCOL_1_6
-	czhp->comfortzone_status.additional_power_enabled = (q->general_status[0] & 0x20) ? true : false;
-	czhp->comfortzone_status.defrost_enabled = (q->general_status[4] & 0x04) ? true : false;
-
-	switch((q->general_status[1]>>4) & 0x3)
+// R_REPLY_STATUS_02 and R_REPLY_STATUS_02_V170 have the same fields at different offsets
+#define STATUS_02_FIELDS(s) \
+		CZ_STATUS_FIELD(s, sensors[0], true, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 0, 10, "°C", "TE0 Outdoor temp"), \
+		CZ_STATUS_FIELD(s, sensors[1], true, CZSF_SENSORS_TE1_FLOW_WATER, 0, 10, "°C", "TE1 Flow water"), \
+		CZ_STATUS_FIELD(s, sensors[2], true, CZSF_SENSORS_TE2_RETURN_WATER, 0, 10, "°C", "TE2 Return water"), \
+		CZ_STATUS_FIELD(s, sensors[3], true, CZSF_SENSORS_TE3_INDOOR_TEMP, 0, 10, "°C", "TE3 Indoor temp"), \
+		CZ_STATUS_FIELD(s, sensors[4], true, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 0, 10, "°C", "TE4 Hot gas temp"), \
+		CZ_STATUS_FIELD(s, sensors[5], true, CZSF_SENSORS_TE5_EXCHANGER_OUT, 0, 10, "°C", "TE5 Exchanger out"), \
+		CZ_STATUS_FIELD(s, sensors[6], true, CZSF_SENSORS_TE6_EVAPORATOR_IN, 0, 10, "°C", "TE6 Evaporator in"), \
+		CZ_STATUS_FIELD(s, sensors[7], true, CZSF_SENSORS_TE7_EXHAUST_AIR, 0, 10, "°C", "TE7 Exhaust air"), \
+		CZ_STATUS_FIELD(s, sensors[24], true, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 0, 10, "°C", "TE24 Hot water temp"), \
+		CZ_STATUS_FIELD(s, hour1, false, CZSF_HOUR, 0, 1, "", "Hour"), \
+		CZ_STATUS_FIELD(s, minute1, false, CZSF_MINUTE, 0, 1, "", "Minute"), \
+		CZ_STATUS_FIELD(s, second1, false, CZSF_SECOND, 0, 1, "", "Second"), \
+		CZ_STATUS_FIELD(s, day, false, CZSF_DAY, 0, 1, "", "Day"), \
+		CZ_STATUS_FIELD(s, month, false, CZSF_MONTH, 0, 1, "", "Month"), \
+		CZ_STATUS_FIELD(s, year, false, CZSF_YEAR, 2000, 1, "", "Year"), \
+		CZ_STATUS_FIELD(s, day_of_week, false, CZSF_DAY_OF_WEEK, 0, 1, "", "Day of week"),
+
+static const czdec::STATUS_FIELD status_02_fields[] =
 	{
-		case 0:	czhp->comfortzone_status.compressor_activity = CZCMP_UNKNOWN;
-					break;
-
-		case 1:	czhp->comfortzone_status.compressor_activity = CZCMP_STOPPED;
-					break;
-
-		case 2:	czhp->comfortzone_status.compressor_activity = CZCMP_RUNNING;
-					break;
+		STATUS_02_FIELDS(R_REPLY_STATUS_02)
+	};
 
-		case 3:	czhp->comfortzone_status.compressor_activity = CZCMP_STOPPING;
-					break;
-	}
-
-	switch((q->general_status[1]>>1) & 0x3)
+static const czdec::STATUS_FIELD status_02_v170_fields[] =
 	{
-		case 0:	czhp->comfortzone_status.mode = CZMD_IDLE;
-					break;
-
-		case 1:	czhp->comfortzone_status.mode = CZMD_ROOM_HEATING;
-					break;
-
-		case 2:	czhp->comfortzone_status.mode = CZMD_UNKNOWN;
-					break;
+		STATUS_02_FIELDS(R_REPLY_STATUS_02_V170)
+	};
 
-		case 3:	czhp->comfortzone_status.mode = CZMD_HOT_WATER;
-					break;
-	}
-#endif
-
-#if HP_PROTOCOL == HP_PROTOCOL_1_8
+// compressor activity and mode of v1.8 status 02 frames (bits of unknown3[9])
+static void status_02_v180_decode(comfortzone_heatpump *czhp, const R_REPLY_STATUS_02 *q)
+{
 	bool defrost = false;
 	bool running = false;
 
@@ -382,7 +499,57 @@ void czdec::reply_r_status_02(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 	}
 	czhp->comfortzone_status.room_heating_in_progress = (heating && running);
 	czhp->comfortzone_status.hot_water_production = (water && running);
-#endif
+}
+
+// v1.7 layout: unknown3 is shorter, these values are not available
+static inline void status_02_v180_decode(comfortzone_heatpump *czhp, const R_REPLY_STATUS_02_V170 *q)
+{
+}
+
+// STATUS_02 is R_REPLY_STATUS_02 or R_REPLY_STATUS_02_V170 (fields are identical, unknown3 is shorter in v1.7)
+template <typename STATUS_02>
+void czdec::reply_r_status_02_decode(comfortzone_heatpump *czhp, STATUS_02 *q)
+{
+	uint16_t active_alarm;
+
+	if(czhp->protocol->version == HP_PROTOCOL_1_6)
+	{
+		czhp->comfortzone_status.additional_power_enabled = (q->general_status[0] & 0x20) ? true : false;
+		czhp->comfortzone_status.defrost_enabled = (q->general_status[4] & 0x04) ? true : false;
+
+		switch((q->general_status[1]>>4) & 0x3)
+		{
+			case 0:	czhp->comfortzone_status.compressor_activity = CZCMP_UNKNOWN;
+						break;
+
+			case 1:	czhp->comfortzone_status.compressor_activity = CZCMP_STOPPED;
+						break;
+
+			case 2:	czhp->comfortzone_status.compressor_activity = CZCMP_RUNNING;
+						break;
+
+			case 3:	czhp->comfortzone_status.compressor_activity = CZCMP_STOPPING;
+						break;
+		}
+
+		switch((q->general_status[1]>>1) & 0x3)
+		{
+			case 0:	czhp->comfortzone_status.mode = CZMD_IDLE;
+						break;
+
+			case 1:	czhp->comfortzone_status.mode = CZMD_ROOM_HEATING;
+						break;
+
+			case 2:	czhp->comfortzone_status.mode = CZMD_UNKNOWN;
+						break;
+
+			case 3:	czhp->comfortzone_status.mode = CZMD_HOT_WATER;
+						break;
+		}
+	}
+
+	if(czhp->protocol->version == HP_PROTOCOL_1_8)
+		status_02_v180_decode(czhp, q);
 
 	active_alarm = get_uint16(q->pending_alarm) ^ get_uint16(q->acknowledged_alarm);
 
@@ -391,15 +558,6 @@ void czdec::reply_r_status_02(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 	// any alarm other than filter alarm
 	czhp->comfortzone_status.general_alarm = (active_alarm & ~0x0002) ? true : false;
 
-	czhp->comfortzone_status.hour = q->hour1;
-	czhp->comfortzone_status.minute = q->minute1;
-	czhp->comfortzone_status.second = q->second1;
-
-	czhp->comfortzone_status.day = q->day;
-	czhp->comfortzone_status.month = q->month;
-	czhp->comfortzone_status.year = 2000 + q->year;
-	czhp->comfortzone_status.day_of_week = q->day_of_week;
-
 #ifdef DEBUG
 	int reg_v;
 	float reg_v_f;
@@ -507,108 +665,111 @@ void czdec::reply_r_status_02(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 
 	// ===
 	dump_unknown("unknown_s02_3", q->unknown3, sizeof(q->unknown3));
-#if HP_PROTOCOL == HP_PROTOCOL_1_8
-	NPRINT("Add energy: ");
-	NPRINTLN( (q->unknown3[8] & 0x10) ? "on" : "off");
-
-/*
-	NPRINT("Mode (1): ");
-	switch(q->unknown3[0] & 0x3)
-	{
-		case 0:	NPRINTLN("Heating");
-					break;
-		case 1:	NPRINTLN("1?");
-					break;
-		case 2:	NPRINTLN("2?");
-					break;
-		case 3:	NPRINTLN("Hot water");
-					break;
-	}
-*/
-
-	NPRINT("Heatpump activity: ");
-	switch((q->unknown3[9]>>4) & 0x3)
-	{
-		case 0:	NPRINTLN("Stopped");
-					break;
-		case 1:	NPRINTLN("Defrost");
-					break;
-		case 2:	NPRINTLN("Running");
-					break;
-		case 3:	NPRINTLN("Stopping");
-					break;
-	}
-
-	NPRINT("Mode (2): ");
-	switch((q->unknown3[9]>>1) & 0x3)
+	if(czhp->protocol->version == HP_PROTOCOL_1_8)
 	{
-		case 0:	NPRINTLN("Idle");
-					break;
-		case 1:	NPRINTLN("Heating");
-					break;
-		case 2:	NPRINTLN("Hot water");
-					break;
-		case 3:	NPRINTLN("Heating + Hot water");
-					break;
+		NPRINT("Add energy: ");
+		NPRINTLN( (q->unknown3[8] & 0x10) ? "on" : "off");
+
+	/*
+		NPRINT("Mode (1): ");
+		switch(q->unknown3[0] & 0x3)
+		{
+			case 0:	NPRINTLN("Heating");
+						break;
+			case 1:	NPRINTLN("1?");
+						break;
+			case 2:	NPRINTLN("2?");
+						break;
+			case 3:	NPRINTLN("Hot water");
+						break;
+		}
+	*/
+
+		NPRINT("Heatpump activity: ");
+		switch((q->unknown3[9]>>4) & 0x3)
+		{
+			case 0:	NPRINTLN("Stopped");
+						break;
+			case 1:	NPRINTLN("Defrost");
+						break;
+			case 2:	NPRINTLN("Running");
+						break;
+			case 3:	NPRINTLN("Stopping");
+						break;
+		}
+
+		NPRINT("Mode (2): ");
+		switch((q->unknown3[9]>>1) & 0x3)
+		{
+			case 0:	NPRINTLN("Idle");
+						break;
+			case 1:	NPRINTLN("Heating");
+						break;
+			case 2:	NPRINTLN("Hot water");
+						break;
+			case 3:	NPRINTLN("Heating + Hot water");
+						break;
+		}
 	}
-#endif
 
 	// ===
 	dump_unknown("unknown_general_status", q->general_status, sizeof(q->general_status));
 
 	// ===
-#if HP_PROTOCOL == HP_PROTOCOL_1_6
-	NPRINT("Add energy: ");
-	NPRINTLN( (q->general_status[0] & 0x20) ? "on" : "off");
-
-	NPRINT("Mode (1): ");
-	switch(q->general_status[0] & 0x3)
+	if(czhp->protocol->version == HP_PROTOCOL_1_6)
 	{
-		case 0:	NPRINTLN("Heating");
-					break;
-		case 1:	NPRINTLN("1?");
-					break;
-		case 2:	NPRINTLN("2?");
-					break;
-		case 3:	NPRINTLN("Hot water");
-					break;
-	}
-
-	NPRINT("Heatpump activity: ");
-	switch((q->general_status[1]>>4) & 0x3)
-	{
-		case 0:	NPRINTLN("Stopped ?");
-					break;
-		case 1:	NPRINTLN("Stopped");
-					break;
-		case 2:	NPRINTLN("Running");
-					break;
-		case 3:	NPRINTLN("Stopping");
-					break;
+		NPRINT("Add energy: ");
+		NPRINTLN( (q->general_status[0] & 0x20) ? "on" : "off");
+
+		NPRINT("Mode (1): ");
+		switch(q->general_status[0] & 0x3)
+		{
+			case 0:	NPRINTLN("Heating");
+						break;
+			case 1:	NPRINTLN("1?");
+						break;
+			case 2:	NPRINTLN("2?");
+						break;
+			case 3:	NPRINTLN("Hot water");
+						break;
+		}
+
+		NPRINT("Heatpump activity: ");
+		switch((q->general_status[1]>>4) & 0x3)
+		{
+			case 0:	NPRINTLN("Stopped ?");
+						break;
+			case 1:	NPRINTLN("Stopped");
+						break;
+			case 2:	NPRINTLN("Running");
+						break;
+			case 3:	NPRINTLN("Stopping");
+						break;
+		}
+
+		NPRINT("Mode (2): ");
+		switch((q->general_status[1]>>1) & 0x3)
+		{
+			case 0:	NPRINTLN("Idle");
+						break;
+			case 1:	NPRINTLN("Heating");
+						break;
+			case 2:	NPRINTLN("2?");
+						break;
+			case 3:	NPRINTLN("Hot water");
+						break;
+		}
+
+		NPRINT("Defrost: ");
+		NPRINTLN( (q->general_status[4] & 0x04) ? "on" : "off");
 	}
 
-	NPRINT("Mode (2): ");
-	switch((q->general_status[1]>>1) & 0x3)
+	if(czhp->protocol->version == HP_PROTOCOL_1_8)
 	{
-		case 0:	NPRINTLN("Idle");
-					break;
-		case 1:	NPRINTLN("Heating");
-					break;
-		case 2:	NPRINTLN("2?");
-					break;
-		case 3:	NPRINTLN("Hot water");
-					break;
+		NPRINT("Defrost: ");
+		NPRINTLN( ((q->general_status[2] & 0x0f) == 0x0a) ? "on" : "off");
 	}
 
-	NPRINT("Defrost: ");
-	NPRINTLN( (q->general_status[4] & 0x04) ? "on" : "off");
-#endif
-
-#if HP_PROTOCOL == HP_PROTOCOL_1_8
-	NPRINT("Defrost: ");
-	NPRINTLN( ((q->general_status[2] & 0x0f) == 0x0a) ? "on" : "off");
-#endif
-
 	// ===
 	dump_unknown("unknown_s02_3b", q->unknown3b, sizeof(q->unknown3b));
 
@@ -692,7 +853,21 @@ void czdec::reply_r_status_02(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_status_03(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_02(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
+{
+	if(czhp->protocol->version == HP_PROTOCOL_1_7)
+	{
+		decode_status_fields(czhp, kr, p, CZ_STATUS_FIELDS(status_02_v170_fields));
+		reply_r_status_02_decode(czhp, (R_REPLY_STATUS_02_V170 *)p);
+	}
+	else
+	{
+		decode_status_fields(czhp, kr, p, CZ_STATUS_FIELDS(status_02_fields));
+		reply_r_status_02_decode(czhp, (R_REPLY_STATUS_02 *)p);
+	}
+}
+
+void czdec::reply_r_status_03(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_03 *q = (R_REPLY_STATUS_03 *)p;
@@ -710,7 +885,7 @@ void czdec::reply_r_status_03(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_status_04(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_04(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_04 *q = (R_REPLY_STATUS_04 *)p;
@@ -761,30 +936,35 @@ void czdec::reply_r_status_04(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_status_05(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+static const czdec::STATUS_FIELD status_05_fields[] =
+	{
+		CZ_STATUS_FIELD(R_REPLY_STATUS_05, fan_speed, false, CZSF_FAN_SPEED, 0, 1, "", "Fan speed"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_05, fan_speed_duty, false, CZSF_FAN_SPEED_DUTY, 0, 10, "%", "Fan speed duty"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_05, heating_calculated_setting, false, CZSF_ROOM_HEATING_SETTING, 0, 10, "°C", "Heating calculated setting"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_05, hot_water_calculated_setting, false, CZSF_HOT_WATER_CALCULATED_SETTING, 0, 10, "°C", "Hot water calculated setting"),
+	};
+
+void czdec::reply_r_status_05(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 	int reg_v;
 
 	R_REPLY_STATUS_05 *q = (R_REPLY_STATUS_05 *)p;
 
-#if HP_PROTOCOL == HP_PROTOCOL_1_6
-	if(q->hot_water_production == 0x00)
-		czhp->comfortzone_status.hot_water_production = false;
-	else
-		czhp->comfortzone_status.hot_water_production = true;
-
-	reg_v = get_uint16(q->room_heating_in_progress);
-	if(reg_v == 0x012C)
-		czhp->comfortzone_status.room_heating_in_progress = false;
-	else
-		czhp->comfortzone_status.room_heating_in_progress = true;
-#endif
-
-	czhp->comfortzone_status.fan_speed = q->fan_speed;
-	czhp->comfortzone_status.fan_speed_duty = get_uint16(q->fan_speed_duty);
+	if(czhp->protocol->version == HP_PROTOCOL_1_6)
+	{
+		if(q->hot_water_production == 0x00)
+			czhp->comfortzone_status.hot_water_production = false;
+		else
+			czhp->comfortzone_status.hot_water_production = true;
+
+		reg_v = get_uint16(q->room_heating_in_progress);
+		if(reg_v == 0x012C)
+			czhp->comfortzone_status.room_heating_in_progress = false;
+		else
+			czhp->comfortzone_status.room_heating_in_progress = true;
+	}
 
-	czhp->comfortzone_status.room_heating_setting = get_uint16(q->heating_calculated_setting);
-	czhp->comfortzone_status.hot_water_calculated_setting = get_uint16(q->hot_water_calculated_setting);
+	decode_status_fields(czhp, kr, p, CZ_STATUS_FIELDS(status_05_fields));
 
 	czhp->comfortzone_status.extra_hot_water_setting = ((q->extra_hot_water == 0x0F)? true : false);
 
@@ -949,25 +1129,29 @@ void czdec::reply_r_status_05(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_status_06(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+static const czdec::STATUS_FIELD status_06_fields[] =
+	{
+		CZ_STATUS_FIELD(R_REPLY_STATUS_06, heatpump_current_compressor_frequency, false, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 0, 10, "Hz", "Compressor frequency"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_06, heatpump_current_compressor_power, false, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0, 1, "W", "Compressor power"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_06, heatpump_current_add_power, false, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0, 1, "W", "Additional power"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_06, heatpump_current_total_power1, false, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0, 1, "W", "Total power"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_06, heatpump_compressor_input_power, false, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0, 1, "W", "Compressor input power"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_06, expansion_valve_calculated_setting, false, CZSF_EXPANSION_VALVE_CALCULATED_SETTING, 0, 10, "K", "Expansion valve calculated setting"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_06, expansion_valve_temperature_difference1, true, CZSF_EXPANSION_VALVE_TEMPERATURE_DIFFERENCE, 0, 10, "K", "Expansion valve temperature difference"),
+	};
+
+void czdec::reply_r_status_06(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
-	R_REPLY_STATUS_06 *q = (R_REPLY_STATUS_06 *)p;
+	decode_status_fields(czhp, kr, p, CZ_STATUS_FIELDS(status_06_fields));
 
-	czhp->comfortzone_status.heatpump_current_compressor_frequency = get_uint16(q->heatpump_current_compressor_frequency);
-
-	czhp->comfortzone_status.heatpump_current_compressor_power = get_uint16(q->heatpump_current_compressor_power);
-	czhp->comfortzone_status.heatpump_current_add_power = get_uint16(q->heatpump_current_add_power);
-	czhp->comfortzone_status.heatpump_current_total_power = get_uint16(q->heatpump_current_total_power1);
-	czhp->comfortzone_status.heatpump_current_compressor_input_power = get_uint16(q->heatpump_compressor_input_power);
-
-	czhp->comfortzone_status.expansion_valve_calculated_setting = get_uint16(q->expansion_valve_calculated_setting);
-	czhp->comfortzone_status.expansion_valve_temperature_difference = get_int16(q->expansion_valve_temperature_difference1);
-
-#if HP_PROTOCOL == HP_PROTOCOL_1_8
-	czhp->comfortzone_status.additional_power_enabled = (czhp->comfortzone_status.heatpump_current_add_power > 0);
-#endif	
+	if(czhp->protocol->version == HP_PROTOCOL_1_8)
+	{
+		czhp->comfortzone_status.additional_power_enabled = (czhp->comfortzone_status.heatpump_current_add_power > 0);
+	}
 
 #ifdef DEBUG
+	R_REPLY_STATUS_06 *q = (R_REPLY_STATUS_06 *)p;
+
 	int reg_v;
 	float reg_v_f;
 
@@ -1215,7 +1399,7 @@ void czdec::reply_r_status_06(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_status_07(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_07(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_07 *q = (R_REPLY_STATUS_07 *)p;
@@ -1243,18 +1427,22 @@ void czdec::reply_r_status_07(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_status_08(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+static const czdec::STATUS_FIELD status_08_fields[] =
+	{
+		CZ_STATUS_FIELD(R_REPLY_STATUS_08, compressor_energy, false, CZSF_COMPRESSOR_ENERGY, 0, 100, "kWh", "Compressor energy"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_08, add_energy, false, CZSF_ADD_ENERGY, 0, 100, "kWh", "Additional energy"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_08, hot_water_energy, false, CZSF_HOT_WATER_ENERGY, 0, 100, "kWh", "Hot water energy"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_08, compressor_runtime, false, CZSF_COMPRESSOR_RUNTIME, 0, 1, "min", "Compressor runtime"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_08, total_runtime, false, CZSF_TOTAL_RUNTIME, 0, 1, "min", "Total runtime"),
+	};
+
+void czdec::reply_r_status_08(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
-	R_REPLY_STATUS_08 *q = (R_REPLY_STATUS_08 *)p;
-
-	czhp->comfortzone_status.compressor_energy = get_uint32(q->compressor_energy);
-	czhp->comfortzone_status.add_energy = get_uint32(q->add_energy);
-	czhp->comfortzone_status.hot_water_energy = get_uint32(q->hot_water_energy);
-
-	czhp->comfortzone_status.compressor_runtime = get_uint32(q->compressor_runtime);
-	czhp->comfortzone_status.total_runtime = get_uint32(q->total_runtime);
+	decode_status_fields(czhp, kr, p, CZ_STATUS_FIELDS(status_08_fields));
 
 #ifdef DEBUG
+	R_REPLY_STATUS_08 *q = (R_REPLY_STATUS_08 *)p;
+
 	int reg_v;
 	float reg_v_f;
 
@@ -1365,7 +1553,7 @@ void czdec::reply_r_status_08(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_status_09(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_09(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 	int reg_v;
 
@@ -1435,7 +1623,7 @@ void czdec::reply_r_status_09(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_status_10(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_10(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_10 *q = (R_REPLY_STATUS_10 *)p;
@@ -1563,13 +1751,18 @@ void czdec::reply_r_status_10(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_status_11(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
-{
-	R_REPLY_STATUS_11 *q = (R_REPLY_STATUS_11 *)p;
+static const czdec::STATUS_FIELD status_11_fields[] =
+	{
+		CZ_STATUS_FIELD(R_REPLY_STATUS_11, led_luminosity, false, CZSF_LED_LUMINOSITY_SETTING, 0, 1, "", "Led luminosity"),
+	};
 
-	czhp->comfortzone_status.led_luminosity_setting = q->led_luminosity;
+void czdec::reply_r_status_11(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
+{
+	decode_status_fields(czhp, kr, p, CZ_STATUS_FIELDS(status_11_fields));
 
 #ifdef DEBUG
+	R_REPLY_STATUS_11 *q = (R_REPLY_STATUS_11 *)p;
+
 	int reg_v;
 	//float reg_v_f;
 
@@ -1610,7 +1803,7 @@ void czdec::reply_r_status_11(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_status_12(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_12(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_12 *q = (R_REPLY_STATUS_12 *)p;
@@ -1676,7 +1869,7 @@ void czdec::reply_r_status_12(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_status_13(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_13(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_13 *q = (R_REPLY_STATUS_13 *)p;
@@ -1695,7 +1888,7 @@ void czdec::reply_r_status_13(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_status_14(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_14(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_14 *q = (R_REPLY_STATUS_14 *)p;
@@ -1729,7 +1922,7 @@ void czdec::reply_r_status_14(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_status_15(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_15(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_15 *q = (R_REPLY_STATUS_15 *)p;
@@ -1748,7 +1941,7 @@ void czdec::reply_r_status_15(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_status_16(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_16(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_16 *q = (R_REPLY_STATUS_16 *)p;
@@ -1767,7 +1960,7 @@ void czdec::reply_r_status_16(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_status_17(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_17(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_17 *q = (R_REPLY_STATUS_17 *)p;
@@ -1786,7 +1979,7 @@ void czdec::reply_r_status_17(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_status_18(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_18(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_18 *q = (R_REPLY_STATUS_18 *)p;
@@ -1805,7 +1998,7 @@ void czdec::reply_r_status_18(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_status_19(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_19(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_19 *q = (R_REPLY_STATUS_19 *)p;
@@ -1824,7 +2017,7 @@ void czdec::reply_r_status_19(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_status_20(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_20(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_20 *q = (R_REPLY_STATUS_20 *)p;
@@ -1843,7 +2036,7 @@ void czdec::reply_r_status_20(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_status_22(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_22(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_22 *q = (R_REPLY_STATUS_22 *)p;
@@ -1861,7 +2054,7 @@ void czdec::reply_r_status_22(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_status_23(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_23(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_23 *q = (R_REPLY_STATUS_23 *)p;
@@ -1933,7 +2126,7 @@ void czdec::reply_r_status_23(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_status_24(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_24(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_24 *q = (R_REPLY_STATUS_24 *)p;
@@ -1951,7 +2144,7 @@ void czdec::reply_r_status_24(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_status_25(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_25(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_25 *q = (R_REPLY_STATUS_25 *)p;
@@ -1970,7 +2163,7 @@ void czdec::reply_r_status_25(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_
 #endif
 }
 
-void czdec::reply_r_status_v180_x58(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_v180_x58(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_V180_STATUS_x58 *q = (R_REPLY_STATUS_V180_STATUS_x58 *)p;
@@ -1992,7 +2185,7 @@ void czdec::reply_r_status_v180_x58(comfortzone_heatpump *czhp, KNOWN_REGISTER *
 #endif
 }
 
-void czdec::reply_r_status_v180_x68(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_v180_x68(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_V180_STATUS_x68 *q = (R_REPLY_STATUS_V180_STATUS_x68 *)p;
@@ -2030,14 +2223,19 @@ void czdec::reply_r_status_v180_x68(comfortzone_heatpump *czhp, KNOWN_REGISTER *
 #endif
 }
 
-void czdec::reply_r_status_v180_x40(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
-{
-	R_REPLY_STATUS_V180_STATUS_x40 *q = (R_REPLY_STATUS_V180_STATUS_x40 *)p;
+static const czdec::STATUS_FIELD status_v180_x40_fields[] =
+	{
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V180_STATUS_x40, heating_calculated_setting, false, CZSF_ROOM_HEATING_SETTING, 0, 10, "°C", "Heating calculated setting"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V180_STATUS_x40, calculated_flow_set, false, CZSF_CALCULATED_FLOW_SET, 0, 10, "°C", "Calculated flow set"),
+	};
 
-	czhp->comfortzone_status.room_heating_setting = get_uint16(q->heating_calculated_setting);
-	czhp->comfortzone_status.calculated_flow_set = get_uint16(q->calculated_flow_set);
+void czdec::reply_r_status_v180_x40(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
+{
+	decode_status_fields(czhp, kr, p, CZ_STATUS_FIELDS(status_v180_x40_fields));
 
 #ifdef DEBUG
+	R_REPLY_STATUS_V180_STATUS_x40 *q = (R_REPLY_STATUS_V180_STATUS_x40 *)p;
+
 	int reg_v;
 	float reg_v_f;
 	int i;
@@ -2088,7 +2286,7 @@ void czdec::reply_r_status_v180_x40(comfortzone_heatpump *czhp, KNOWN_REGISTER *
 #endif
 }
 
-void czdec::reply_r_status_v180_x26(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_v180_x26(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_V180_STATUS_x26 *q = (R_REPLY_STATUS_V180_STATUS_x26 *)p;
@@ -2110,13 +2308,18 @@ void czdec::reply_r_status_v180_x26(comfortzone_heatpump *czhp, KNOWN_REGISTER *
 #endif
 }
 
-void czdec::reply_r_status_v180_x8d(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
-{
-	R_REPLY_STATUS_V180_STATUS_x8d *q = (R_REPLY_STATUS_V180_STATUS_x8d *)p;
+static const czdec::STATUS_FIELD status_v180_x8d_fields[] =
+	{
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V180_STATUS_x8d, fan_time_to_filter_change, false, CZSF_FAN_TIME_TO_FILTER_CHANGE, 0, 1, "days", "Fan - time to filter change"),
+	};
 
-	czhp->comfortzone_status.fan_time_to_filter_change = get_uint16(q->fan_time_to_filter_change);
+void czdec::reply_r_status_v180_x8d(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
+{
+	decode_status_fields(czhp, kr, p, CZ_STATUS_FIELDS(status_v180_x8d_fields));
 
 #ifdef DEBUG
+	R_REPLY_STATUS_V180_STATUS_x8d *q = (R_REPLY_STATUS_V180_STATUS_x8d *)p;
+
 	int reg_v;
 	float reg_v_f;
 	int i;
@@ -2240,19 +2443,23 @@ void czdec::reply_r_status_v180_x8d(comfortzone_heatpump *czhp, KNOWN_REGISTER *
 }
 
 // 202301113 - proto v1.8 ok
-void czdec::reply_r_status_v180_runtime_and_energy(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+static const czdec::STATUS_FIELD status_v180_runtime_and_energy_fields[] =
+	{
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V180_STATUS_runtime_and_energy, compressor_energy, false, CZSF_COMPRESSOR_ENERGY, 0, 100, "kWh", "Compressor energy"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V180_STATUS_runtime_and_energy, add_energy, false, CZSF_ADD_ENERGY, 0, 100, "kWh", "Additional energy"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V180_STATUS_runtime_and_energy, hot_water_energy, false, CZSF_HOT_WATER_ENERGY, 0, 100, "kWh", "Hot water energy"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V180_STATUS_runtime_and_energy, compressor_runtime, false, CZSF_COMPRESSOR_RUNTIME, 0, 1, "min", "Compressor runtime"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V180_STATUS_runtime_and_energy, total_runtime, false, CZSF_TOTAL_RUNTIME, 0, 1, "min", "Total runtime"),
+	};
+
+void czdec::reply_r_status_v180_runtime_and_energy(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
-	R_REPLY_STATUS_V180_STATUS_runtime_and_energy *q = (R_REPLY_STATUS_V180_STATUS_runtime_and_energy *)p;
-
 	// update same informations as "Status 08" but it may be not here
-	czhp->comfortzone_status.compressor_energy = get_uint32(q->compressor_energy);
-	czhp->comfortzone_status.add_energy = get_uint32(q->add_energy);
-	czhp->comfortzone_status.hot_water_energy = get_uint32(q->hot_water_energy);
-
-	czhp->comfortzone_status.compressor_runtime = get_uint32(q->compressor_runtime);
-	czhp->comfortzone_status.total_runtime = get_uint32(q->total_runtime);
+	decode_status_fields(czhp, kr, p, CZ_STATUS_FIELDS(status_v180_runtime_and_energy_fields));
 
 #ifdef DEBUG
+	R_REPLY_STATUS_V180_STATUS_runtime_and_energy *q = (R_REPLY_STATUS_V180_STATUS_runtime_and_energy *)p;
+
 
 	int reg_v;
 	float reg_v_f;
@@ -2327,7 +2534,7 @@ void czdec::reply_r_status_v180_runtime_and_energy(comfortzone_heatpump *czhp, K
 #endif
 }
 
-void czdec::reply_r_status_v180_xa1(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_v180_xa1(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_V180_STATUS_xa1 *q = (R_REPLY_STATUS_V180_STATUS_xa1 *)p;
@@ -2348,7 +2555,7 @@ void czdec::reply_r_status_v180_xa1(comfortzone_heatpump *czhp, KNOWN_REGISTER *
 #endif
 }
 
-void czdec::reply_r_status_v180_02(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_v180_02(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 	R_REPLY_STATUS_V180_02 *q = (R_REPLY_STATUS_V180_02 *)p;
 	int reg_v;
@@ -2445,7 +2652,7 @@ void czdec::reply_r_status_v180_02(comfortzone_heatpump *czhp, KNOWN_REGISTER *k
 #endif
 }
 
-void czdec::reply_r_status_v180_xa3(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_v180_xa3(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_V180_STATUS_xa3 *q = (R_REPLY_STATUS_V180_STATUS_xa3 *)p;
@@ -2466,26 +2673,28 @@ void czdec::reply_r_status_v180_xa3(comfortzone_heatpump *czhp, KNOWN_REGISTER *
 #endif
 }
 
-void czdec::reply_r_status_v180_xad(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+static const czdec::STATUS_FIELD status_v180_xad_fields[] =
+	{
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V180_STATUS_xad, hot_water_calculated_setting, false, CZSF_HOT_WATER_CALCULATED_SETTING, 0, 10, "°C", "Hot water calculated setting"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V180_STATUS_xad, heatpump_current_compressor_frequency, false, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 0, 10, "Hz", "Compressor frequency"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V180_STATUS_xad, heatpump_current_compressor_power, false, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0, 1, "W", "Compressor power"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V180_STATUS_xad, heatpump_current_add_power, false, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0, 1, "W", "Additional power"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V180_STATUS_xad, heatpump_current_total_power1, false, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0, 1, "W", "Total power"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V180_STATUS_xad, heatpump_compressor_input_power, false, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0, 1, "W", "Compressor input power"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V180_STATUS_xad, expansion_valve_calculated_setting, false, CZSF_EXPANSION_VALVE_CALCULATED_SETTING, 0, 10, "K", "Expansion valve calculated setting"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V180_STATUS_xad, expansion_valve_temperature_difference, true, CZSF_EXPANSION_VALVE_TEMPERATURE_DIFFERENCE, 0, 10, "K", "Expansion valve temperature difference"),
+	};
+
+void czdec::reply_r_status_v180_xad(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
-	R_REPLY_STATUS_V180_STATUS_xad *q = (R_REPLY_STATUS_V180_STATUS_xad *)p;
-
 	int reg_v;
 	float reg_v_f;
 
-	czhp->comfortzone_status.hot_water_calculated_setting = get_uint16(q->hot_water_calculated_setting);
-
-	czhp->comfortzone_status.heatpump_current_compressor_frequency = get_uint16(q->heatpump_current_compressor_frequency);
-
-	czhp->comfortzone_status.heatpump_current_compressor_power = get_uint16(q->heatpump_current_compressor_power);
-	czhp->comfortzone_status.heatpump_current_add_power = get_uint32(q->heatpump_current_add_power);
-	czhp->comfortzone_status.heatpump_current_total_power = get_uint32(q->heatpump_current_total_power1);
-	czhp->comfortzone_status.heatpump_current_compressor_input_power = get_uint16(q->heatpump_compressor_input_power);
-
-	czhp->comfortzone_status.expansion_valve_calculated_setting = get_uint16(q->expansion_valve_calculated_setting);
-	czhp->comfortzone_status.expansion_valve_temperature_difference = get_int16(q->expansion_valve_temperature_difference);
+	decode_status_fields(czhp, kr, p, CZ_STATUS_FIELDS(status_v180_xad_fields));
 
 #ifdef DEBUG
+	R_REPLY_STATUS_V180_STATUS_xad *q = (R_REPLY_STATUS_V180_STATUS_xad *)p;
+
 	int i;
 	// ===
 
@@ -2748,7 +2957,7 @@ void czdec::reply_r_status_v180_xad(comfortzone_heatpump *czhp, KNOWN_REGISTER *
 #endif
 }
 
-void czdec::reply_r_status_v180_xc7(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_v180_xc7(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_V180_STATUS_xc7 *q = (R_REPLY_STATUS_V180_STATUS_xc7 *)p;
@@ -2770,7 +2979,7 @@ void czdec::reply_r_status_v180_xc7(comfortzone_heatpump *czhp, KNOWN_REGISTER *
 #endif
 }
 
-void czdec::reply_r_status_v180_xc72(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_v180_xc72(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_V180_STATUS_xc72 *q = (R_REPLY_STATUS_V180_STATUS_xc72 *)p;
@@ -2791,7 +3000,7 @@ void czdec::reply_r_status_v180_xc72(comfortzone_heatpump *czhp, KNOWN_REGISTER
 #endif
 }
 
-void czdec::reply_r_status_v180_xc5(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_v180_xc5(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_V180_STATUS_xc5 *q = (R_REPLY_STATUS_V180_STATUS_xc5 *)p;
@@ -2810,7 +3019,7 @@ void czdec::reply_r_status_v180_xc5(comfortzone_heatpump *czhp, KNOWN_REGISTER *
 #endif
 }
 
-void czdec::reply_r_status_v180_xbf(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_v180_xbf(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_V180_STATUS_xbf *q = (R_REPLY_STATUS_V180_STATUS_xbf *)p;
@@ -2851,7 +3060,7 @@ void czdec::reply_r_status_v180_xbf(comfortzone_heatpump *czhp, KNOWN_REGISTER *
 #endif
 }
 
-void czdec::reply_r_status_v180_x6d(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_v180_x6d(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_V180_STATUS_x6d *q = (R_REPLY_STATUS_V180_STATUS_x6d *)p;
@@ -2873,7 +3082,7 @@ void czdec::reply_r_status_v180_x6d(comfortzone_heatpump *czhp, KNOWN_REGISTER *
 #endif
 }
 
-void czdec::reply_r_status_v180_x56(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_v180_x56(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 	R_REPLY_STATUS_V180_STATUS_x56 *q = (R_REPLY_STATUS_V180_STATUS_x56 *)p;
 
@@ -2936,7 +3145,7 @@ void czdec::reply_r_status_v180_x56(comfortzone_heatpump *czhp, KNOWN_REGISTER *
 #endif
 }
 
-void czdec::reply_r_status_v180_short2(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_v180_short2(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_V180_STATUS_SHORT2 *q = (R_REPLY_STATUS_V180_STATUS_SHORT2 *)p;
@@ -2958,7 +3167,7 @@ void czdec::reply_r_status_v180_short2(comfortzone_heatpump *czhp, KNOWN_REGISTE
 #endif
 }
 
-void czdec::reply_r_status_v180_ui_versions(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_v180_ui_versions(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_V180_STATUS_ui_versions *q = (R_REPLY_STATUS_V180_STATUS_ui_versions *)p;
@@ -2994,7 +3203,7 @@ void czdec::reply_r_status_v180_ui_versions(comfortzone_heatpump *czhp, KNOWN_RE
 #endif
 }
 
-void czdec::reply_r_status_v180_x2c(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+void czdec::reply_r_status_v180_x2c(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
 #ifdef DEBUG
 	R_REPLY_STATUS_V180_STATUS_x2c *q = (R_REPLY_STATUS_V180_STATUS_x2c *)p;
@@ -3016,13 +3225,18 @@ void czdec::reply_r_status_v180_x2c(comfortzone_heatpump *czhp, KNOWN_REGISTER *
 #endif
 }
 
-void czdec::reply_r_status_v180_settings(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
-{
-	R_REPLY_STATUS_V180_SETTINGS *q = (R_REPLY_STATUS_V180_SETTINGS *)p;
+static const czdec::STATUS_FIELD status_v180_settings_fields[] =
+	{
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V180_SETTINGS, hot_water_user_setting, false, CZSF_HOT_WATER_SETTING, 0, 10, "°C", "Hot water User setting"),
+	};
 
-	czhp->comfortzone_status.hot_water_setting = get_uint16(q->hot_water_user_setting);
+void czdec::reply_r_status_v180_settings(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
+{
+	decode_status_fields(czhp, kr, p, CZ_STATUS_FIELDS(status_v180_settings_fields));
 
 #ifdef DEBUG
+	R_REPLY_STATUS_V180_SETTINGS *q = (R_REPLY_STATUS_V180_SETTINGS *)p;
+
 
 	int reg_v;
 	float reg_v_f;
@@ -3053,15 +3267,20 @@ void czdec::reply_r_status_v180_settings(comfortzone_heatpump *czhp, KNOWN_REGIS
 #endif
 }
 
-void czdec::reply_r_status_v180_c8a(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
-{
-	R_REPLY_STATUS_V180_C8A *q = (R_REPLY_STATUS_V180_C8A *)p;
+static const czdec::STATUS_FIELD status_v180_c8a_fields[] =
+	{
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V180_C8A, fan_speed_duty, false, CZSF_FAN_SPEED_DUTY, 0, 10, "%", "Fan speed duty"),
+	};
 
-	czhp->comfortzone_status.fan_speed_duty = get_uint16(q->fan_speed_duty);
+void czdec::reply_r_status_v180_c8a(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
+{
+	decode_status_fields(czhp, kr, p, CZ_STATUS_FIELDS(status_v180_c8a_fields));
 
 	//czhp->comfortzone_status.fan_speed = q->fan_speed;
 
 #ifdef DEBUG
+	R_REPLY_STATUS_V180_C8A *q = (R_REPLY_STATUS_V180_C8A *)p;
+
 
 	int reg_v;
 	float reg_v_f;
@@ -3089,13 +3308,18 @@ void czdec::reply_r_status_v180_c8a(comfortzone_heatpump *czhp, KNOWN_REGISTER *
 #endif
 }
 
-void czdec::reply_r_status_v221_xc1(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
-{
-	R_REPLY_STATUS_V221_xC1 *q = (R_REPLY_STATUS_V221_xC1 *)p;
+static const czdec::STATUS_FIELD status_v221_xc1_fields[] =
+	{
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V221_xC1, heating_calculated_setting, false, CZSF_ROOM_HEATING_SETTING, 0, 10, "°C", "Heating calculated setting"),
+	};
 
-	czhp->comfortzone_status.room_heating_setting = get_uint16(q->heating_calculated_setting);
+void czdec::reply_r_status_v221_xc1(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
+{
+	decode_status_fields(czhp, kr, p, CZ_STATUS_FIELDS(status_v221_xc1_fields));
 
 #ifdef DEBUG
+	R_REPLY_STATUS_V221_xC1 *q = (R_REPLY_STATUS_V221_xC1 *)p;
+
 	int reg_v;
 	float reg_v_f;
 	int i;
@@ -3126,15 +3350,19 @@ void czdec::reply_r_status_v221_xc1(comfortzone_heatpump *czhp, KNOWN_REGISTER *
 #endif
 }
 
-void czdec::reply_r_status_v221_x51(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
-{
-	R_REPLY_STATUS_V221_x51 *q = (R_REPLY_STATUS_V221_x51 *)p;
-
-	czhp->comfortzone_status.fan_speed = q->fan_speed;
+static const czdec::STATUS_FIELD status_v221_x51_fields[] =
+	{
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V221_x51, fan_speed, false, CZSF_FAN_SPEED, 0, 1, "", "Fan speed"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V221_x51, heatpump_current_compressor_frequency, false, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 0, 10, "Hz", "Compressor frequency"),
+	};
 
-	czhp->comfortzone_status.heatpump_current_compressor_frequency = get_uint16(q->heatpump_current_compressor_frequency);
+void czdec::reply_r_status_v221_x51(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
+{
+	decode_status_fields(czhp, kr, p, CZ_STATUS_FIELDS(status_v221_x51_fields));
 
 #ifdef DEBUG
+	R_REPLY_STATUS_V221_x51 *q = (R_REPLY_STATUS_V221_x51 *)p;
+
 	int reg_v;
 	float reg_v_f;
 	int i;
@@ -3266,30 +3494,33 @@ void czdec::reply_r_status_v221_x51(comfortzone_heatpump *czhp, KNOWN_REGISTER *
 #endif
 }
 
-void czdec::reply_r_status_v221_x88(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+static const czdec::STATUS_FIELD status_v221_x88_fields[] =
+	{
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V221_x88, hour1, false, CZSF_HOUR, 0, 1, "", "Hour"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V221_x88, minute1, false, CZSF_MINUTE, 0, 1, "", "Minute"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V221_x88, second1, false, CZSF_SECOND, 0, 1, "", "Second"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V221_x88, day, false, CZSF_DAY, 0, 1, "", "Day"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V221_x88, month, false, CZSF_MONTH, 0, 1, "", "Month"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V221_x88, year, false, CZSF_YEAR, 2000, 1, "", "Year"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V221_x88, day_of_week, false, CZSF_DAY_OF_WEEK, 0, 1, "", "Day of week"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V221_x88, sensors[0], true, CZSF_SENSORS_TE0_OUTDOOR_TEMP, 0, 10, "°C", "TE0 Outdoor temp"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V221_x88, sensors[1], true, CZSF_SENSORS_TE1_FLOW_WATER, 0, 10, "°C", "TE1 Flow water"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V221_x88, sensors[2], true, CZSF_SENSORS_TE2_RETURN_WATER, 0, 10, "°C", "TE2 Return water"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V221_x88, sensors[3], true, CZSF_SENSORS_TE3_INDOOR_TEMP, 0, 10, "°C", "TE3 Indoor temp"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V221_x88, sensors[4], true, CZSF_SENSORS_TE4_HOT_GAS_TEMP, 0, 10, "°C", "TE4 Hot gas temp"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V221_x88, sensors[5], true, CZSF_SENSORS_TE5_EXCHANGER_OUT, 0, 10, "°C", "TE5 Exchanger out"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V221_x88, sensors[6], true, CZSF_SENSORS_TE6_EVAPORATOR_IN, 0, 10, "°C", "TE6 Evaporator in"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V221_x88, sensors[7], true, CZSF_SENSORS_TE7_EXHAUST_AIR, 0, 10, "°C", "TE7 Exhaust air"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V221_x88, sensors[24], true, CZSF_SENSORS_TE24_HOT_WATER_TEMP, 0, 10, "°C", "TE24 Hot water temp"),
+	};
+
+void czdec::reply_r_status_v221_x88(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
-	R_REPLY_STATUS_V221_x88 *q = (R_REPLY_STATUS_V221_x88 *)p;
-
-	czhp->comfortzone_status.hour = q->hour1;
-	czhp->comfortzone_status.minute = q->minute1;
-	czhp->comfortzone_status.second = q->second1;
-
-	czhp->comfortzone_status.day = q->day;
-	czhp->comfortzone_status.month = q->month;
-	czhp->comfortzone_status.year = 2000 + q->year;
-	czhp->comfortzone_status.day_of_week = q->day_of_week;
-
-	czhp->comfortzone_status.sensors_te0_outdoor_temp = get_int16(q->sensors[0]);
-	czhp->comfortzone_status.sensors_te1_flow_water = get_int16(q->sensors[1]);
-	czhp->comfortzone_status.sensors_te2_return_water = get_int16(q->sensors[2]);
-	czhp->comfortzone_status.sensors_te3_indoor_temp= get_int16(q->sensors[3]);
-	czhp->comfortzone_status.sensors_te4_hot_gas_temp = get_int16(q->sensors[4]);
-	czhp->comfortzone_status.sensors_te5_exchanger_out = get_int16(q->sensors[5]);
-	czhp->comfortzone_status.sensors_te6_evaporator_in = get_int16(q->sensors[6]);
-	czhp->comfortzone_status.sensors_te7_exhaust_air = get_int16(q->sensors[7]);
-	czhp->comfortzone_status.sensors_te24_hot_water_temp = get_int16(q->sensors[24]);
+	decode_status_fields(czhp, kr, p, CZ_STATUS_FIELDS(status_v221_x88_fields));
 
 #ifdef DEBUG
+	R_REPLY_STATUS_V221_x88 *q = (R_REPLY_STATUS_V221_x88 *)p;
+
 	int reg_v;
 	float reg_v_f;
 	int i;
@@ -3403,83 +3634,57 @@ void czdec::reply_r_status_v221_x88(comfortzone_heatpump *czhp, KNOWN_REGISTER *
 #endif
 }
 
-void czdec::reply_r_temp_or_r_status_v221_xc5(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
-{
-	// the read command is a 1-byte parameter command. However, if the read parameter is 0x02, the reply is like a 2-bytes parameter command reply but if the read parameter is 0xAF, the reply is a status frame
-	if(p->cz_head.packet_size == 0x18)	// reply of a read command with parameter = 0x02
-	{
-		// 
-#ifdef DEBUG
-		dump_unknown("RAW R_REPLY_STATUS_V221_xc5_0x18", (byte *)p, sizeof(*p));
-		NPRINTLN("");
-
-		int reg_v;
-		float reg_v_f;
-	
-		reg_v = get_uint16(p->reg_value);
-	
-		reg_v_f = reg_v;
-		reg_v_f /= 10.0; 
-		
-		NPRINT(reg_v_f); 
-		NPRINTLN("°C");
-
-		NPRINT("crc: "); 
-		if(p->crc < 0x10)
-			NPRINT("0");
-		NPRINTLN(p->crc, HEX);
-		return;
-#endif
-	}
-	else if(p->cz_head.packet_size == 0xc5)	// reply of a read command with parameter = 0xAF
+static const czdec::STATUS_FIELD status_v221_xc5_fields[] =
 	{
-		R_REPLY_STATUS_V221_xc5 *q = (R_REPLY_STATUS_V221_xc5 *)p;
-
-		czhp->comfortzone_status.hot_water_calculated_setting = get_uint16(q->hot_water_calculated_setting);
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V221_xc5, hot_water_calculated_setting, false, CZSF_HOT_WATER_CALCULATED_SETTING, 0, 10, "°C", "Hot water calculated setting"),
+	};
 
+void czdec::reply_r_status_v221_xc5(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
+{
+	// reply of a read command with parameter = 0xAF (see "Hot water calculated setting" register for parameter = 0x02)
+	decode_status_fields(czhp, kr, p, CZ_STATUS_FIELDS(status_v221_xc5_fields));
 #ifdef DEBUG
-		int reg_v;
-		float reg_v_f;
-		int i;
+	R_REPLY_STATUS_V221_xc5 *q = (R_REPLY_STATUS_V221_xc5 *)p;
 
-		dump_unknown("RAW R_REPLY_STATUS_V221_xc5_0xc5", (byte *)q, sizeof(*q));
-		NPRINTLN("");
+	int reg_v;
+	float reg_v_f;
+	int i;
 
-		// ===
-		reg_v = get_uint16(q->hot_water_calculated_setting);
+	dump_unknown("RAW R_REPLY_STATUS_V221_xc5_0xc5", (byte *)q, sizeof(*q));
+	NPRINTLN("");
 
-		reg_v_f = reg_v;
-		reg_v_f /= 10.0;
+	// ===
+	reg_v = get_uint16(q->hot_water_calculated_setting);
 
-		NPRINT("Hot water Calculated setting (0xc5): ");
-		NPRINT(reg_v_f);
-		NPRINTLN("°C");
+	reg_v_f = reg_v;
+	reg_v_f /= 10.0;
 
-		// ===
-		dump_unknown("unknown0_xc5", q->unknown0, sizeof(q->unknown0));
+	NPRINT("Hot water Calculated setting (0xc5): ");
+	NPRINT(reg_v_f);
+	NPRINTLN("°C");
 
-		NPRINT("crc: ");
-		if(q->crc < 0x10)
-			NPRINT("0");
-		NPRINTLN(q->crc, HEX);
-#endif
-	}
-	else
-	{
-#ifdef DEBUG
-		dump_unknown("RAW R_REPLY_STATUS_V221_xc5_0x??", (byte *)p, (int)(p->cz_head.packet_size));
-		NPRINTLN("");
+	// ===
+	dump_unknown("unknown0_xc5", q->unknown0, sizeof(q->unknown0));
+
+	NPRINT("crc: ");
+	if(q->crc < 0x10)
+		NPRINT("0");
+	NPRINTLN(q->crc, HEX);
 #endif
-	}
 }
 
-void czdec::reply_r_status_v221_xf2(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
-{
-	R_REPLY_STATUS_V221_xf2 *q = (R_REPLY_STATUS_V221_xf2 *)p;
+static const czdec::STATUS_FIELD status_v221_xf2_fields[] =
+	{
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V221_xf2, fan_time_to_filter_change, false, CZSF_FAN_TIME_TO_FILTER_CHANGE, 0, 1, "days", "Fan - time to filter change"),
+	};
 
-	czhp->comfortzone_status.fan_time_to_filter_change = get_uint16(q->fan_time_to_filter_change);
+void czdec::reply_r_status_v221_xf2(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
+{
+	decode_status_fields(czhp, kr, p, CZ_STATUS_FIELDS(status_v221_xf2_fields));
 
 #ifdef DEBUG
+	R_REPLY_STATUS_V221_xf2 *q = (R_REPLY_STATUS_V221_xf2 *)p;
+
 	int reg_v;
 	float reg_v_f;
 	int i;
@@ -3507,18 +3712,23 @@ void czdec::reply_r_status_v221_xf2(comfortzone_heatpump *czhp, KNOWN_REGISTER *
 #endif
 }
 
-void czdec::reply_r_status_v221_xb9(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
-{
-	R_REPLY_STATUS_V221_xb9 *q = (R_REPLY_STATUS_V221_xb9 *)p;
+static const czdec::STATUS_FIELD status_v221_xb9_fields[] =
+	{
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V221_xb9, heatpump_current_compressor_power, false, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0, 1, "W", "Compressor power"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V221_xb9, heatpump_current_add_power, false, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0, 1, "W", "Additional power"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V221_xb9, heatpump_current_total_power1, false, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0, 1, "W", "Total power"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V221_xb9, heatpump_compressor_input_power, false, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0, 1, "W", "Compressor input power"),
+	};
 
-	czhp->comfortzone_status.heatpump_current_compressor_power = get_uint16(q->heatpump_current_compressor_power);
-	czhp->comfortzone_status.heatpump_current_add_power = get_uint32(q->heatpump_current_add_power);
-	czhp->comfortzone_status.heatpump_current_total_power = get_uint32(q->heatpump_current_total_power1);
-	czhp->comfortzone_status.heatpump_current_compressor_input_power = get_uint16(q->heatpump_compressor_input_power);
+void czdec::reply_r_status_v221_xb9(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
+{
+	decode_status_fields(czhp, kr, p, CZ_STATUS_FIELDS(status_v221_xb9_fields));
 
 	czhp->comfortzone_status.additional_power_enabled = (czhp->comfortzone_status.heatpump_current_add_power > 0);
 
 #ifdef DEBUG
+	R_REPLY_STATUS_V221_xb9 *q = (R_REPLY_STATUS_V221_xb9 *)p;
+
 	int reg_v;
 	float reg_v_f;
 	int i;
@@ -3575,14 +3785,18 @@ void czdec::reply_r_status_v221_xb9(comfortzone_heatpump *czhp, KNOWN_REGISTER *
 // Version 1.7
 // -----------------------------
 
-void czdec::reply_r_status_v170_x79(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+static const czdec::STATUS_FIELD status_v170_x79_fields[] =
+	{
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V170_X79, fan_time_to_filter_change, false, CZSF_FAN_TIME_TO_FILTER_CHANGE, 0, 1, "days", "Fan - time to filter change"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V170_X79, hot_water_extra_setting, false, CZSF_HOT_WATER_SETTING, 0, 10, "°C", "Hot water - extra setting"),
+	};
+
+void czdec::reply_r_status_v170_x79(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
+	decode_status_fields(czhp, kr, p, CZ_STATUS_FIELDS(status_v170_x79_fields));
+#ifdef DEBUG
 	R_REPLY_STATUS_V170_X79 *q = (R_REPLY_STATUS_V170_X79 *)p;
 
-	czhp->comfortzone_status.fan_time_to_filter_change = get_uint16(q->fan_time_to_filter_change);
-
-	czhp->comfortzone_status.hot_water_setting = get_uint16(q->hot_water_extra_setting);
-#ifdef DEBUG
 	int reg_v;
 	float reg_v_f;
 	int i;
@@ -3827,13 +4041,18 @@ void czdec::reply_r_status_v170_x79(comfortzone_heatpump *czhp, KNOWN_REGISTER *
 #endif
 }
 
-void czdec::reply_r_status_v170_status_2d(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p) 
-{
-	R_REPLY_STATUS_V170_STATUS_2D *q = (R_REPLY_STATUS_V170_STATUS_2D *)p;
+static const czdec::STATUS_FIELD status_v170_status_2d_fields[] =
+	{
+		CZ_STATUS_FIELD(R_REPLY_STATUS_V170_STATUS_2D, heating_calculated_setting, false, CZSF_ROOM_HEATING_SETTING, 0, 10, "°C", "Heating calculated setting"),
+	};
 
-	czhp->comfortzone_status.room_heating_setting = get_uint16(q->heating_calculated_setting);
+void czdec::reply_r_status_v170_status_2d(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p) 
+{
+	decode_status_fields(czhp, kr, p, CZ_STATUS_FIELDS(status_v170_status_2d_fields));
 	
 #ifdef DEBUG
+	R_REPLY_STATUS_V170_STATUS_2D *q = (R_REPLY_STATUS_V170_STATUS_2D *)p;
+
 	int reg_v;
 	float reg_v_f;
 	int i;
@@ -3884,21 +4103,27 @@ void czdec::reply_r_status_v170_status_2d(comfortzone_heatpump *czhp, KNOWN_REGI
 #endif
 }
 
-void czdec::reply_r_status_06_v170(comfortzone_heatpump *czhp, KNOWN_REGISTER *kr, R_REPLY *p)
+static const czdec::STATUS_FIELD status_06_v170_fields[] =
+	{
+		CZ_STATUS_FIELD(R_REPLY_STATUS_06_V170, heatpump_current_compressor_frequency, false, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY, 0, 10, "Hz", "Compressor frequency"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_06_V170, heatpump_current_compressor_power, false, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER, 0, 1, "W", "Compressor power"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_06_V170, heatpump_current_add_power, false, CZSF_HEATPUMP_CURRENT_ADD_POWER, 0, 1, "W", "Additional power"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_06_V170, heatpump_current_total_power1, false, CZSF_HEATPUMP_CURRENT_TOTAL_POWER, 0, 1, "W", "Total power"),
+		CZ_STATUS_FIELD(R_REPLY_STATUS_06_V170, heatpump_compressor_input_power, false, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER, 0, 1, "W", "Compressor input power"),
+	};
+
+void czdec::reply_r_status_06_v170(comfortzone_heatpump *czhp, const KNOWN_REGISTER *kr, R_REPLY *p)
 {
-	R_REPLY_STATUS_06_V170 *q = (R_REPLY_STATUS_06_V170 *)p;
-
-	czhp->comfortzone_status.heatpump_current_compressor_frequency = get_uint16(q->heatpump_current_compressor_frequency);
-	czhp->comfortzone_status.heatpump_current_compressor_power = get_uint16(q->heatpump_current_compressor_power);
-	czhp->comfortzone_status.heatpump_current_add_power = get_uint16(q->heatpump_current_add_power);
-	czhp->comfortzone_status.heatpump_current_total_power = get_uint16(q->heatpump_current_total_power1);
-	czhp->comfortzone_status.heatpump_current_compressor_input_power = get_uint16(q->heatpump_compressor_input_power);
+	decode_status_fields(czhp, kr, p, CZ_STATUS_FIELDS(status_06_v170_fields));
 
-#if HP_PROTOCOL == HP_PROTOCOL_1_8
-	czhp->comfortzone_status.additional_power_enabled = (czhp->comfortzone_status.heatpump_current_add_power > 0);
-#endif	
+	if(czhp->protocol->version == HP_PROTOCOL_1_8)
+	{
+		czhp->comfortzone_status.additional_power_enabled = (czhp->comfortzone_status.heatpump_current_add_power > 0);
+	}
 
 #ifdef DEBUG
+	R_REPLY_STATUS_06_V170 *q = (R_REPLY_STATUS_06_V170 *)p;
+
 	int reg_v;
 	float reg_v_f;
 
@@ -4144,4 +4369,65 @@ void czdec::reply_r_status_06_v170(comfortzone_heatpump *czhp, KNOWN_REGISTER *k
 		NPRINT("0");
 	NPRINTLN(q->crc, HEX);
 #endif
-}
\ No newline at end of file
+}
+
+// status field tables of each status frame format (see czdec::get_status_fields())
+typedef struct
+{
+	void (*reply_r)(comfortzone_heatpump *czhp, const czdec::KNOWN_REGISTER *kr, R_REPLY *p);
+	byte frame_size;
+
+	const czdec::STATUS_FIELD *fields;
+	byte nb_fields;
+} CZ_STATUS_FIELD_TABLE;
+
+#define CZ_STATUS_TABLE(decoder, s, t)	{ decoder, sizeof(s), CZ_STATUS_FIELDS(t) }
+
+static const CZ_STATUS_FIELD_TABLE status_field_tables[] =
+	{
+		CZ_STATUS_TABLE(czdec::reply_r_status_01, R_REPLY_STATUS_01, status_01_fields),
+		CZ_STATUS_TABLE(czdec::reply_r_status_02, R_REPLY_STATUS_02, status_02_fields),
+		CZ_STATUS_TABLE(czdec::reply_r_status_02, R_REPLY_STATUS_02_V170, status_02_v170_fields),
+		CZ_STATUS_TABLE(czdec::reply_r_status_05, R_REPLY_STATUS_05, status_05_fields),
+		CZ_STATUS_TABLE(czdec::reply_r_status_06, R_REPLY_STATUS_06, status_06_fields),
+		CZ_STATUS_TABLE(czdec::reply_r_status_08, R_REPLY_STATUS_08, status_08_fields),
+		CZ_STATUS_TABLE(czdec::reply_r_status_11, R_REPLY_STATUS_11, status_11_fields),
+		CZ_STATUS_TABLE(czdec::reply_r_status_v180_x40, R_REPLY_STATUS_V180_STATUS_x40, status_v180_x40_fields),
+		CZ_STATUS_TABLE(czdec::reply_r_status_v180_x8d, R_REPLY_STATUS_V180_STATUS_x8d, status_v180_x8d_fields),
+		CZ_STATUS_TABLE(czdec::reply_r_status_v180_runtime_and_energy, R_REPLY_STATUS_V180_STATUS_runtime_and_energy, status_v180_runtime_and_energy_fields),
+		CZ_STATUS_TABLE(czdec::reply_r_status_v180_xad, R_REPLY_STATUS_V180_STATUS_xad, status_v180_xad_fields),
+		CZ_STATUS_TABLE(czdec::reply_r_status_v180_settings, R_REPLY_STATUS_V180_SETTINGS, status_v180_settings_fields),
+		CZ_STATUS_TABLE(czdec::reply_r_status_v180_c8a, R_REPLY_STATUS_V180_C8A, status_v180_c8a_fields),
+		CZ_STATUS_TABLE(czdec::reply_r_status_v221_xc1, R_REPLY_STATUS_V221_xC1, status_v221_xc1_fields),
+		CZ_STATUS_TABLE(czdec::reply_r_status_v221_x51, R_REPLY_STATUS_V221_x51, status_v221_x51_fields),
+		CZ_STATUS_TABLE(czdec::reply_r_status_v221_x88, R_REPLY_STATUS_V221_x88, status_v221_x88_fields),
+		CZ_STATUS_TABLE(czdec::reply_r_status_v221_xc5, R_REPLY_STATUS_V221_xc5, status_v221_xc5_fields),
+		CZ_STATUS_TABLE(czdec::reply_r_status_v221_xf2, R_REPLY_STATUS_V221_xf2, status_v221_xf2_fields),
+		CZ_STATUS_TABLE(czdec::reply_r_status_v221_xb9, R_REPLY_STATUS_V221_xb9, status_v221_xb9_fields),
+		CZ_STATUS_TABLE(czdec::reply_r_status_v170_x79, R_REPLY_STATUS_V170_X79, status_v170_x79_fields),
+		CZ_STATUS_TABLE(czdec::reply_r_status_v170_status_2d, R_REPLY_STATUS_V170_STATUS_2D, status_v170_status_2d_fields),
+		CZ_STATUS_TABLE(czdec::reply_r_status_06_v170, R_REPLY_STATUS_06_V170, status_06_v170_fields),
+	};
+
+#define NB_STATUS_FIELD_TABLES (sizeof(status_field_tables) / sizeof(status_field_tables[0]))
+
+// find the status field table used to decode a frame
+// input: register of the frame
+//        frame size (some registers use several frame formats)
+// output: NULL if no value of the frame is described by a table
+const czdec::STATUS_FIELD *czdec::get_status_fields(const KNOWN_REGISTER *kr, byte frame_size, int *nb_fields)
+{
+	unsigned int i;
+
+	for(i = 0; i < NB_STATUS_FIELD_TABLES; i++)
+	{
+		if((status_field_tables[i].reply_r == kr->reply_r) && (status_field_tables[i].frame_size == frame_size))
+		{
+			*nb_fields = status_field_tables[i].nb_fields;
+			return status_field_tables[i].fields;
+		}
+	}
+
+	*nb_fields = 0;
+	return NULL;
+}
@@ -3,6 +3,8 @@
 
 #include "platform_specific.h"
 
+#include <string.h>
+
 // This file contains the description of RS485 frames
 
 /*
@@ -28,6 +30,23 @@ typedef struct __attribute__ ((packed)) cz_packet_header
 	byte reg_num[9];
 } CZ_PACKET_HEADER;
 
+// compact register key: reg_num bytes 5 to 8 (bytes 0 to 4 are 01 02 03 04 0B for all known registers)
+// reg_num having another prefix all get CZ_REG_KEY_IRREGULAR and are compared byte per byte
+#define CZ_REG_KEY_IRREGULAR 0xFFFFFFFFUL
+
+static constexpr inline uint32_t cz_reg_key(const byte *reg_num)
+{
+	return ((reg_num[0] == 0x01) && (reg_num[1] == 0x02) && (reg_num[2] == 0x03) && (reg_num[3] == 0x04) && (reg_num[4] == 0x0B))
+				? (((uint32_t)reg_num[5] << 24) | ((uint32_t)reg_num[6] << 16) | ((uint32_t)reg_num[7] << 8) | (uint32_t)reg_num[8])
+				: CZ_REG_KEY_IRREGULAR;
+}
+
+// check if 2 reg_num are the same register (key_a = cz_reg_key(reg_num_a), key_b = cz_reg_key(reg_num_b))
+static inline bool cz_same_reg(uint32_t key_a, const byte *reg_num_a, uint32_t key_b, const byte *reg_num_b)
+{
+	return (key_a == key_b) && ((key_a != CZ_REG_KEY_IRREGULAR) || (!memcmp(reg_num_a, reg_num_b, 9)));
+}
+
 // =====================================
 // == basic frames
 // =====================================
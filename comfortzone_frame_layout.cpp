@@ -0,0 +1,835 @@
+#include "comfortzone_config.h"
+#include "comfortzone_frame.h"
+#include "comfortzone_decoder.h"
+#include "comfortzone_frame_layout.h"
+
+#include <stddef.h>
+
+// this file describes the fields of each status frame structure (see comfortzone_frame.h)
+// /!\ it must be updated each time a structure of comfortzone_frame.h is modified
+
+#define CZ_FIELD(s, f)	{ #f, offsetof(s, f), sizeof(((s *)0)->f) }
+#define CZ_LAYOUT(decoder, s)	{ decoder, #s, sizeof(s), s##_fields, sizeof(s##_fields) / sizeof(s##_fields[0]) }
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_01_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_01, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_01, unknown),
+		CZ_FIELD(R_REPLY_STATUS_01, extra_hot_water),
+		CZ_FIELD(R_REPLY_STATUS_01, hot_water_user_setting),
+		CZ_FIELD(R_REPLY_STATUS_01, hot_water_hysteresis),
+		CZ_FIELD(R_REPLY_STATUS_01, hot_water_normal_steps),
+		CZ_FIELD(R_REPLY_STATUS_01, hot_water_high_steps),
+		CZ_FIELD(R_REPLY_STATUS_01, hot_water_extra_steps),
+		CZ_FIELD(R_REPLY_STATUS_01, unknown5a),
+		CZ_FIELD(R_REPLY_STATUS_01, hot_water_max_runtime),
+		CZ_FIELD(R_REPLY_STATUS_01, hot_water_pause_time),
+		CZ_FIELD(R_REPLY_STATUS_01, unknown5b),
+		CZ_FIELD(R_REPLY_STATUS_01, hot_water_compressor_min_frequency),
+		CZ_FIELD(R_REPLY_STATUS_01, hot_water_compressor_max_frequency),
+		CZ_FIELD(R_REPLY_STATUS_01, unknown6),
+		CZ_FIELD(R_REPLY_STATUS_01, hot_water_extra_setting),
+		CZ_FIELD(R_REPLY_STATUS_01, hot_water_extra_time),
+		CZ_FIELD(R_REPLY_STATUS_01, unknown7),
+		CZ_FIELD(R_REPLY_STATUS_01, normal_fan_speed),
+		CZ_FIELD(R_REPLY_STATUS_01, reduce_fan_speed),
+		CZ_FIELD(R_REPLY_STATUS_01, fan_boost_increase),
+		CZ_FIELD(R_REPLY_STATUS_01, unknown8),
+		CZ_FIELD(R_REPLY_STATUS_01, supply_fan_t12_adjust),
+		CZ_FIELD(R_REPLY_STATUS_01, unknown8a),
+		CZ_FIELD(R_REPLY_STATUS_01, fan_time_to_filter_change),
+		CZ_FIELD(R_REPLY_STATUS_01, unknown9),
+		CZ_FIELD(R_REPLY_STATUS_01, heating_compressor_min_frequency),
+		CZ_FIELD(R_REPLY_STATUS_01, heating_compressor_max_frequency),
+		CZ_FIELD(R_REPLY_STATUS_01, unknown9a),
+		CZ_FIELD(R_REPLY_STATUS_01, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_02_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_02, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_02, unknown),
+		CZ_FIELD(R_REPLY_STATUS_02, hour1),
+		CZ_FIELD(R_REPLY_STATUS_02, minute1),
+		CZ_FIELD(R_REPLY_STATUS_02, second1),
+		CZ_FIELD(R_REPLY_STATUS_02, day),
+		CZ_FIELD(R_REPLY_STATUS_02, month),
+		CZ_FIELD(R_REPLY_STATUS_02, year),
+		CZ_FIELD(R_REPLY_STATUS_02, day_of_week),
+		CZ_FIELD(R_REPLY_STATUS_02, unknown2),
+		CZ_FIELD(R_REPLY_STATUS_02, hour2),
+		CZ_FIELD(R_REPLY_STATUS_02, minute2),
+		CZ_FIELD(R_REPLY_STATUS_02, second2),
+		CZ_FIELD(R_REPLY_STATUS_02, unknown3),
+		CZ_FIELD(R_REPLY_STATUS_02, general_status),
+		CZ_FIELD(R_REPLY_STATUS_02, unknown3b),
+		CZ_FIELD(R_REPLY_STATUS_02, pending_alarm),
+		CZ_FIELD(R_REPLY_STATUS_02, unknown3c),
+		CZ_FIELD(R_REPLY_STATUS_02, acknowledged_alarm),
+		CZ_FIELD(R_REPLY_STATUS_02, unknown3d),
+		CZ_FIELD(R_REPLY_STATUS_02, sensors),
+		CZ_FIELD(R_REPLY_STATUS_02, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_02_V170_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_02_V170, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_02_V170, unknown),
+		CZ_FIELD(R_REPLY_STATUS_02_V170, hour1),
+		CZ_FIELD(R_REPLY_STATUS_02_V170, minute1),
+		CZ_FIELD(R_REPLY_STATUS_02_V170, second1),
+		CZ_FIELD(R_REPLY_STATUS_02_V170, day),
+		CZ_FIELD(R_REPLY_STATUS_02_V170, month),
+		CZ_FIELD(R_REPLY_STATUS_02_V170, year),
+		CZ_FIELD(R_REPLY_STATUS_02_V170, day_of_week),
+		CZ_FIELD(R_REPLY_STATUS_02_V170, unknown2),
+		CZ_FIELD(R_REPLY_STATUS_02_V170, hour2),
+		CZ_FIELD(R_REPLY_STATUS_02_V170, minute2),
+		CZ_FIELD(R_REPLY_STATUS_02_V170, second2),
+		CZ_FIELD(R_REPLY_STATUS_02_V170, unknown3),
+		CZ_FIELD(R_REPLY_STATUS_02_V170, general_status),
+		CZ_FIELD(R_REPLY_STATUS_02_V170, unknown3b),
+		CZ_FIELD(R_REPLY_STATUS_02_V170, pending_alarm),
+		CZ_FIELD(R_REPLY_STATUS_02_V170, unknown3c),
+		CZ_FIELD(R_REPLY_STATUS_02_V170, acknowledged_alarm),
+		CZ_FIELD(R_REPLY_STATUS_02_V170, unknown3d),
+		CZ_FIELD(R_REPLY_STATUS_02_V170, sensors),
+		CZ_FIELD(R_REPLY_STATUS_02_V170, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_03_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_03, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_03, unknown),
+		CZ_FIELD(R_REPLY_STATUS_03, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_04_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_04, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_04, unknown),
+		CZ_FIELD(R_REPLY_STATUS_04, chauffage_puissance_consommee1),
+		CZ_FIELD(R_REPLY_STATUS_04, unknown8),
+		CZ_FIELD(R_REPLY_STATUS_04, chauffage_puissance_consommee2),
+		CZ_FIELD(R_REPLY_STATUS_04, hot_water_production),
+		CZ_FIELD(R_REPLY_STATUS_04, unknown9),
+		CZ_FIELD(R_REPLY_STATUS_04, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_05_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_05, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_05, hot_water_production),
+		CZ_FIELD(R_REPLY_STATUS_05, unknown),
+		CZ_FIELD(R_REPLY_STATUS_05, heating_calculated_setting),
+		CZ_FIELD(R_REPLY_STATUS_05, unknown0),
+		CZ_FIELD(R_REPLY_STATUS_05, te3_indoor_temp_history),
+		CZ_FIELD(R_REPLY_STATUS_05, te2_return_water_history),
+		CZ_FIELD(R_REPLY_STATUS_05, room_heating_in_progress),
+		CZ_FIELD(R_REPLY_STATUS_05, unknown1),
+		CZ_FIELD(R_REPLY_STATUS_05, hot_water_calculated_setting),
+		CZ_FIELD(R_REPLY_STATUS_05, unknown2),
+		CZ_FIELD(R_REPLY_STATUS_05, unknown_count_down),
+		CZ_FIELD(R_REPLY_STATUS_05, unknown2b),
+		CZ_FIELD(R_REPLY_STATUS_05, extra_hot_water),
+		CZ_FIELD(R_REPLY_STATUS_05, unknown2c),
+		CZ_FIELD(R_REPLY_STATUS_05, fan_speed),
+		CZ_FIELD(R_REPLY_STATUS_05, fan_speed_duty),
+		CZ_FIELD(R_REPLY_STATUS_05, unknown3),
+		CZ_FIELD(R_REPLY_STATUS_05, condensing_temperature),
+		CZ_FIELD(R_REPLY_STATUS_05, condensing_pressure),
+		CZ_FIELD(R_REPLY_STATUS_05, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_06_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_06, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_06, evaporator_pressure),
+		CZ_FIELD(R_REPLY_STATUS_06, pressure_ratio),
+		CZ_FIELD(R_REPLY_STATUS_06, unknown0a),
+		CZ_FIELD(R_REPLY_STATUS_06, heatpump_compressor_max_frequency1),
+		CZ_FIELD(R_REPLY_STATUS_06, hot_water_active_max_frequency),
+		CZ_FIELD(R_REPLY_STATUS_06, heatpump_active_max_frequency1),
+		CZ_FIELD(R_REPLY_STATUS_06, unknown0c),
+		CZ_FIELD(R_REPLY_STATUS_06, heatpump_active_max_frequency2),
+		CZ_FIELD(R_REPLY_STATUS_06, heatpump_active_max_frequency3),
+		CZ_FIELD(R_REPLY_STATUS_06, heatpump_current_compressor_frequency),
+		CZ_FIELD(R_REPLY_STATUS_06, chauffage_compressor_max_frequency3),
+		CZ_FIELD(R_REPLY_STATUS_06, unknown0d),
+		CZ_FIELD(R_REPLY_STATUS_06, heating_compressor_min_frequency),
+		CZ_FIELD(R_REPLY_STATUS_06, heating_compressor_max_frequency),
+		CZ_FIELD(R_REPLY_STATUS_06, unknown0),
+		CZ_FIELD(R_REPLY_STATUS_06, heatpump_current_compressor_power),
+		CZ_FIELD(R_REPLY_STATUS_06, heatpump_current_add_power),
+		CZ_FIELD(R_REPLY_STATUS_06, heatpump_current_total_power1),
+		CZ_FIELD(R_REPLY_STATUS_06, heatpump_current_total_power2),
+		CZ_FIELD(R_REPLY_STATUS_06, heatpump_compressor_input_power),
+		CZ_FIELD(R_REPLY_STATUS_06, unknown1a),
+		CZ_FIELD(R_REPLY_STATUS_06, unknown_count_down),
+		CZ_FIELD(R_REPLY_STATUS_06, unknown1b),
+		CZ_FIELD(R_REPLY_STATUS_06, heatpump_defrost_delay),
+		CZ_FIELD(R_REPLY_STATUS_06, unknown2),
+		CZ_FIELD(R_REPLY_STATUS_06, expansion_valve_calculated_setting),
+		CZ_FIELD(R_REPLY_STATUS_06, vanne_expansion_xxx),
+		CZ_FIELD(R_REPLY_STATUS_06, expansion_valve_temperature_difference1),
+		CZ_FIELD(R_REPLY_STATUS_06, expansion_valve_temperature_difference2),
+		CZ_FIELD(R_REPLY_STATUS_06, unknown2a),
+		CZ_FIELD(R_REPLY_STATUS_06, expansion_valve_valve_position1),
+		CZ_FIELD(R_REPLY_STATUS_06, expansion_valve_valve_position2),
+		CZ_FIELD(R_REPLY_STATUS_06, unknown2b),
+		CZ_FIELD(R_REPLY_STATUS_06, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_07_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_07, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_07, unknown),
+		CZ_FIELD(R_REPLY_STATUS_07, input_power_limit),
+		CZ_FIELD(R_REPLY_STATUS_07, unknown2),
+		CZ_FIELD(R_REPLY_STATUS_07, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_08_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_08, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_08, bcd_second),
+		CZ_FIELD(R_REPLY_STATUS_08, bcd_minute),
+		CZ_FIELD(R_REPLY_STATUS_08, bcd_hour),
+		CZ_FIELD(R_REPLY_STATUS_08, unknown0),
+		CZ_FIELD(R_REPLY_STATUS_08, bcd_day),
+		CZ_FIELD(R_REPLY_STATUS_08, bcd_month),
+		CZ_FIELD(R_REPLY_STATUS_08, bcd_year),
+		CZ_FIELD(R_REPLY_STATUS_08, unknown0a),
+		CZ_FIELD(R_REPLY_STATUS_08, unknown),
+		CZ_FIELD(R_REPLY_STATUS_08, compressor_energy),
+		CZ_FIELD(R_REPLY_STATUS_08, add_energy),
+		CZ_FIELD(R_REPLY_STATUS_08, hot_water_energy),
+		CZ_FIELD(R_REPLY_STATUS_08, compressor_runtime),
+		CZ_FIELD(R_REPLY_STATUS_08, total_runtime),
+		CZ_FIELD(R_REPLY_STATUS_08, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_09_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_09, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_09, unknown),
+		CZ_FIELD(R_REPLY_STATUS_09, hotwater_priority),
+		CZ_FIELD(R_REPLY_STATUS_09, unknown2),
+		CZ_FIELD(R_REPLY_STATUS_09, hardware_settings_adjustments_teX_adjust),
+		CZ_FIELD(R_REPLY_STATUS_09, unknown6),
+		CZ_FIELD(R_REPLY_STATUS_09, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_10_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_10, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_10, unknown),
+		CZ_FIELD(R_REPLY_STATUS_10, holiday_temperature_reduction),
+		CZ_FIELD(R_REPLY_STATUS_10, holiday_minimal_room_temperature),
+		CZ_FIELD(R_REPLY_STATUS_10, cw_minimal_temperature),
+		CZ_FIELD(R_REPLY_STATUS_10, cw_maximal_temperature),
+		CZ_FIELD(R_REPLY_STATUS_10, cw_overheat_hysteresis),
+		CZ_FIELD(R_REPLY_STATUS_10, unknown2a),
+		CZ_FIELD(R_REPLY_STATUS_10, cw_return_maximal_temperature),
+		CZ_FIELD(R_REPLY_STATUS_10, unknown2b),
+		CZ_FIELD(R_REPLY_STATUS_10, cw_pump),
+		CZ_FIELD(R_REPLY_STATUS_10, unknown2),
+		CZ_FIELD(R_REPLY_STATUS_10, step_wise_heating_temperature),
+		CZ_FIELD(R_REPLY_STATUS_10, step_wise_heating_days),
+		CZ_FIELD(R_REPLY_STATUS_10, unknown3),
+		CZ_FIELD(R_REPLY_STATUS_10, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_11_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_11, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_11, unknown),
+		CZ_FIELD(R_REPLY_STATUS_11, led_luminosity),
+		CZ_FIELD(R_REPLY_STATUS_11, unknown2),
+		CZ_FIELD(R_REPLY_STATUS_11, holiday_reduction),
+		CZ_FIELD(R_REPLY_STATUS_11, unknown3),
+		CZ_FIELD(R_REPLY_STATUS_11, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_12_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_12, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_12, unknown),
+		CZ_FIELD(R_REPLY_STATUS_12, heatpump_compressor_blocked_frequency1),
+		CZ_FIELD(R_REPLY_STATUS_12, heatpump_compressor_blocked_frequency2),
+		CZ_FIELD(R_REPLY_STATUS_12, heatpump_compressor_blocked_frequency3),
+		CZ_FIELD(R_REPLY_STATUS_12, unknown3),
+		CZ_FIELD(R_REPLY_STATUS_12, heatpump_defrost_delay),
+		CZ_FIELD(R_REPLY_STATUS_12, unknown8),
+		CZ_FIELD(R_REPLY_STATUS_12, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_13_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_13, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_13, unknown),
+		CZ_FIELD(R_REPLY_STATUS_13, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_14_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_14, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_14, unknown),
+		CZ_FIELD(R_REPLY_STATUS_14, language),
+		CZ_FIELD(R_REPLY_STATUS_14, unknownd),
+		CZ_FIELD(R_REPLY_STATUS_14, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_15_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_15, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_15, unknown),
+		CZ_FIELD(R_REPLY_STATUS_15, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_16_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_16, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_16, unknown),
+		CZ_FIELD(R_REPLY_STATUS_16, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_17_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_17, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_17, unknown),
+		CZ_FIELD(R_REPLY_STATUS_17, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_18_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_18, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_18, unknown),
+		CZ_FIELD(R_REPLY_STATUS_18, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_19_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_19, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_19, unknown),
+		CZ_FIELD(R_REPLY_STATUS_19, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_20_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_20, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_20, unknown),
+		CZ_FIELD(R_REPLY_STATUS_20, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_22_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_22, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_22, unknown),
+		CZ_FIELD(R_REPLY_STATUS_22, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_23_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_23, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_23, unknown1),
+		CZ_FIELD(R_REPLY_STATUS_23, unknown),
+		CZ_FIELD(R_REPLY_STATUS_23, unknown2),
+		CZ_FIELD(R_REPLY_STATUS_23, unknown3),
+		CZ_FIELD(R_REPLY_STATUS_23, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_24_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_24, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_24, unknown),
+		CZ_FIELD(R_REPLY_STATUS_24, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_25_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_25, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_25, unknown),
+		CZ_FIELD(R_REPLY_STATUS_25, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V180_STATUS_x58_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x58, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x58, unknown),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x58, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V180_STATUS_x68_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x68, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x68, unknown),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x68, unknown1),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x68, unknown2),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x68, unknown3),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x68, unknown4),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x68, unknown5),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x68, unknown6),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x68, unknown7),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x68, unknown8),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x68, unknown9),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x68, unknown10),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x68, unknown11),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x68, unknown12),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x68, unknown13),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x68, unknown14),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x68, unknown15),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x68, unknown16),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x68, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V180_STATUS_x40_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x40, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x40, calculated_flow_set),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x40, temp),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x40, heating_calculated_setting),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x40, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V180_STATUS_x26_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x26, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x26, unknown),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x26, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V180_STATUS_x8d_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x8d, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x8d, temp),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x8d, unknown),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x8d, temp1),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x8d, normal_fan_speed),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x8d, reduce_fan_speed),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x8d, fan_boost_increase),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x8d, temp1a),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x8d, fan_time_to_filter_change),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x8d, temp2),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x8d, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V180_STATUS_runtime_and_energy_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_runtime_and_energy, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_runtime_and_energy, unknown1),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_runtime_and_energy, compressor_energy),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_runtime_and_energy, add_energy),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_runtime_and_energy, hot_water_energy),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_runtime_and_energy, compressor_runtime),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_runtime_and_energy, total_runtime),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_runtime_and_energy, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V180_STATUS_xa1_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xa1, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xa1, unknown),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xa1, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V180_02_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V180_02, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V180_02, heatpump_status),
+		CZ_FIELD(R_REPLY_STATUS_V180_02, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V180_STATUS_xa3_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xa3, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xa3, unknown),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xa3, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V180_STATUS_xad_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, hot_water_calculated_setting),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, temp1),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, unknown),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, temp1a),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, condensing_temperature),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, condensing_pressure),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, evaporator_pressure),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, pressure_ratio),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, temp2),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, heatpump_current_compressor_frequency),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, heatpump_target_compressor_frequency),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, unknown1),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, heating_compressor_max_frequency),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, temp3),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, heatpump_current_compressor_power),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, heatpump_current_add_power),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, heatpump_current_total_power1),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, heatpump_current_total_power2),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, heatpump_compressor_input_power),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, temp4),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, temp5),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, expansion_valve_calculated_setting),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, vanne_expansion_xxx),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, expansion_valve_temperature_difference),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xad, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V180_STATUS_xc7_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xc7, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xc7, unknown),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xc7, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V180_STATUS_xc72_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xc72, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xc72, unknown),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xc72, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V180_STATUS_xc5_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xc5, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xc5, unknown),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xc5, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V180_STATUS_xbf_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xbf, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xbf, unknown),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xbf, ui_software_major_version),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xbf, ui_software_minor_version),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xbf, ui_software_patch_version),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xbf, ui_hardware_version),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xbf, unknown1),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_xbf, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V180_STATUS_x6d_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x6d, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x6d, unknown),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x6d, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V180_STATUS_x56_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x56, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x56, bcd_second),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x56, bcd_minute),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x56, bcd_hour),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x56, unknown0),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x56, bcd_day),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x56, bcd_month),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x56, bcd_year),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x56, unknown),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x56, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V180_STATUS_SHORT2_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_SHORT2, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_SHORT2, unknown),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_SHORT2, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V180_STATUS_ui_versions_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_ui_versions, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_ui_versions, ui_software_major_version),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_ui_versions, ui_software_minor_version),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_ui_versions, ui_software_patch_version),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_ui_versions, ui_hardware_version),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_ui_versions, unknown),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_ui_versions, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V180_STATUS_x2c_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x2c, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x2c, unknown),
+		CZ_FIELD(R_REPLY_STATUS_V180_STATUS_x2c, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V180_SETTINGS_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V180_SETTINGS, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V180_SETTINGS, unknown),
+		CZ_FIELD(R_REPLY_STATUS_V180_SETTINGS, hot_water_user_setting),
+		CZ_FIELD(R_REPLY_STATUS_V180_SETTINGS, unknown1),
+		CZ_FIELD(R_REPLY_STATUS_V180_SETTINGS, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V180_C8A_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V180_C8A, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V180_C8A, unknown),
+		CZ_FIELD(R_REPLY_STATUS_V180_C8A, fan_speed_duty),
+		CZ_FIELD(R_REPLY_STATUS_V180_C8A, unknown1),
+		CZ_FIELD(R_REPLY_STATUS_V180_C8A, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V221_xC1_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V221_xC1, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V221_xC1, unknown0),
+		CZ_FIELD(R_REPLY_STATUS_V221_xC1, heating_calculated_setting),
+		CZ_FIELD(R_REPLY_STATUS_V221_xC1, unknown1),
+		CZ_FIELD(R_REPLY_STATUS_V221_xC1, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V221_x51_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V221_x51, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V221_x51, unknown0),
+		CZ_FIELD(R_REPLY_STATUS_V221_x51, fan_speed),
+		CZ_FIELD(R_REPLY_STATUS_V221_x51, unknown1),
+		CZ_FIELD(R_REPLY_STATUS_V221_x51, unknown2),
+		CZ_FIELD(R_REPLY_STATUS_V221_x51, unknown3),
+		CZ_FIELD(R_REPLY_STATUS_V221_x51, heatpump_current_compressor_frequency),
+		CZ_FIELD(R_REPLY_STATUS_V221_x51, unknown4),
+		CZ_FIELD(R_REPLY_STATUS_V221_x51, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V221_x88_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V221_x88, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V221_x88, hour1),
+		CZ_FIELD(R_REPLY_STATUS_V221_x88, minute1),
+		CZ_FIELD(R_REPLY_STATUS_V221_x88, second1),
+		CZ_FIELD(R_REPLY_STATUS_V221_x88, day),
+		CZ_FIELD(R_REPLY_STATUS_V221_x88, month),
+		CZ_FIELD(R_REPLY_STATUS_V221_x88, year),
+		CZ_FIELD(R_REPLY_STATUS_V221_x88, day_of_week),
+		CZ_FIELD(R_REPLY_STATUS_V221_x88, unknown2),
+		CZ_FIELD(R_REPLY_STATUS_V221_x88, hour2),
+		CZ_FIELD(R_REPLY_STATUS_V221_x88, minute2),
+		CZ_FIELD(R_REPLY_STATUS_V221_x88, second2),
+		CZ_FIELD(R_REPLY_STATUS_V221_x88, unknown0),
+		CZ_FIELD(R_REPLY_STATUS_V221_x88, sensors),
+		CZ_FIELD(R_REPLY_STATUS_V221_x88, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V221_xc5_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V221_xc5, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V221_xc5, hot_water_calculated_setting),
+		CZ_FIELD(R_REPLY_STATUS_V221_xc5, unknown0),
+		CZ_FIELD(R_REPLY_STATUS_V221_xc5, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V221_xf2_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V221_xf2, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V221_xf2, unknown0),
+		CZ_FIELD(R_REPLY_STATUS_V221_xf2, fan_time_to_filter_change),
+		CZ_FIELD(R_REPLY_STATUS_V221_xf2, unknown1),
+		CZ_FIELD(R_REPLY_STATUS_V221_xf2, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V221_xb9_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V221_xb9, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V221_xb9, heatpump_current_compressor_power),
+		CZ_FIELD(R_REPLY_STATUS_V221_xb9, heatpump_current_add_power),
+		CZ_FIELD(R_REPLY_STATUS_V221_xb9, heatpump_current_total_power1),
+		CZ_FIELD(R_REPLY_STATUS_V221_xb9, heatpump_current_total_power2),
+		CZ_FIELD(R_REPLY_STATUS_V221_xb9, heatpump_compressor_input_power),
+		CZ_FIELD(R_REPLY_STATUS_V221_xb9, unknown0),
+		CZ_FIELD(R_REPLY_STATUS_V221_xb9, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V170_X79_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V170_X79, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V170_X79, hot_water_max_runtime),
+		CZ_FIELD(R_REPLY_STATUS_V170_X79, hot_water_pause_time),
+		CZ_FIELD(R_REPLY_STATUS_V170_X79, unknown),
+		CZ_FIELD(R_REPLY_STATUS_V170_X79, hot_water_compressor_min_frequency),
+		CZ_FIELD(R_REPLY_STATUS_V170_X79, hot_water_compressor_max_frequency),
+		CZ_FIELD(R_REPLY_STATUS_V170_X79, unknown2),
+		CZ_FIELD(R_REPLY_STATUS_V170_X79, hot_water_extra_setting),
+		CZ_FIELD(R_REPLY_STATUS_V170_X79, hot_water_extra_time),
+		CZ_FIELD(R_REPLY_STATUS_V170_X79, unknown3),
+		CZ_FIELD(R_REPLY_STATUS_V170_X79, unknown4),
+		CZ_FIELD(R_REPLY_STATUS_V170_X79, unknown5),
+		CZ_FIELD(R_REPLY_STATUS_V170_X79, normal_fan_speed),
+		CZ_FIELD(R_REPLY_STATUS_V170_X79, unknown6),
+		CZ_FIELD(R_REPLY_STATUS_V170_X79, unknown7),
+		CZ_FIELD(R_REPLY_STATUS_V170_X79, fan_time_to_filter_change),
+		CZ_FIELD(R_REPLY_STATUS_V170_X79, unknown8),
+		CZ_FIELD(R_REPLY_STATUS_V170_X79, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_V170_STATUS_2D_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_V170_STATUS_2D, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_V170_STATUS_2D, unknown),
+		CZ_FIELD(R_REPLY_STATUS_V170_STATUS_2D, unknown2),
+		CZ_FIELD(R_REPLY_STATUS_V170_STATUS_2D, heating_calculated_setting),
+		CZ_FIELD(R_REPLY_STATUS_V170_STATUS_2D, unknown3),
+		CZ_FIELD(R_REPLY_STATUS_V170_STATUS_2D, crc),
+	};
+
+static const CZ_FRAME_FIELD R_REPLY_STATUS_06_V170_fields[] =
+	{
+		CZ_FIELD(R_REPLY_STATUS_06_V170, cz_head),
+		CZ_FIELD(R_REPLY_STATUS_06_V170, unknown0alfa),
+		CZ_FIELD(R_REPLY_STATUS_06_V170, condensing_temperature),
+		CZ_FIELD(R_REPLY_STATUS_06_V170, condensing_pressure),
+		CZ_FIELD(R_REPLY_STATUS_06_V170, evaporator_pressure),
+		CZ_FIELD(R_REPLY_STATUS_06_V170, pressure_ratio),
+		CZ_FIELD(R_REPLY_STATUS_06_V170, unknown0a),
+		CZ_FIELD(R_REPLY_STATUS_06_V170, heatpump_current_compressor_frequency),
+		CZ_FIELD(R_REPLY_STATUS_06_V170, unknown0b),
+		CZ_FIELD(R_REPLY_STATUS_06_V170, heatpump_active_max_frequency2),
+		CZ_FIELD(R_REPLY_STATUS_06_V170, heatpump_active_max_frequency3),
+		CZ_FIELD(R_REPLY_STATUS_06_V170, unknown0da),
+		CZ_FIELD(R_REPLY_STATUS_06_V170, chauffage_compressor_max_frequency3),
+		CZ_FIELD(R_REPLY_STATUS_06_V170, unknown0c),
+		CZ_FIELD(R_REPLY_STATUS_06_V170, heatpump_current_compressor_power),
+		CZ_FIELD(R_REPLY_STATUS_06_V170, unknown0d),
+		CZ_FIELD(R_REPLY_STATUS_06_V170, heatpump_current_add_power),
+		CZ_FIELD(R_REPLY_STATUS_06_V170, heatpump_current_total_power1),
+		CZ_FIELD(R_REPLY_STATUS_06_V170, unknown0e),
+		CZ_FIELD(R_REPLY_STATUS_06_V170, heatpump_current_total_power2),
+		CZ_FIELD(R_REPLY_STATUS_06_V170, unknown0f),
+		CZ_FIELD(R_REPLY_STATUS_06_V170, heatpump_compressor_input_power),
+		CZ_FIELD(R_REPLY_STATUS_06_V170, unknown0g),
+		CZ_FIELD(R_REPLY_STATUS_06_V170, crc),
+	};
+
+static const CZ_FRAME_LAYOUT frame_layouts[] =
+	{
+		CZ_LAYOUT(czdec::reply_r_status_01, R_REPLY_STATUS_01),
+		CZ_LAYOUT(czdec::reply_r_status_02, R_REPLY_STATUS_02),
+		CZ_LAYOUT(czdec::reply_r_status_02, R_REPLY_STATUS_02_V170),		// v1.7
+		CZ_LAYOUT(czdec::reply_r_status_03, R_REPLY_STATUS_03),
+		CZ_LAYOUT(czdec::reply_r_status_04, R_REPLY_STATUS_04),
+		CZ_LAYOUT(czdec::reply_r_status_05, R_REPLY_STATUS_05),
+		CZ_LAYOUT(czdec::reply_r_status_06, R_REPLY_STATUS_06),
+		CZ_LAYOUT(czdec::reply_r_status_07, R_REPLY_STATUS_07),
+		CZ_LAYOUT(czdec::reply_r_status_08, R_REPLY_STATUS_08),
+		CZ_LAYOUT(czdec::reply_r_status_09, R_REPLY_STATUS_09),
+		CZ_LAYOUT(czdec::reply_r_status_10, R_REPLY_STATUS_10),
+		CZ_LAYOUT(czdec::reply_r_status_11, R_REPLY_STATUS_11),
+		CZ_LAYOUT(czdec::reply_r_status_12, R_REPLY_STATUS_12),
+		CZ_LAYOUT(czdec::reply_r_status_13, R_REPLY_STATUS_13),
+		CZ_LAYOUT(czdec::reply_r_status_14, R_REPLY_STATUS_14),
+		CZ_LAYOUT(czdec::reply_r_status_15, R_REPLY_STATUS_15),
+		CZ_LAYOUT(czdec::reply_r_status_16, R_REPLY_STATUS_16),
+		CZ_LAYOUT(czdec::reply_r_status_17, R_REPLY_STATUS_17),
+		CZ_LAYOUT(czdec::reply_r_status_18, R_REPLY_STATUS_18),
+		CZ_LAYOUT(czdec::reply_r_status_19, R_REPLY_STATUS_19),
+		CZ_LAYOUT(czdec::reply_r_status_20, R_REPLY_STATUS_20),
+		CZ_LAYOUT(czdec::reply_r_status_22, R_REPLY_STATUS_22),
+		CZ_LAYOUT(czdec::reply_r_status_23, R_REPLY_STATUS_23),
+		CZ_LAYOUT(czdec::reply_r_status_24, R_REPLY_STATUS_24),
+		CZ_LAYOUT(czdec::reply_r_status_25, R_REPLY_STATUS_25),
+		CZ_LAYOUT(czdec::reply_r_status_v180_x58, R_REPLY_STATUS_V180_STATUS_x58),
+		CZ_LAYOUT(czdec::reply_r_status_v180_x68, R_REPLY_STATUS_V180_STATUS_x68),
+		CZ_LAYOUT(czdec::reply_r_status_v180_x40, R_REPLY_STATUS_V180_STATUS_x40),
+		CZ_LAYOUT(czdec::reply_r_status_v180_x26, R_REPLY_STATUS_V180_STATUS_x26),
+		CZ_LAYOUT(czdec::reply_r_status_v180_x8d, R_REPLY_STATUS_V180_STATUS_x8d),
+		CZ_LAYOUT(czdec::reply_r_status_v180_runtime_and_energy, R_REPLY_STATUS_V180_STATUS_runtime_and_energy),
+		CZ_LAYOUT(czdec::reply_r_status_v180_xa1, R_REPLY_STATUS_V180_STATUS_xa1),
+		CZ_LAYOUT(czdec::reply_r_status_v180_02, R_REPLY_STATUS_V180_02),
+		CZ_LAYOUT(czdec::reply_r_status_v180_xa3, R_REPLY_STATUS_V180_STATUS_xa3),
+		CZ_LAYOUT(czdec::reply_r_status_v180_xad, R_REPLY_STATUS_V180_STATUS_xad),
+		CZ_LAYOUT(czdec::reply_r_status_v180_xc7, R_REPLY_STATUS_V180_STATUS_xc7),
+		CZ_LAYOUT(czdec::reply_r_status_v180_xc72, R_REPLY_STATUS_V180_STATUS_xc72),
+		CZ_LAYOUT(czdec::reply_r_status_v180_xc5, R_REPLY_STATUS_V180_STATUS_xc5),
+		CZ_LAYOUT(czdec::reply_r_status_v180_xbf, R_REPLY_STATUS_V180_STATUS_xbf),
+		CZ_LAYOUT(czdec::reply_r_status_v180_x6d, R_REPLY_STATUS_V180_STATUS_x6d),
+		CZ_LAYOUT(czdec::reply_r_status_v180_x56, R_REPLY_STATUS_V180_STATUS_x56),
+		CZ_LAYOUT(czdec::reply_r_status_v180_short2, R_REPLY_STATUS_V180_STATUS_SHORT2),
+		CZ_LAYOUT(czdec::reply_r_status_v180_ui_versions, R_REPLY_STATUS_V180_STATUS_ui_versions),
+		CZ_LAYOUT(czdec::reply_r_status_v180_x2c, R_REPLY_STATUS_V180_STATUS_x2c),
+		CZ_LAYOUT(czdec::reply_r_status_v180_settings, R_REPLY_STATUS_V180_SETTINGS),
+		CZ_LAYOUT(czdec::reply_r_status_v180_c8a, R_REPLY_STATUS_V180_C8A),
+		CZ_LAYOUT(czdec::reply_r_status_v221_xc1, R_REPLY_STATUS_V221_xC1),
+		CZ_LAYOUT(czdec::reply_r_status_v221_x51, R_REPLY_STATUS_V221_x51),
+		CZ_LAYOUT(czdec::reply_r_status_v221_x88, R_REPLY_STATUS_V221_x88),
+		CZ_LAYOUT(czdec::reply_r_status_v221_xc5, R_REPLY_STATUS_V221_xc5),
+		CZ_LAYOUT(czdec::reply_r_status_v221_xf2, R_REPLY_STATUS_V221_xf2),
+		CZ_LAYOUT(czdec::reply_r_status_v221_xb9, R_REPLY_STATUS_V221_xb9),
+		CZ_LAYOUT(czdec::reply_r_status_v170_x79, R_REPLY_STATUS_V170_X79),
+		CZ_LAYOUT(czdec::reply_r_status_v170_status_2d, R_REPLY_STATUS_V170_STATUS_2D),
+		CZ_LAYOUT(czdec::reply_r_status_06_v170, R_REPLY_STATUS_06_V170),
+	};
+
+#define NB_FRAME_LAYOUTS (sizeof(frame_layouts) / sizeof(frame_layouts[0]))
+
+// find the layout of a frame using its register decoder
+// input: register of the frame
+//        frame size (some registers use several frame formats)
+// output: NULL if the frame has no known layout
+const CZ_FRAME_LAYOUT *czlayout::get_layout(const czdec::KNOWN_REGISTER *kr, byte frame_size)
+{
+	unsigned int i;
+
+	if(kr == NULL)
+		return NULL;
+
+	for(i = 0; i < NB_FRAME_LAYOUTS; i++)
+	{
+		if((frame_layouts[i].reply_r == kr->reply_r) && (frame_layouts[i].frame_size == frame_size))
+			return &(frame_layouts[i]);
+	}
+
+	return NULL;
+}
+
+// check if at least one layout exists for the frames of a register
+bool czlayout::has_layout(const czdec::KNOWN_REGISTER *kr)
+{
+	unsigned int i;
+
+	for(i = 0; i < NB_FRAME_LAYOUTS; i++)
+	{
+		if(frame_layouts[i].reply_r == kr->reply_r)
+			return true;
+	}
+
+	return false;
+}
+
+// iterate over the layouts of the frames of a register (one per frame size)
+// output: NULL if idx is after the last layout
+const CZ_FRAME_LAYOUT *czlayout::get_nth_layout(const czdec::KNOWN_REGISTER *kr, int idx)
+{
+	unsigned int i;
+
+	for(i = 0; i < NB_FRAME_LAYOUTS; i++)
+	{
+		if(frame_layouts[i].reply_r != kr->reply_r)
+			continue;
+
+		if(idx == 0)
+			return &(frame_layouts[i]);
+
+		idx--;
+	}
+
+	return NULL;
+}
+
+// find the field containing the given byte offset
+// output: NULL if offset is outside of the frame
+const CZ_FRAME_FIELD *czlayout::get_field(const CZ_FRAME_LAYOUT *layout, byte offset)
+{
+	int i;
+
+	for(i = 0; i < layout->nb_fields; i++)
+	{
+		if((offset >= layout->fields[i].offset) && (offset < (layout->fields[i].offset + layout->fields[i].size)))
+			return &(layout->fields[i]);
+	}
+
+	return NULL;
+}
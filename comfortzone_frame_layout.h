@@ -0,0 +1,46 @@
+#ifndef _COMFORTZONE_FRAME_LAYOUT_H
+#define _COMFORTZONE_FRAME_LAYOUT_H
+
+#include "comfortzone_heatpump.h"
+#include "comfortzone_frame.h"
+#include "comfortzone_decoder.h"
+
+// description of one field of a status frame structure
+typedef struct
+{
+	const char *name;		// field name in structure (unknown* included)
+	byte offset;			// offset of the field from the start of the frame
+	byte size;				// field size in bytes
+} CZ_FRAME_FIELD;
+
+// description of a status frame structure
+typedef struct
+{
+	// decoder used by registers having this frame format
+	void (*reply_r)(comfortzone_heatpump *czhp, const czdec::KNOWN_REGISTER *kr, R_REPLY *p);
+
+	const char *name;		// structure name
+	byte frame_size;		// structure size (= frame size)
+
+	const CZ_FRAME_FIELD *fields;		// fields, ordered by offset
+	byte nb_fields;
+} CZ_FRAME_LAYOUT;
+
+class czlayout
+{
+	public:
+	// find the layout of a frame using its register decoder
+	static const CZ_FRAME_LAYOUT *get_layout(const czdec::KNOWN_REGISTER *kr, byte frame_size);
+
+	// check if at least one layout exists for the frames of a register
+	static bool has_layout(const czdec::KNOWN_REGISTER *kr);
+
+	// iterate over the layouts of the frames of a register (one per frame size)
+	// output: NULL if idx is after the last layout
+	static const CZ_FRAME_LAYOUT *get_nth_layout(const czdec::KNOWN_REGISTER *kr, int idx);
+
+	// find the field containing the given byte offset
+	static const CZ_FRAME_FIELD *get_field(const CZ_FRAME_LAYOUT *layout, byte offset);
+};
+
+#endif
@@ -11,8 +11,154 @@
 #include "string.h"
 #include "stdio.h"
 
-void comfortzone_heatpump::begin() {
+#define RETURN_MESSAGE(msg)	{ strcpy(last_message, msg); last_message_size = strlen(last_message); }
+
+comfortzone_heatpump::comfortzone_heatpump(RS485Interface* rs485) : rs485(rs485)
+{
+	protocol = czdec::get_protocol(HP_PROTOCOL);
+	reset_register_cache();
+}
+
+bool comfortzone_heatpump::begin(uint16_t protocol_version)
+{
+	const CZ_PROTOCOL *tables = czdec::get_protocol(protocol_version);
+	int i;
+
 	rs485->begin();
+
+	reset_register_cache();
+
+	if(protocol_version == HP_PROTOCOL_AUTO)
+	{
+		protocol_detection = true;
+		protocol_detection_frames = 0;
+
+		for(i = 0; i < HP_NB_PROTOCOLS; i++)
+			protocol_detection_scores[i] = 0;
+
+		return true;
+	}
+
+	if(tables == NULL)
+	{
+		RETURN_MESSAGE("Unsupported protocol version");
+		return false;
+	}
+
+	protocol = tables;
+	protocol_detection = false;
+	return true;
+}
+
+void comfortzone_heatpump::reset_register_cache()
+{
+	memset(reply_refresh, 0, sizeof(reply_refresh));
+#ifndef HP_REPLY_STORE_SIZE
+	memset(reply_hash, 0, sizeof(reply_hash));
+#else
+	memset(reply_slot_size, 0, sizeof(reply_slot_size));
+	memset(reply_generation, 0, sizeof(reply_generation));
+	reply_store_used = 0;
+	reply_stored = false;
+#endif
+
+#ifdef HP_LAZY_DECODING
+	memset(lazy_field, 0, sizeof(lazy_field));
+#endif
+#ifdef HP_REGISTER_SHADOW
+	memset(shadow, 0, sizeof(shadow));
+#endif
+	memset(poll_next, POLL_NONE, sizeof(poll_next));
+	memset(poll_weak, 0, sizeof(poll_weak));
+	poll_last = POLL_NONE;
+	poll_hits = 0;
+	poll_misses = 0;
+}
+
+int32_t comfortzone_heatpump::get_status(COMFORTZONE_STATUS_FIELD field)
+{
+	set_interest_mask(interest_mask | ((uint64_t)1 << field));
+
+#ifdef HP_LAZY_DECODING
+	czdec::decode_lazy_field(this, field);
+#endif
+
+	return czstatus::get_field(&comfortzone_status, field);
+}
+
+void comfortzone_heatpump::enable_interest_decoding(bool enable)
+{
+	uint64_t mask;
+	int i;
+
+	if(enable == false)
+	{
+		set_interest_mask(~(uint64_t)0);
+		return;
+	}
+
+	mask = (status_change_callback != NULL) ? status_change_fields : 0;
+
+	for(i = 0; i < CZSF_NB_FIELDS; i++)
+	{
+		if(czstatus::has_subscriber(&comfortzone_status, (COMFORTZONE_STATUS_FIELD)i))
+			mask |= ((uint64_t)1 << i);
+	}
+
+	set_interest_mask(mask);
+}
+
+// values of added fields were skipped by previous replies and bytes of stable values do not change anymore:
+// next reply of each register must be decoded as if all its bytes changed
+void comfortzone_heatpump::set_interest_mask(uint64_t mask)
+{
+	if(mask & ~interest_mask)
+		memset(reply_refresh, 0xFF, sizeof(reply_refresh));
+
+	interest_mask = mask;
+}
+
+void comfortzone_heatpump::set_status_change_callback(STATUS_CHANGE_CALLBACK callback, void *context, uint64_t fields)
+{
+	// forget changes made before
+	czstatus::collect_changes(&comfortzone_status);
+
+	status_change_callback = callback;
+	status_change_context = context;
+	status_change_fields = fields;
+}
+
+int comfortzone_heatpump::get_raw_reply(const byte reg_num[9], uint16_t offset, byte *buffer, uint16_t length, byte frame_size)
+{
+	return czdec::get_raw_reply(this, reg_num, offset, buffer, length, frame_size);
+}
+
+bool comfortzone_heatpump::get_register_value(const byte reg_num[9], REGISTER_VALUE *value, byte frame_size)
+{
+	return czdec::get_register_value(this, reg_num, value, frame_size);
+}
+
+uint32_t comfortzone_heatpump::get_prediction_hits()
+{
+	return poll_hits;
+}
+
+uint32_t comfortzone_heatpump::get_prediction_misses()
+{
+	return poll_misses;
+}
+
+bool comfortzone_heatpump::add_register(const byte reg_num[9], const char *name, byte frame_size, EXTRA_REGISTER_DECODER decoder, void *context)
+{
+	return czdec::add_extra_register(this, reg_num, name, frame_size, decoder, context);
+}
+
+uint16_t comfortzone_heatpump::get_protocol()
+{
+	if(protocol_detection)
+		return HP_PROTOCOL_AUTO;
+
+	return protocol->version;
 }
 
 comfortzone_heatpump::PROCESSED_FRAME_TYPE comfortzone_heatpump::process()
@@ -93,7 +239,20 @@ comfortzone_heatpump::PROCESSED_FRAME_TYPE comfortzone_heatpump::process()
 	// check frame CRC (last byte of buffer is CRC
 	if(CRC8.maxim(cz_buf, cz_size - 1) == cz_buf[cz_size - 1])
 	{
-		pft = czdec::process_frame(this, (CZ_PACKET_HEADER *)cz_buf);
+		if(protocol_detection)
+			pft = czdec::detect_protocol(this, (CZ_PACKET_HEADER *)cz_buf);
+		else
+		{
+			pft = czdec::process_frame(this, (CZ_PACKET_HEADER *)cz_buf);
+
+			if((status_change_callback != NULL) && ((pft == PFT_QUERY) || (pft == PFT_REPLY)))
+			{
+				uint64_t changed = czstatus::collect_changes(&comfortzone_status) & status_change_fields;
+
+				if(changed != 0)
+					status_change_callback(this, changed, status_change_context);
+			}
+		}
 	}
 	else
 	{
@@ -166,33 +325,22 @@ void comfortzone_heatpump::set_grab_buffer(byte *buffer, uint16_t buffer_size, u
 // Another solution is to wait for status 08 reply and use the large pause. However, the pause
 // appears once only every 5 seconds. This is the solution used here because it generates no side effect
 
-#define RETURN_MESSAGE(msg)	{ strcpy(last_message, msg); last_message_size = strlen(last_message); }
-
 // fan speed: 1 = low, 2 = normal, 3 = fast, 4 = on timer (HP v1.8)
 bool comfortzone_heatpump::set_fan_speed(uint8_t fan_speed, int timeout)
 {
 	W_SMALL_CMD cmd;
 	W_REPLY expected_reply;
-	czdec::KNOWN_REGISTER *kr;
+	const czdec::KNOWN_REGISTER *kr;
 	bool push_result;
 
-#if HP_PROTOCOL == HP_PROTOCOL_1_6
-	if((fan_speed < 1) || (fan_speed > 3))
+	if((fan_speed < protocol->limits.fan_speed_min) || (fan_speed > protocol->limits.fan_speed_max))
 	{
-		RETURN_MESSAGE("Invalid value, must be between 1 and 3");
+		snprintf(last_message, sizeof(last_message), "Invalid value, must be between %d and %d", protocol->limits.fan_speed_min, protocol->limits.fan_speed_max);
+		last_message_size = strlen(last_message);
 		return false;
 	}
-#endif
-
-#if HP_PROTOCOL == HP_PROTOCOL_1_8
-	if((fan_speed < 1) || (fan_speed > 4))
-	{
-		RETURN_MESSAGE("Invalid value, must be between 1 and 4");
-		return false;
-	}
-#endif
 
-	kr = czdec::kr_craft_name_to_index(czcraft::KR_FAN_SPEED);
+	kr = czdec::kr_craft_name_to_index(this, czcraft::KR_FAN_SPEED);
 
 	if(kr == NULL)
 	{
@@ -220,7 +368,7 @@ bool comfortzone_heatpump::set_room_temperature(float room_temp, int timeout)
 {
 	W_CMD cmd;
 	W_REPLY expected_reply;
-	czdec::KNOWN_REGISTER *kr;
+	const czdec::KNOWN_REGISTER *kr;
 	uint16_t int_value;
 	bool push_result;
 
@@ -230,7 +378,7 @@ bool comfortzone_heatpump::set_room_temperature(float room_temp, int timeout)
 		return false;
 	}
 
-	kr = czdec::kr_craft_name_to_index(czcraft::KR_ROOM_HEATING_TEMP);
+	kr = czdec::kr_craft_name_to_index(this, czcraft::KR_ROOM_HEATING_TEMP);
 
 	if(kr == NULL)
 	{
@@ -260,7 +408,7 @@ bool comfortzone_heatpump::set_hot_water_temperature(float hot_water_temp, int t
 {
 	W_CMD cmd;
 	W_REPLY expected_reply;
-	czdec::KNOWN_REGISTER *kr;
+	const czdec::KNOWN_REGISTER *kr;
 	uint16_t int_value;
 	bool push_result;
 
@@ -271,7 +419,7 @@ bool comfortzone_heatpump::set_hot_water_temperature(float hot_water_temp, int t
 		return false;
 	}
 
-	kr = czdec::kr_craft_name_to_index(czcraft::KR_HOT_WATER_TEMP);
+	kr = czdec::kr_craft_name_to_index(this, czcraft::KR_HOT_WATER_TEMP);
 
 	if(kr == NULL)
 	{
@@ -301,7 +449,7 @@ bool comfortzone_heatpump::set_led_luminosity(uint8_t led_level, int timeout)
 {
 	W_SMALL_CMD cmd;
 	W_REPLY expected_reply;
-	czdec::KNOWN_REGISTER *kr;
+	const czdec::KNOWN_REGISTER *kr;
 	bool push_result;
 
 	if(led_level > 6)
@@ -310,7 +458,7 @@ bool comfortzone_heatpump::set_led_luminosity(uint8_t led_level, int timeout)
 		return false;
 	}
 
-	kr = czdec::kr_craft_name_to_index(czcraft::KR_LED_LUMINOSITY);
+	kr = czdec::kr_craft_name_to_index(this, czcraft::KR_LED_LUMINOSITY);
 
 	if(kr == NULL)
 	{
@@ -338,7 +486,7 @@ bool comfortzone_heatpump::set_hour(uint8_t hour, int timeout)
 {
 	W_SMALL_CMD cmd;
 	W_REPLY expected_reply;
-	czdec::KNOWN_REGISTER *kr;
+	const czdec::KNOWN_REGISTER *kr;
 	bool push_result;
 
 	if(hour > 23)
@@ -347,7 +495,7 @@ bool comfortzone_heatpump::set_hour(uint8_t hour, int timeout)
 		return false;
 	}
 
-	kr = czdec::kr_craft_name_to_index(czcraft::KR_HOUR);
+	kr = czdec::kr_craft_name_to_index(this, czcraft::KR_HOUR);
 
 	if(kr == NULL)
 	{
@@ -375,7 +523,7 @@ bool comfortzone_heatpump::set_minute(uint8_t minute, int timeout)
 {
 	W_SMALL_CMD cmd;
 	W_REPLY expected_reply;
-	czdec::KNOWN_REGISTER *kr;
+	const czdec::KNOWN_REGISTER *kr;
 	bool push_result;
 
 	if(minute > 59)
@@ -384,7 +532,7 @@ bool comfortzone_heatpump::set_minute(uint8_t minute, int timeout)
 		return false;
 	}
 
-	kr = czdec::kr_craft_name_to_index(czcraft::KR_MINUTE);
+	kr = czdec::kr_craft_name_to_index(this, czcraft::KR_MINUTE);
 
 	if(kr == NULL)
 	{
@@ -412,7 +560,7 @@ bool comfortzone_heatpump::set_day(uint8_t day, int timeout)
 {
 	W_SMALL_CMD cmd;
 	W_REPLY expected_reply;
-	czdec::KNOWN_REGISTER *kr;
+	const czdec::KNOWN_REGISTER *kr;
 	bool push_result;
 
 	if((day < 1) || (day > 31))
@@ -421,7 +569,7 @@ bool comfortzone_heatpump::set_day(uint8_t day, int timeout)
 		return false;
 	}
 
-	kr = czdec::kr_craft_name_to_index(czcraft::KR_DAY);
+	kr = czdec::kr_craft_name_to_index(this, czcraft::KR_DAY);
 
 	if(kr == NULL)
 	{
@@ -449,7 +597,7 @@ bool comfortzone_heatpump::set_month(uint8_t month, int timeout)
 {
 	W_SMALL_CMD cmd;
 	W_REPLY expected_reply;
-	czdec::KNOWN_REGISTER *kr;
+	const czdec::KNOWN_REGISTER *kr;
 	bool push_result;
 
 	if((month < 1) || (month > 12))
@@ -458,7 +606,7 @@ bool comfortzone_heatpump::set_month(uint8_t month, int timeout)
 		return false;
 	}
 
-	kr = czdec::kr_craft_name_to_index(czcraft::KR_MONTH);
+	kr = czdec::kr_craft_name_to_index(this, czcraft::KR_MONTH);
 
 	if(kr == NULL)
 	{
@@ -486,7 +634,7 @@ bool comfortzone_heatpump::set_year(uint16_t year, int timeout)
 {
 	W_SMALL_CMD cmd;
 	W_REPLY expected_reply;
-	czdec::KNOWN_REGISTER *kr;
+	const czdec::KNOWN_REGISTER *kr;
 	bool push_result;
 
 	if((year < 2000) || (year > 2255))
@@ -495,7 +643,7 @@ bool comfortzone_heatpump::set_year(uint16_t year, int timeout)
 		return false;
 	}
 
-	kr = czdec::kr_craft_name_to_index(czcraft::KR_YEAR);
+	kr = czdec::kr_craft_name_to_index(this, czcraft::KR_YEAR);
 
 	if(kr == NULL)
 	{
@@ -525,7 +673,7 @@ bool comfortzone_heatpump::set_extra_hot_water(bool enable, int timeout)
 {
 	W_CMD cmd;
 	W_REPLY expected_reply;
-	czdec::KNOWN_REGISTER *kr;
+	const czdec::KNOWN_REGISTER *kr;
 	uint16_t cmd_value;
 	byte reply_value;
 	bool push_result;
@@ -533,13 +681,13 @@ bool comfortzone_heatpump::set_extra_hot_water(bool enable, int timeout)
 	// Don't know why this setting requires 2 register (???)
 	if(enable)
 	{
-		kr = czdec::kr_craft_name_to_index(czcraft::KR_EXTRA_HOT_WATER_ON);
+		kr = czdec::kr_craft_name_to_index(this, czcraft::KR_EXTRA_HOT_WATER_ON);
 		cmd_value = 0x0001;
 		reply_value = 0x08;
 	}
 	else
 	{
-		kr = czdec::kr_craft_name_to_index(czcraft::KR_EXTRA_HOT_WATER_OFF);
+		kr = czdec::kr_craft_name_to_index(this, czcraft::KR_EXTRA_HOT_WATER_OFF);
 		cmd_value = 0xFFFE;
 		reply_value = 0x0C;
 	}
@@ -570,7 +718,7 @@ bool comfortzone_heatpump::set_fireplace_mode(bool enable, int timeout)
 {
 	W_CMD cmd;
 	W_REPLY expected_reply;
-	czdec::KNOWN_REGISTER *kr;
+	const czdec::KNOWN_REGISTER *kr;
 	uint16_t cmd_value;
 	byte reply_value;
 	bool push_result;
@@ -578,13 +726,13 @@ bool comfortzone_heatpump::set_fireplace_mode(bool enable, int timeout)
 	// Don't know why this setting requires 2 register (???)
 	if(enable)
 	{
-		kr = czdec::kr_craft_name_to_index(czcraft::KR_FIREPLACE_MODE_ENABLE);
+		kr = czdec::kr_craft_name_to_index(this, czcraft::KR_FIREPLACE_MODE_ENABLE);
 		cmd_value = 0x0400;
 		reply_value = 0x04;
 	}
 	else
 	{
-		kr = czdec::kr_craft_name_to_index(czcraft::KR_FIREPLACE_MODE_DISABLE);
+		kr = czdec::kr_craft_name_to_index(this, czcraft::KR_FIREPLACE_MODE_DISABLE);
 		cmd_value = 0xFBFF;
 		reply_value = 0x08;
 	}
@@ -607,7 +755,7 @@ bool comfortzone_heatpump::set_automatic_daylight_saving(bool enable, int timeou
 {
 	W_CMD cmd;
 	W_REPLY expected_reply;
-	czdec::KNOWN_REGISTER *kr;
+	const czdec::KNOWN_REGISTER *kr;
 	uint16_t cmd_value;
 	byte reply_value;
 	bool push_result;
@@ -615,13 +763,13 @@ bool comfortzone_heatpump::set_automatic_daylight_saving(bool enable, int timeou
 	// Don't know why this setting requires 2 register (???)
 	if(enable)
 	{
-		kr = czdec::kr_craft_name_to_index(czcraft::KR_AUTO_DAYLIGHT_SAVING_ON);
+		kr = czdec::kr_craft_name_to_index(this, czcraft::KR_AUTO_DAYLIGHT_SAVING_ON);
 		cmd_value = 0x0040;
 		reply_value = 0x8E;
 	}
 	else
 	{
-		kr = czdec::kr_craft_name_to_index(czcraft::KR_AUTO_DAYLIGHT_SAVING_OFF);
+		kr = czdec::kr_craft_name_to_index(this, czcraft::KR_AUTO_DAYLIGHT_SAVING_OFF);
 		cmd_value = 0xFFBF;
 		reply_value = 0x8E;
 	}
@@ -654,7 +802,7 @@ bool comfortzone_heatpump::set_sensor_offset(uint16_t sensor_num, float temp_off
 {
 	W_SMALL_CMD cmd;
 	W_REPLY expected_reply;
-	czdec::KNOWN_REGISTER *kr;
+	const czdec::KNOWN_REGISTER *kr;
 	czcraft::KNOWN_REGISTER_CRAFT_NAME czname;
 	uint16_t int_temp_offset;
 
@@ -697,7 +845,7 @@ bool comfortzone_heatpump::set_sensor_offset(uint16_t sensor_num, float temp_off
 		return false;
 	}
 
-	kr = czdec::kr_craft_name_to_index(czname);
+	kr = czdec::kr_craft_name_to_index(this, czname);
 
 	if(kr == NULL)
 	{
@@ -742,6 +890,12 @@ bool comfortzone_heatpump::push_settings(byte *cmd, int cmd_length, byte *expect
 	last_message[0] = '\0';
 	last_message_size = 0;
 
+	if(protocol_detection)
+	{
+		RETURN_MESSAGE("Protocol detection in progress");
+		return false;
+	}
+
 	if(debug_mode)
 	{
 		for(i=0; i < expected_reply_length; i ++)
@@ -819,6 +973,8 @@ bool comfortzone_heatpump::push_settings(byte *cmd, int cmd_length, byte *expect
 					if( (debug_mode) && (last_message_size < (COMFORTZONE_HEATPUMP_LAST_MESSAGE_BUFFER_SIZE - 2)) )
 						last_message[last_message_size++] = 'c';
 
+					czdec::update_shadow(this, NULL, (CZ_PACKET_HEADER *)cmd, RS_OWN_WRITE);
+
 					// clear input buffer and restart normal frame processing
 					disable_cz_buf_clear_on_completion = false;
 					cz_size = 0;
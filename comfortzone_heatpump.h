@@ -29,6 +29,8 @@
 #include <platform_specific.h>
 #include <rs485_interface.h>
 
+struct cz_protocol;
+
 class comfortzone_heatpump
 {
 	public:
@@ -41,12 +43,88 @@ class comfortzone_heatpump
 		PFT_UNKNOWN,	// received frame has an unknown type
 	} PROCESSED_FRAME_TYPE;
 
-	comfortzone_heatpump(RS485Interface* rs485) : rs485(rs485) {}
+	// origin of the last value of a register (see get_register_value())
+	typedef enum register_source
+	{
+		RS_NONE,				// register not seen yet
+		RS_PANEL_WRITE,	// write command sent by the control panel
+		RS_READ_REPLY,		// reply to a read command
+		RS_OWN_WRITE,		// write command sent by this object (set_* methods)
+	} REGISTER_SOURCE;
 
-	void begin();
+	typedef struct
+	{
+		uint32_t value;				// register value (little endian), 0 if size is not 1, 2 or 4
+		byte size;						// #bytes of the value in the frame
+		byte source;					// REGISTER_SOURCE
+		unsigned long timestamp;	// millis() when the value was seen
+	} REGISTER_VALUE;
+
+	// decoder of a register added using add_register()
+	// frame: received frame (CZ_PACKET_HEADER, data and crc, see comfortzone_frame.h), its command can be 'R', 'W', 'r' or 'w'
+	typedef void (*EXTRA_REGISTER_DECODER)(comfortzone_heatpump *czhp, const byte *frame, uint16_t frame_size, void *context);
+
+	// batched change notification, called once per decoded frame which changed comfortzone_status values
+	// changed_fields: bit (1 << CZSF_x) is set for each changed field (see comfortzone_status.h)
+	typedef void (*STATUS_CHANGE_CALLBACK)(comfortzone_heatpump *czhp, uint64_t changed_fields, void *context);
+
+	comfortzone_heatpump(RS485Interface* rs485);
+
+	// protocol_version: heatpump protocol version (HP_PROTOCOL_x_y, see comfortzone_config.h)
+	// All protocol versions are supported, each instance can use a different one.
+	// With HP_PROTOCOL_AUTO, protocol version is detected from received frames. Until it is
+	// detected, frames are not decoded and commands cannot be sent.
+	// output: false if protocol version is not supported (protocol version is not modified)
+	bool begin(uint16_t protocol_version = HP_PROTOCOL);
+
+	// add a register unknown to the register tables of the library (requires HP_MAX_EXTRA_REGISTERS)
+	// Frames of registers found in the library tables are never given to added registers.
+	// input: register number (CZ_PACKET_HEADER.reg_num), name,
+	//        frame size (0 = any size, else only frames of this size use this entry),
+	//        decoder called for each received frame of the register and its context
+	// output: false if decoder is NULL or HP_MAX_EXTRA_REGISTERS registers are already added
+	bool add_register(const byte reg_num[9], const char *name, byte frame_size, EXTRA_REGISTER_DECODER decoder, void *context = NULL);
+
+	// protocol version used by this instance (HP_PROTOCOL_AUTO = detection in progress)
+	uint16_t get_protocol();
 
 	// Function to call periodically to manage rs485 serial input
 	PROCESSED_FRAME_TYPE process();
+
+	// raw value of a status field (see comfortzone_status.h)
+	// With HP_LAZY_DECODING, values are decoded here, on first read after a new frame is received,
+	// and comfortzone_status may contain outdated values until they are read using this function
+	// (except values having a subscriber or reported by the status change callback).
+	int32_t get_status(COMFORTZONE_STATUS_FIELD field);
+
+	// interest decoding: when enabled, status values described by field tables are only decoded
+	// if they have a subscriber (see Subscribable in comfortzone_status.h) or were read using get_status().
+	// Must be called after subscriptions. Values read directly from comfortzone_status are not detected,
+	// the first get_status() of a value returns it from the next received frame.
+	void enable_interest_decoding(bool enable = true);
+
+	// call callback once after each frame changing comfortzone_status, with all changed fields
+	// (comfortzone_status is complete when it is called). Per value subscribers are still notified.
+	// fields: fields to report (bit (1 << CZSF_x)), they are also decoded with interest decoding
+	// (call it before enable_interest_decoding()). callback = NULL disables notification.
+	void set_status_change_callback(STATUS_CHANGE_CALLBACK callback, void *context = NULL, uint64_t fields = ~(uint64_t)0);
+
+	// raw bytes of the last reply frame of a register, for example to follow unknown values
+	// without DEBUG mode (requires HP_REPLY_STORE_SIZE, see comfortzone_config.h)
+	// input: register number (CZ_PACKET_HEADER.reg_num), offset in the frame (header included),
+	//        buffer receiving at most length bytes,
+	//        reply frame size for registers having several reply formats (0 = first format)
+	// output: #bytes copied (less than length if the frame is shorter),
+	//         -1 if no reply of this register is available
+	int get_raw_reply(const byte reg_num[9], uint16_t offset, byte *buffer, uint16_t length, byte frame_size = 0);
+
+	// last value of a register seen on the bus, even when it is not decoded into comfortzone_status
+	// (requires HP_REGISTER_SHADOW, see comfortzone_config.h). For status frames, only size, source
+	// and timestamp are meaningful, use get_raw_reply() to get their content.
+	// input: register number (CZ_PACKET_HEADER.reg_num),
+	//        reply frame size for registers having several reply formats (0 = first format)
+	// output: false if the register is unknown or was not seen yet
+	bool get_register_value(const byte reg_num[9], REGISTER_VALUE *value, byte frame_size = 0);
 	
 	// for debug purpose, it can be useful to get full frame
 	// input: pointer on buffer where last full frame will be copied
@@ -91,6 +169,14 @@ class comfortzone_heatpump
 	// try to guess heatpump address (if needed, must be called after begin)
 	bool guess_heatpump_addr(byte guessed_addr[4], int timeout = 5);
 
+	// poll sequence prediction statistics (reset by begin())
+	// The control panel polls registers in a fixed order. Each received frame is first compared to the
+	// register predicted from this order (hit), else a full lookup is done (miss).
+	// Frames of registers unknown to the library are not counted.
+	// A growing number of misses means control panel behaviour changed.
+	uint32_t get_prediction_hits();
+	uint32_t get_prediction_misses();
+
 	// current status
 	COMFORTZONE_STATUS comfortzone_status;
 
@@ -100,6 +186,89 @@ class comfortzone_heatpump
 
 	RS485Interface *rs485;
 
+	// tables of the protocol version
+	const struct cz_protocol *protocol;
+
+	// protocol detection (see begin())
+	bool protocol_detection = false;
+	uint16_t protocol_detection_frames = 0;						// #frames received during detection
+	uint16_t protocol_detection_scores[HP_NB_PROTOCOLS];		// #frames recognized by each protocol version
+
+	// poll sequence prediction (see get_prediction_hits())
+	// poll key = (register index << 1) | (1 if frame is a reply)
+#define POLL_NONE 0xFF
+	byte poll_next[HP_MAX_REGISTERS * 2];		// register index expected after each poll key (POLL_NONE = unknown)
+	byte poll_weak[HP_MAX_REGISTERS * 2 / 8];	// 1 bit per poll key: poll_next missed once, replaced on next miss
+	byte poll_last = POLL_NONE;					// poll key of the last received frame
+	uint32_t poll_hits = 0;
+	uint32_t poll_misses = 0;
+
+#ifndef HP_REPLY_STORE_SIZE
+	// hash of the last reply frame of each register (0 = no reply received), see HP_SKIP_UNCHANGED_REPLIES
+	uint32_t reply_hash[HP_MAX_REGISTERS];
+#endif
+
+	// 1 bit per register: next reply is fully decoded even if identical to the previous one
+	// (set when interest_mask gains fields, see set_interest_mask())
+	byte reply_refresh[(HP_MAX_REGISTERS + 7) / 8];
+
+#ifdef HP_REPLY_STORE_SIZE
+	// last reply frame of each register (see HP_REPLY_STORE_SIZE)
+	byte reply_store[HP_REPLY_STORE_SIZE];
+	uint16_t reply_store_used;						// #bytes of reply_store in use
+	uint16_t reply_slot[HP_MAX_REGISTERS];		// offset of the last reply of each register in reply_store
+	byte reply_slot_size[HP_MAX_REGISTERS];	// size of the last reply of each register (0 = not stored)
+	byte reply_last_size[HP_MAX_REGISTERS];	// size of the last reply received (!= reply_slot_size: not stored)
+	uint16_t reply_generation[HP_MAX_REGISTERS];	// incremented each time the kept reply of the register changes
+	bool reply_stored;								// current reply frame is kept in reply_store
+#endif
+
+#ifdef HP_REGISTER_SHADOW
+	// last value of each register (see get_register_value())
+	REGISTER_VALUE shadow[HP_MAX_REGISTERS];
+#endif
+
+#ifdef HP_MAX_EXTRA_REGISTERS
+	// registers added using add_register()
+	typedef struct
+	{
+		byte reg_num[9];
+		uint32_t reg_key;			// cz_reg_key(reg_num)
+		byte frame_size;			// 0 = any size
+		const char *name;
+		EXTRA_REGISTER_DECODER decoder;
+		void *context;
+	} EXTRA_REGISTER;
+
+	EXTRA_REGISTER extra_registers[HP_MAX_EXTRA_REGISTERS];
+	byte nb_extra_registers = 0;
+	uint32_t extra_hash_mask = 0;				// bit (reg_num hash & 31) is set for each added register
+#endif
+
+	// status fields to decode (bit (1 << CZSF_x)), see enable_interest_decoding()
+	uint64_t interest_mask = ~(uint64_t)0;
+
+	// batched change notification (see set_status_change_callback())
+	STATUS_CHANGE_CALLBACK status_change_callback = NULL;
+	void *status_change_context = NULL;
+	uint64_t status_change_fields = 0;
+
+#ifdef HP_LAZY_DECODING
+	// pending value of each status field: table entry describing it and register of the reply frame
+	const void *lazy_field[CZSF_NB_FIELDS];		// czdec::STATUS_FIELD (NULL = comfortzone_status is up to date)
+	byte lazy_register[CZSF_NB_FIELDS];
+	uint16_t lazy_generation[CZSF_NB_FIELDS];	// reply_generation of the register when value was decoded
+#endif
+
+	// bytes of the current reply frame which changed since the previous reply of its register (1 bit per byte)
+	byte reply_changes[256 / 8 + 1];
+
+	// forget poll sequence and last replies (register indexes depend on protocol version)
+	void reset_register_cache();
+
+	// change interest_mask, next reply of each register is fully decoded if fields are added
+	void set_interest_mask(uint64_t mask);
+
 	FastCRC8 CRC8;
 
 	bool debug_mode = false;
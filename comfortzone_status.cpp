@@ -0,0 +1,78 @@
+#include "comfortzone_config.h"
+#include "comfortzone_status.h"
+
+// functions below are generated from COMFORTZONE_STATUS_FIELDS (see comfortzone_status.h)
+
+// set a status field from its raw value (value is truncated to the field type)
+void czstatus::set_field(COMFORTZONE_STATUS *s, COMFORTZONE_STATUS_FIELD field, int32_t value)
+{
+	switch(field)
+	{
+#define CZSF_SET(type, member, field)	case field:	s->member = (type)value;	break;
+		COMFORTZONE_STATUS_FIELDS(CZSF_SET)
+#undef CZSF_SET
+
+		case CZSF_NB_FIELDS:
+			break;
+	}
+}
+
+// get the raw value of a status field
+int32_t czstatus::get_field(const COMFORTZONE_STATUS *s, COMFORTZONE_STATUS_FIELD field)
+{
+	switch(field)
+	{
+#define CZSF_GET(type, member, field)	case field:	return (int32_t)(type)s->member;
+		COMFORTZONE_STATUS_FIELDS(CZSF_GET)
+#undef CZSF_GET
+
+		case CZSF_NB_FIELDS:
+			break;
+	}
+
+	return 0;
+}
+
+// name of a status field (= COMFORTZONE_STATUS member name)
+const char *czstatus::get_field_name(COMFORTZONE_STATUS_FIELD field)
+{
+	switch(field)
+	{
+#define CZSF_NAME(type, member, field)	case field:	return #member;
+		COMFORTZONE_STATUS_FIELDS(CZSF_NAME)
+#undef CZSF_NAME
+
+		case CZSF_NB_FIELDS:
+			break;
+	}
+
+	return NULL;
+}
+
+// check if a status field has a subscriber
+bool czstatus::has_subscriber(const COMFORTZONE_STATUS *s, COMFORTZONE_STATUS_FIELD field)
+{
+	switch(field)
+	{
+#define CZSF_HAS_SUBSCRIBER(type, member, field)	case field:	return s->member.has_subscriber();
+		COMFORTZONE_STATUS_FIELDS(CZSF_HAS_SUBSCRIBER)
+#undef CZSF_HAS_SUBSCRIBER
+
+		case CZSF_NB_FIELDS:
+			break;
+	}
+
+	return false;
+}
+
+// get the fields changed since the previous call (bit (1 << CZSF_x)) and clear their change flag
+uint64_t czstatus::collect_changes(COMFORTZONE_STATUS *s)
+{
+	uint64_t changed = 0;
+
+#define CZSF_COLLECT(type, member, field)	if(s->member.take_changed())	changed |= ((uint64_t)1 << field);
+	COMFORTZONE_STATUS_FIELDS(CZSF_COLLECT)
+#undef CZSF_COLLECT
+
+	return changed;
+}
@@ -2,6 +2,10 @@
 #define _COMFORTZONE_STATUS_H
 
 #include "platform_specific.h"
+#include "comfortzone_config.h"
+
+// number of hot water steps (12 displayed steps + 3 non displayed steps)
+#define CZ_NB_HOT_WATER_STEPS 15
 
 typedef enum
 {
@@ -9,9 +13,7 @@ typedef enum
 	CZCMP_STOPPING,		// compressor is shutting down
 	CZCMP_RUNNING,			// compressor is up and running
 	CZCMP_UNKNOWN,			// undefined status (very rare)
-#if HP_PROTOCOL == HP_PROTOCOL_1_8
 	CZCMP_DEFROST,			// (v1.8 only)
-#endif
 } COMFORTZONE_COMPRESSOR_ACTIVITY;
 
 typedef enum
@@ -20,25 +22,65 @@ typedef enum
 	CZMD_ROOM_HEATING,	// default mode (even when everything is off)
 	CZMD_HOT_WATER,		// hot water production
 	CZMD_UNKNOWN,			// undefined mode	(rarer)
-#if HP_PROTOCOL == HP_PROTOCOL_1_8
-	CZMD_ROOM_HEATING_AND_HOT_WATER,		// room heating + hot water production
-#endif
+	CZMD_ROOM_HEATING_AND_HOT_WATER,		// room heating + hot water production (v1.8 only)
 } COMFORTZONE_MODE;
 
+// value notifying its subscribers when it changes (assigning the same value again notifies nobody)
 template <typename T>
 class Subscribable {
 public:
 	using callback_t = void (*)(T, void*);
 	
-	void subscribe(callback_t callback, void *context) {
-		_on_change = callback;
-		_context = context;
+	// add a subscriber (subscribing the same callback and context twice returns the same handle)
+	// output: handle for unsubscribe(), -1 if callback is NULL or HP_MAX_SUBSCRIBERS subscribers are already registered
+	int subscribe(callback_t callback, void *context) {
+		int free_slot = -1;
+		int i;
+
+		if (callback == NULL)
+			return -1;
+
+		for (i = 0; i < HP_MAX_SUBSCRIBERS; i++) {
+			if (_subscribers[i].on_change == NULL) {
+				if (free_slot == -1)
+					free_slot = i;
+			}
+			else if ((_subscribers[i].on_change == callback) && (_subscribers[i].context == context))
+				return i;
+		}
+
+		if (free_slot != -1) {
+			_subscribers[free_slot].on_change = callback;
+			_subscribers[free_slot].context = context;
+			_nb_subscribers++;
+		}
+
+		return free_slot;
+	}
+
+	// remove a subscriber (handle returned by subscribe())
+	void unsubscribe(int handle) {
+		if ((handle < 0) || (handle >= HP_MAX_SUBSCRIBERS) || (_subscribers[handle].on_change == NULL))
+			return;
+
+		_subscribers[handle].on_change = NULL;
+		_subscribers[handle].context = NULL;
+		_nb_subscribers--;
 	}
 
 	Subscribable<T>& operator=(const T& value) {
+		int i;
+
+		if ((_valid) && (_value == value))
+			return *this;
+
 		_value = value;
-		if (_on_change != NULL) {
-			_on_change(_value, _context);
+		_valid = true;
+		_changed = true;
+
+		for (i = 0; i < HP_MAX_SUBSCRIBERS; i++) {
+			if (_subscribers[i].on_change != NULL)
+				_subscribers[i].on_change(_value, _subscribers[i].context);
 		}
 		return *this;
 	}
@@ -47,87 +89,150 @@ public:
 		return _value;
 	}
 
+	bool has_subscriber() const {
+		return (_nb_subscribers != 0);
+	}
+
+	// true if the value changed since the previous call (see czstatus::collect_changes())
+	bool take_changed() {
+		bool changed = _changed;
+
+		_changed = false;
+		return changed;
+	}
+
 private:
 	T _value;
-	callback_t _on_change = NULL;
-	void *_context = NULL;
+	bool _valid = false;			// false until the first assignment (first value is always notified)
+	bool _changed = false;			// value changed since the last take_changed()
+	byte _nb_subscribers = 0;
+
+	struct {
+		callback_t on_change = NULL;
+		void *context = NULL;
+	} _subscribers[HP_MAX_SUBSCRIBERS];
 };
 
+// comfortzone_status values, in COMFORTZONE_STATUS_FIELD order: X(type, member, field identifier)
+// COMFORTZONE_STATUS members, COMFORTZONE_STATUS_FIELD values and czstatus functions are generated from this list
+#define COMFORTZONE_STATUS_FIELDS(X) \
+	X(uint16_t, fan_time_to_filter_change, CZSF_FAN_TIME_TO_FILTER_CHANGE)	/* days (proto: 1.60, 1.80, 2.21) */ \
+	\
+	X(bool, filter_alarm, CZSF_FILTER_ALARM)	/* true = replace/clean filter alarm, false = filter ok (proto: 1.60, 1.80) */ \
+	X(bool, general_alarm, CZSF_GENERAL_ALARM)	/* true = any active alarm (excluding filter), false = no alarm (proto: 1.60, 1.80) */ \
+	\
+	X(bool, hot_water_production, CZSF_HOT_WATER_PRODUCTION)	/* true = on, false = off */ \
+	X(bool, room_heating_in_progress, CZSF_ROOM_HEATING_IN_PROGRESS)	/* true = on, false = off */ \
+	\
+	X(COMFORTZONE_COMPRESSOR_ACTIVITY, compressor_activity, CZSF_COMPRESSOR_ACTIVITY)	/* (proto: 1.60, 1.80) */ \
+	X(bool, additional_power_enabled, CZSF_ADDITIONAL_POWER_ENABLED)	/* true = resistor is enabled, false = resistor is disabled (proto: 1.60, 1.80, 2.21) */ \
+	\
+	X(COMFORTZONE_MODE, mode, CZSF_MODE)	/* (proto: 1.60, 1.80) */ \
+	X(bool, defrost_enabled, CZSF_DEFROST_ENABLED)	/* true = defrost in progress, false = no defrost in progress (proto: 1.60, 1.80) */ \
+	\
+	X(int16_t, sensors_te0_outdoor_temp, CZSF_SENSORS_TE0_OUTDOOR_TEMP)	/* °C, * 10 (proto: 1.60, 1.80) */ \
+	X(int16_t, sensors_te1_flow_water, CZSF_SENSORS_TE1_FLOW_WATER)	/* °C, * 10 (proto: 1.60, 1.80) */ \
+	X(int16_t, sensors_te2_return_water, CZSF_SENSORS_TE2_RETURN_WATER)	/* °C, * 10 (proto: 1.60, 1.80) */ \
+	X(int16_t, sensors_te3_indoor_temp, CZSF_SENSORS_TE3_INDOOR_TEMP)	/* °C, * 10 (proto: 1.60, 1.80) */ \
+	X(int16_t, sensors_te4_hot_gas_temp, CZSF_SENSORS_TE4_HOT_GAS_TEMP)	/* °C, * 10 (proto: 1.60, 1.80) */ \
+	X(int16_t, sensors_te5_exchanger_out, CZSF_SENSORS_TE5_EXCHANGER_OUT)	/* °C, * 10 (proto: 1.60, 1.80) */ \
+	X(int16_t, sensors_te6_evaporator_in, CZSF_SENSORS_TE6_EVAPORATOR_IN)	/* °C, * 10 (proto: 1.60, 1.80) */ \
+	X(int16_t, sensors_te7_exhaust_air, CZSF_SENSORS_TE7_EXHAUST_AIR)	/* °C, * 10 (proto: 1.60, 1.80) */ \
+	X(int16_t, sensors_te24_hot_water_temp, CZSF_SENSORS_TE24_HOT_WATER_TEMP)	/* °C, * 10 (proto: 1.60, 1.80) */ \
+	\
+	X(int16_t, expansion_valve_calculated_setting, CZSF_EXPANSION_VALVE_CALCULATED_SETTING)	/* K, * 10 (proto: 1.60, 1.80) */ \
+	X(int16_t, expansion_valve_temperature_difference, CZSF_EXPANSION_VALVE_TEMPERATURE_DIFFERENCE)	/* K, * 10 (proto: 1.60, 1.80) */ \
+	\
+	X(int16_t, heatpump_current_compressor_frequency, CZSF_HEATPUMP_CURRENT_COMPRESSOR_FREQUENCY)	/* Hz, * 10 (proto: 1.60, 1.80, 2.21) */ \
+	\
+	X(int16_t, heatpump_current_compressor_power, CZSF_HEATPUMP_CURRENT_COMPRESSOR_POWER)	/* W = power generated by compressor (proto: 1.60, 1.80, 2.21) */ \
+	X(int16_t, heatpump_current_add_power, CZSF_HEATPUMP_CURRENT_ADD_POWER)	/* W = additional power (resistor) (proto: 1.60, 1.80, 2.21) */ \
+	X(int16_t, heatpump_current_total_power, CZSF_HEATPUMP_CURRENT_TOTAL_POWER)	/* W = total power produced (proto: 1.60, 1.80, 2.21) */ \
+	X(int16_t, heatpump_current_compressor_input_power, CZSF_HEATPUMP_CURRENT_COMPRESSOR_INPUT_POWER)	/* W = power sent to compressor (proto: 1.60, 1.80, 2.21) */ \
+	\
+	X(uint32_t, compressor_energy, CZSF_COMPRESSOR_ENERGY)	/* kWh, * 100 (proto: 1.60, 1.80, 2.21) */ \
+	X(uint32_t, add_energy, CZSF_ADD_ENERGY)	/* kWh, * 100 (proto: 1.60, 1.80, 2.21) */ \
+	X(uint32_t, hot_water_energy, CZSF_HOT_WATER_ENERGY)	/* kWh, * 100 (proto: 1.60, 1.80, 2.21) */ \
+	\
+	X(uint32_t, compressor_runtime, CZSF_COMPRESSOR_RUNTIME)	/* minutes (proto: 1.60, 1.80, 2.21) */ \
+	X(uint32_t, total_runtime, CZSF_TOTAL_RUNTIME)	/* minutes (proto: 1.60, 1.80, 2.21) */ \
+	\
+	/* heatpump current time */ \
+	X(byte, hour, CZSF_HOUR)	/* (proto: 1.60, 1.80, 2.21) */ \
+	X(byte, minute, CZSF_MINUTE)	/* (proto: 1.60, 1.80, 2.21) */ \
+	X(byte, second, CZSF_SECOND)	/* (proto: 1.60, 1.80, 2.21) */ \
+	\
+	/* heatpump current day */ \
+	X(byte, day, CZSF_DAY)	/* (proto: 1.60, 1.80, 2.21) */ \
+	X(byte, month, CZSF_MONTH)	/* (proto: 1.60, 1.80, 2.21) */ \
+	X(uint16_t, year, CZSF_YEAR)	/* (proto: 1.60, 1.80, 2.21) */ \
+	\
+	X(byte, day_of_week, CZSF_DAY_OF_WEEK)	/* 1 = monday, 7 = sunday (proto: 1.60, 1.80, 2.21) */ \
+	\
+	/* current user settings */ \
+	X(byte, fan_speed, CZSF_FAN_SPEED)	/* 1 = low, 2 = normal, 3 = fast (proto: 1.60, 1.80, 2.21) */ \
+	\
+	X(int16_t, room_heating_setting, CZSF_ROOM_HEATING_SETTING)	/* °C, * 10 (user selected) (proto: 1.60, 1.80, 2.21) */ \
+	X(int16_t, hot_water_setting, CZSF_HOT_WATER_SETTING)	/* °C, * 10 (user selected) (proto: 1.60, 1.80) */ \
+	X(bool, extra_hot_water_setting, CZSF_EXTRA_HOT_WATER_SETTING)	/* true = on, false = off */ \
+	\
+	X(byte, hot_water_priority_setting, CZSF_HOT_WATER_PRIORITY_SETTING)	/* 1 = low, 2 = normal, 3 = fast */ \
+	\
+	X(byte, led_luminosity_setting, CZSF_LED_LUMINOSITY_SETTING)	/* 0 = off -> 6 = highest level (proto: 1.60, 1.80) */ \
+	\
+	/* current heatpump calculated setting */ \
+	X(uint16_t, fan_speed_duty, CZSF_FAN_SPEED_DUTY)	/* %, * 10 (proto: 1.60, 1.80) */ \
+	X(int16_t, hot_water_calculated_setting, CZSF_HOT_WATER_CALCULATED_SETTING)	/* °C, * 10 (heatpump selected). can be hot_water_setting (no extra hot water) or a different value (proto: 1.60, 1.80) */ \
+	\
+	X(int16_t, calculated_flow_set, CZSF_CALCULATED_FLOW_SET)	/* °C, * 10 (heatpump selected) (proto: 1.80) */
+
 // Heatpump status
 // Not all values are available on all protocol version
 // Supported protocols are 1.60, 1.80, 2.21. If no protocol version is specified, only 1.60 is supported
 typedef struct
 {
-	Subscribable<uint16_t> fan_time_to_filter_change;		// days (proto: 1.60, 1.80, 2.21)
-
-	Subscribable<bool> filter_alarm;								// true = replace/clean filter alarm, false = filter ok (proto: 1.60, 1.80)
-	Subscribable<bool> general_alarm;								// true = any active alarm (excluding filter), false = no alarm (proto: 1.60, 1.80)
-
-	Subscribable<bool> hot_water_production;					// true = on, false = off
-	Subscribable<bool> room_heating_in_progress;				// true = on, false = off
-
-	Subscribable<COMFORTZONE_COMPRESSOR_ACTIVITY> compressor_activity;		// (proto: 1.60, 1.80)
-	Subscribable<bool> additional_power_enabled;				// true = resistor is enabled, false = resistor is disabled (proto: 1.60, 1.80, 2.21)
-
-	Subscribable<COMFORTZONE_MODE> mode;						// (proto: 1.60, 1.80)
-	Subscribable<bool> defrost_enabled;							// true = defrost in progress, false = no defrost in progress (proto: 1.60, 1.80)
-
-	Subscribable<int16_t> sensors_te0_outdoor_temp;			// °C, * 10 (proto: 1.60, 1.80)
-	Subscribable<int16_t> sensors_te1_flow_water;			// °C, * 10 (proto: 1.60, 1.80)
-	Subscribable<int16_t> sensors_te2_return_water;			// °C, * 10 (proto: 1.60, 1.80)
-	Subscribable<int16_t> sensors_te3_indoor_temp;			// °C, * 10 (proto: 1.60, 1.80)
-	Subscribable<int16_t> sensors_te4_hot_gas_temp;			// °C, * 10 (proto: 1.60, 1.80)
-	Subscribable<int16_t> sensors_te5_exchanger_out;		// °C, * 10 (proto: 1.60, 1.80)
-	Subscribable<int16_t> sensors_te6_evaporator_in;		// °C, * 10 (proto: 1.60, 1.80)
-	Subscribable<int16_t> sensors_te7_exhaust_air;			// °C, * 10 (proto: 1.60, 1.80)
-	Subscribable<int16_t> sensors_te24_hot_water_temp;		// °C, * 10 (proto: 1.60, 1.80)
-
-	Subscribable<int16_t> expansion_valve_calculated_setting; // K, * 10 (proto: 1.60, 1.80)
-	Subscribable<int16_t> expansion_valve_temperature_difference; // K, * 10 (proto: 1.60, 1.80)
-
-	Subscribable<int16_t> heatpump_current_compressor_frequency;	// Hz, * 10 (proto: 1.60, 1.80, 2.21)
-
-	Subscribable<int16_t> heatpump_current_compressor_power;			// W = power generated by compressor (proto: 1.60, 1.80, 2.21)
-	Subscribable<int16_t> heatpump_current_add_power;					// W = additional power (resistor) (proto: 1.60, 1.80, 2.21)
-	Subscribable<int16_t> heatpump_current_total_power;				// W = total power produced (proto: 1.60, 1.80, 2.21)
-	Subscribable<int16_t> heatpump_current_compressor_input_power;	// W = power sent to compressor (proto: 1.60, 1.80, 2.21)
-
-	Subscribable<uint32_t> compressor_energy;					// kWh, * 100 (proto: 1.60, 1.80, 2.21)
-	Subscribable<uint32_t> add_energy;							// kWh, * 100 (proto: 1.60, 1.80, 2.21)
-	Subscribable<uint32_t> hot_water_energy;					// kWh, * 100 (proto: 1.60, 1.80, 2.21)
-
-	Subscribable<uint32_t> compressor_runtime;				// minutes (proto: 1.60, 1.80, 2.21)
-	Subscribable<uint32_t> total_runtime;						// minutes (proto: 1.60, 1.80, 2.21)
-
-	// heatpump current time
-	Subscribable<byte> hour; 										// (proto: 1.60, 1.80, 2.21)
-	Subscribable<byte> minute; 									// (proto: 1.60, 1.80, 2.21)
-	Subscribable<byte> second; 									// (proto: 1.60, 1.80, 2.21)
+#define CZSF_MEMBER(type, member, field)	Subscribable<type> member;
+	COMFORTZONE_STATUS_FIELDS(CZSF_MEMBER)
+#undef CZSF_MEMBER
+
+	// hot water steps, °C, * 10 (proto: 1.60)
+	// plain arrays updated when their bytes change, without subscriber notification and not reported by
+	// the status change callback. With interest decoding, they are only decoded with hot_water_setting
+	int16_t hot_water_normal_steps[CZ_NB_HOT_WATER_STEPS];
+	int16_t hot_water_high_steps[CZ_NB_HOT_WATER_STEPS];
+	int16_t hot_water_extra_steps[CZ_NB_HOT_WATER_STEPS];
+} COMFORTZONE_STATUS;
 
-	// heatpump current day
-	Subscribable<byte> day; 										// (proto: 1.60, 1.80, 2.21)
-	Subscribable<byte> month; 										// (proto: 1.60, 1.80, 2.21)
-	Subscribable<uint16_t> year; 									// (proto: 1.60, 1.80, 2.21)
+// Identifier of each COMFORTZONE_STATUS field, in structure order
+typedef enum
+{
+#define CZSF_ENUM(type, member, field)	field,
+	COMFORTZONE_STATUS_FIELDS(CZSF_ENUM)
+#undef CZSF_ENUM
 
-	Subscribable<byte> day_of_week;								// 1 = monday, 7 = sunday (proto: 1.60, 1.80, 2.21)
+	CZSF_NB_FIELDS
+} COMFORTZONE_STATUS_FIELD;
 
-	// current user settings
-	Subscribable<byte> fan_speed;									// 1 = low, 2 = normal, 3 = fast (proto: 1.60, 1.80, 2.21)
+static_assert(CZSF_NB_FIELDS <= 64, "status fields do not fit in a 64 bits mask");
 
-	Subscribable<int16_t> room_heating_setting;				// °C, * 10 (user selected) (proto: 1.60, 1.80, 2.21)
-	Subscribable<int16_t> hot_water_setting;					// °C, * 10 (user selected) (proto: 1.60, 1.80)
-	Subscribable<bool> extra_hot_water_setting;				// true = on, false = off
+class czstatus
+{
+	public:
+	// set a status field from its raw value (subscribers are notified)
+	static void set_field(COMFORTZONE_STATUS *s, COMFORTZONE_STATUS_FIELD field, int32_t value);
 
-	Subscribable<byte> hot_water_priority_setting;			// 1 = low, 2 = normal, 3 = fast
+	// get the raw value of a status field
+	static int32_t get_field(const COMFORTZONE_STATUS *s, COMFORTZONE_STATUS_FIELD field);
 
-	Subscribable<byte> led_luminosity_setting;				// 0 = off -> 6 = highest level (proto: 1.60, 1.80)
+	// name of a status field (= COMFORTZONE_STATUS member name), NULL if field is invalid
+	static const char *get_field_name(COMFORTZONE_STATUS_FIELD field);
 
-	// current heatpump calculated setting
-	Subscribable<uint16_t> fan_speed_duty;						// %, * 10 (proto: 1.60, 1.80)
-	Subscribable<int16_t> hot_water_calculated_setting;	// °C, * 10 (heatpump selected). can be hot_water_setting (no extra hot water) or a different value (proto: 1.60, 1.80)
+	// check if a status field has a subscriber
+	static bool has_subscriber(const COMFORTZONE_STATUS *s, COMFORTZONE_STATUS_FIELD field);
 
-	Subscribable<int16_t> calculated_flow_set;				// °C, * 10 (heatpump selected) (proto: 1.80)
-} COMFORTZONE_STATUS;
+	// get the fields changed since the previous call (bit (1 << CZSF_x)) and clear their change flag
+	static uint64_t collect_changes(COMFORTZONE_STATUS *s);
+};
 
 #endif
 
@@ -1,7 +1,9 @@
 #ifndef _COMFORTZONE_TOOLS_H
 #define _COMFORTZONE_TOOLS_H
 
-static inline uint16_t get_uint16(byte *ptr)
+#include <string.h>
+
+static inline uint16_t get_uint16(const byte *ptr)
 {
 	uint16_t v;
 
@@ -10,7 +12,7 @@ static inline uint16_t get_uint16(byte *ptr)
 	return v;
 }
 
-static inline int16_t get_int16(byte *ptr)
+static inline int16_t get_int16(const byte *ptr)
 {
 	int16_t v;
 
@@ -19,7 +21,7 @@ static inline int16_t get_int16(byte *ptr)
 	return v;
 }
 
-static inline uint32_t get_uint32(byte *ptr)
+static inline uint32_t get_uint32(const byte *ptr)
 {
 	uint32_t v;
 
@@ -28,4 +30,18 @@ static inline uint32_t get_uint32(byte *ptr)
 	return v;
 }
 
+// convert an array of little endian int16 values (for example hot water steps of a status frame)
+static inline void get_int16_array(int16_t *dest, const byte *src, int nb)
+{
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+	// same representation in memory, bulk copy (vectorized by memcpy)
+	memcpy(dest, src, nb * sizeof(int16_t));
+#else
+	int i;
+
+	for(i = 0; i < nb; i++)
+		dest[i] = get_int16(src + 2 * i);
+#endif
+}
+
 #endif
@@ -0,0 +1,285 @@
+#include <Arduino.h>
+
+#include "comfortzone_heatpump.h"
+#include "comfortzone_corpus.h"
+#include "rs485_interface.h"
+
+// Replay the golden frame corpus (see comfortzone_corpus.h) through the library.
+// 1) decode check: each frame is processed and the result is compared to the
+//    expected frame type and COMFORTZONE_STATUS values
+// 2) benchmark: the whole corpus is replayed several times to measure the number
+//    of frames processed per second
+// 3) interest decoding check: an instance decoding no value replays the corpus, then
+//    reads all values (so they become decoded) and replays it again. Its values must
+//    be those of the instance decoding everything
+// 4) notification check: an instance having subscribers and a status change callback
+//    replays the corpus. Notified values must be up to date in comfortzone_status
+//    without get_status(), also with HP_LAZY_DECODING
+// No RS485 module is required, frames are sent through an in-memory bus.
+
+// Note: corpus is selected using HP_PROTOCOL (see comfortzone_config.h)
+
+// number of corpus replays for benchmark
+#define BENCHMARK_LOOPS 100
+
+MemoryRS485Interface bus;
+comfortzone_heatpump heatpump(&bus);
+
+MemoryRS485Interface interest_bus;
+comfortzone_heatpump interest_heatpump(&interest_bus);
+
+MemoryRS485Interface notify_bus;
+comfortzone_heatpump notify_heatpump(&notify_bus);
+
+static int16_t notified_room_heating_setting;
+static int nb_room_heating_setting_calls = 0;
+static int nb_status_change_calls = 0;
+
+// feed one frame into the bus and process it
+// output: frame size
+static int replay_frame(const byte *frame, comfortzone_heatpump::PROCESSED_FRAME_TYPE *pft,
+								MemoryRS485Interface *frame_bus = &bus, comfortzone_heatpump *hp = &heatpump)
+{
+	int frame_size = frame[10];		// CZ_PACKET_HEADER.packet_size
+
+	frame_bus->feed(frame, frame_size);
+
+	*pft = hp->process();
+
+	return frame_size;
+}
+
+static void replay_corpus(MemoryRS485Interface *frame_bus, comfortzone_heatpump *hp)
+{
+	comfortzone_heatpump::PROCESSED_FRAME_TYPE pft;
+	uint32_t pos = 0;
+	int i;
+
+	for(i = 0; i < comfortzone_corpus.nb_frames; i++)
+		pos += replay_frame(comfortzone_corpus.frames + pos, &pft, frame_bus, hp);
+}
+
+static void decode_check()
+{
+	const COMFORTZONE_CORPUS_VALUE *v = comfortzone_corpus.values;
+	const COMFORTZONE_CORPUS_VALUE *v_end = comfortzone_corpus.values + comfortzone_corpus.nb_values;
+	comfortzone_heatpump::PROCESSED_FRAME_TYPE pft;
+	uint32_t pos = 0;
+	int errors = 0;
+	int i;
+
+	for(i = 0; i < comfortzone_corpus.nb_frames; i++)
+	{
+		pos += replay_frame(comfortzone_corpus.frames + pos, &pft);
+
+		if(pft != comfortzone_corpus.frame_types[i])
+		{
+			Serial.print("Frame #");
+			Serial.print(i);
+			Serial.print(": frame type ");
+			Serial.print((int)pft);
+			Serial.print(" instead of ");
+			Serial.println((int)comfortzone_corpus.frame_types[i]);
+			errors++;
+		}
+
+		while((v < v_end) && (v->frame_num == i))
+		{
+			int32_t value = heatpump.get_status((COMFORTZONE_STATUS_FIELD)v->field);
+
+			if(value != v->value)
+			{
+				Serial.print("Frame #");
+				Serial.print(i);
+				Serial.print(": field ");
+				Serial.print((int)v->field);
+				Serial.print(" = ");
+				Serial.print((long)value);
+				Serial.print(" instead of ");
+				Serial.println((long)v->value);
+				errors++;
+			}
+
+			v++;
+		}
+	}
+
+	Serial.print("Corpus v");
+	Serial.print(COMFORTZONE_CORPUS_VERSION);
+	Serial.print(", protocol ");
+	Serial.print((int)comfortzone_corpus.protocol);
+	Serial.print(": ");
+	Serial.print((int)comfortzone_corpus.nb_frames);
+	Serial.print(" frames, ");
+	Serial.print((int)comfortzone_corpus.nb_values);
+	Serial.print(" values, ");
+	Serial.print(errors);
+	Serial.println(" error(s)");
+}
+
+static void benchmark()
+{
+	comfortzone_heatpump::PROCESSED_FRAME_TYPE pft;
+	unsigned long start;
+	unsigned long duration;
+	uint32_t pos;
+	int loop;
+	int i;
+
+	if(comfortzone_corpus.nb_frames == 0)
+		return;
+
+	start = micros();
+
+	for(loop = 0; loop < BENCHMARK_LOOPS; loop++)
+	{
+		pos = 0;
+
+		for(i = 0; i < comfortzone_corpus.nb_frames; i++)
+			pos += replay_frame(comfortzone_corpus.frames + pos, &pft);
+	}
+
+	duration = micros() - start;
+
+	if(duration == 0)
+		duration = 1;
+
+	Serial.print("Benchmark: ");
+	Serial.print((unsigned long)BENCHMARK_LOOPS * comfortzone_corpus.nb_frames);
+	Serial.print(" frames in ");
+	Serial.print(duration);
+	Serial.print("us => ");
+	Serial.print((float)BENCHMARK_LOOPS * comfortzone_corpus.nb_frames * 1000000.0 / duration);
+	Serial.print(" frames/s - poll prediction: ");
+	Serial.print(heatpump.get_prediction_hits());
+	Serial.print(" hits, ");
+	Serial.print(heatpump.get_prediction_misses());
+	Serial.println(" misses");
+}
+
+// heatpump must have replayed the whole corpus (it decodes all values)
+static void interest_check()
+{
+	int errors = 0;
+	int i;
+
+	interest_heatpump.begin();
+	interest_heatpump.enable_interest_decoding();
+
+	replay_corpus(&interest_bus, &interest_heatpump);
+
+	// values become interesting once read
+	for(i = 0; i < CZSF_NB_FIELDS; i++)
+		interest_heatpump.get_status((COMFORTZONE_STATUS_FIELD)i);
+
+	replay_corpus(&interest_bus, &interest_heatpump);
+
+	for(i = 0; i < CZSF_NB_FIELDS; i++)
+	{
+		int32_t value = interest_heatpump.get_status((COMFORTZONE_STATUS_FIELD)i);
+		int32_t expected = heatpump.get_status((COMFORTZONE_STATUS_FIELD)i);
+
+		if(value != expected)
+		{
+			Serial.print("Interest decoding: field ");
+			Serial.print(czstatus::get_field_name((COMFORTZONE_STATUS_FIELD)i));
+			Serial.print(" = ");
+			Serial.print((long)value);
+			Serial.print(" instead of ");
+			Serial.println((long)expected);
+			errors++;
+		}
+	}
+
+	Serial.print("Interest decoding: ");
+	Serial.print(errors);
+	Serial.println(" error(s)");
+}
+
+static void room_heating_setting_changed(int16_t value, void *context)
+{
+	notified_room_heating_setting = value;
+	nb_room_heating_setting_calls++;
+}
+
+static void status_changed(comfortzone_heatpump *czhp, uint64_t changed_fields, void *context)
+{
+	nb_status_change_calls++;
+}
+
+// heatpump must have replayed the whole corpus (it decodes all values)
+static void notify_check()
+{
+	int errors = 0;
+	int i;
+
+	notify_heatpump.begin();
+	notify_heatpump.comfortzone_status.room_heating_setting.subscribe(room_heating_setting_changed, NULL);
+	notify_heatpump.set_status_change_callback(status_changed, NULL, (uint64_t)1 << CZSF_HEATPUMP_CURRENT_TOTAL_POWER);
+
+	replay_corpus(&notify_bus, &notify_heatpump);
+
+	// comfortzone_status is read directly, get_status() would decode lazy values
+	if((nb_room_heating_setting_calls > 0) && (notified_room_heating_setting != notify_heatpump.comfortzone_status.room_heating_setting))
+	{
+		Serial.println("Notification: last notified room_heating_setting is not the current value");
+		errors++;
+	}
+
+	if((nb_room_heating_setting_calls == 0) && (heatpump.get_status(CZSF_ROOM_HEATING_SETTING) != 0))
+	{
+		Serial.println("Notification: room_heating_setting subscriber never called");
+		errors++;
+	}
+
+	if((nb_status_change_calls == 0) && (heatpump.get_status(CZSF_HEATPUMP_CURRENT_TOTAL_POWER) != 0))
+	{
+		Serial.println("Notification: status change callback never called");
+		errors++;
+	}
+
+	for(i = 0; i < 2; i++)
+	{
+		COMFORTZONE_STATUS_FIELD field = (i == 0) ? CZSF_ROOM_HEATING_SETTING : CZSF_HEATPUMP_CURRENT_TOTAL_POWER;
+		int32_t value = czstatus::get_field(&notify_heatpump.comfortzone_status, field);
+		int32_t expected = heatpump.get_status(field);
+
+		if(value != expected)
+		{
+			Serial.print("Notification: field ");
+			Serial.print(czstatus::get_field_name(field));
+			Serial.print(" = ");
+			Serial.print((long)value);
+			Serial.print(" instead of ");
+			Serial.println((long)expected);
+			errors++;
+		}
+	}
+
+	Serial.print("Notification: ");
+	Serial.print(nb_room_heating_setting_calls);
+	Serial.print(" subscriber call(s), ");
+	Serial.print(nb_status_change_calls);
+	Serial.print(" status change call(s), ");
+	Serial.print(errors);
+	Serial.println(" error(s)");
+}
+
+void setup()
+{
+	Serial.begin(115200);
+
+	// let linux detect the new USB device
+	delay(1000);
+
+	heatpump.begin();
+
+	decode_check();
+	benchmark();
+	interest_check();
+	notify_check();
+}
+
+void loop()
+{
+}
@@ -0,0 +1,251 @@
+#include <Arduino.h>
+#include <FastCRC.h>
+
+#include "comfortzone_heatpump.h"
+#include "comfortzone_corpus.h"
+#include "comfortzone_frame.h"
+#include "rs485_interface.h"
+
+#include <stdlib.h>
+#include <new>
+
+// Fleet simulation: N emulated heatpump/control panel pairs run in one process.
+// Each unit has its own in-memory bus and its own comfortzone_heatpump instance.
+// - the emulated control panel replays the golden frame corpus (see comfortzone_corpus.h)
+// - the emulated heatpump acknowledges commands sent by the library
+// A shared round-robin scheduler gives one frame to each unit in turn.
+//
+// For each fleet size, the sketch reports:
+// - aggregate decode throughput (frames/s, all units)
+// - memory used by each unit
+// - command latency percentiles (set_fan_speed() duration)
+//
+// Note: corpus is selected using HP_PROTOCOL (see comfortzone_config.h). Units are
+// allocated dynamically, adjust fleet_sizes[] to the available memory.
+
+// fleet sizes to simulate
+static const int fleet_sizes[] = { 1, 10, 100, 1000, 5000 };
+#define NB_FLEET_SIZES (sizeof(fleet_sizes) / sizeof(fleet_sizes[0]))
+
+// duration of the decode throughput measurement (per fleet size)
+#define DECODE_DURATION_MS 2000
+
+// number of commands sent to random units (per fleet size)
+#define NB_COMMANDS 20
+
+typedef struct
+{
+	MemoryRS485Interface bus;
+	comfortzone_heatpump *heatpump;
+
+	uint32_t corpus_pos;		// next corpus byte replayed by the control panel
+} EMULATED_UNIT;
+
+static FastCRC8 CRC8;
+
+static uint32_t rand_state = 1;
+
+static uint32_t next_rand()
+{
+	rand_state = rand_state * 1103515245 + 12345;
+	return (rand_state >> 16) & 0x7FFF;
+}
+
+// emulated heatpump: acknowledge write commands
+// (W_SMALL_CMD only, their W_REPLY return code is the written value)
+static void heatpump_write_hook(const void *data, int size, void *context)
+{
+	EMULATED_UNIT *unit = (EMULATED_UNIT *)context;
+	const W_SMALL_CMD *cmd = (const W_SMALL_CMD *)data;
+	W_REPLY reply;
+	byte comp1_dest[4];
+	int i;
+
+	if((size != sizeof(W_SMALL_CMD)) || (cmd->cz_head.cmd != 'W'))
+		return;
+
+	memcpy(reply.cz_head.destination, cmd->cz_head.source, 4);
+	reply.cz_head.destination_crc = CRC8.maxim(reply.cz_head.destination, 4);
+
+	for(i = 0; i < 4; i++)
+		comp1_dest[i] = reply.cz_head.destination[i] ^ 0xFF;
+
+	reply.cz_head.comp1_destination_crc = CRC8.maxim(comp1_dest, 4);
+
+	memcpy(reply.cz_head.source, cmd->cz_head.destination, 4);
+	reply.cz_head.packet_size = sizeof(W_REPLY);
+	reply.cz_head.cmd = 'w';
+	memcpy(reply.cz_head.reg_num, cmd->cz_head.reg_num, 9);
+
+	reply.return_code = cmd->reg_value;
+	reply.crc = CRC8.maxim((byte*)&reply, sizeof(W_REPLY) - 1);
+
+	unit->bus.feed(&reply, sizeof(reply));
+}
+
+// emulated control panel: send the next corpus frame
+// if send is false, frame is skipped
+static void panel_step(EMULATED_UNIT *unit, bool send = true)
+{
+	const byte *frame = comfortzone_corpus.frames + unit->corpus_pos;
+	int frame_size = frame[10];		// CZ_PACKET_HEADER.packet_size
+
+	if(send)
+		unit->bus.feed(frame, frame_size);
+
+	unit->corpus_pos += frame_size;
+	if(unit->corpus_pos >= comfortzone_corpus.frames_size)
+		unit->corpus_pos = 0;
+}
+
+static int compare_ulong(const void *a, const void *b)
+{
+	unsigned long va = *(const unsigned long *)a;
+	unsigned long vb = *(const unsigned long *)b;
+
+	return (va > vb) - (va < vb);
+}
+
+static void print_percentile(const char *name, unsigned long *sorted, int nb, int percentile)
+{
+	int idx = (nb * percentile) / 100;
+
+	if(idx >= nb)
+		idx = nb - 1;
+
+	Serial.print(name);
+	Serial.print(sorted[idx]);
+	Serial.print("us ");
+}
+
+static void simulate_fleet(int nb_units)
+{
+	EMULATED_UNIT *units;
+	unsigned long latencies[NB_COMMANDS];
+	unsigned long start;
+	unsigned long duration;
+	uint32_t nb_frames = 0;
+	int i;
+
+	units = new (std::nothrow) EMULATED_UNIT[nb_units];
+	if(units == NULL)
+	{
+		Serial.println("Out of memory");
+		return;
+	}
+
+	for(i = 0; i < nb_units; i++)
+	{
+		units[i].heatpump = new (std::nothrow) comfortzone_heatpump(&units[i].bus);
+		if(units[i].heatpump == NULL)
+		{
+			Serial.println("Out of memory");
+
+			while(i > 0)
+				delete units[--i].heatpump;
+
+			delete[] units;
+			return;
+		}
+
+		units[i].bus.set_write_hook(heatpump_write_hook, &units[i]);
+		units[i].corpus_pos = 0;
+
+		// spread units over the corpus
+		while((next_rand() % 4) != 0)
+			panel_step(&units[i], false);
+
+		units[i].heatpump->begin();
+	}
+
+	// decode throughput
+	start = millis();
+
+	do
+	{
+		for(i = 0; i < nb_units; i++)
+		{
+			panel_step(&units[i]);
+			units[i].heatpump->process();
+		}
+
+		nb_frames += nb_units;
+		duration = millis() - start;
+	} while(duration < DECODE_DURATION_MS);
+
+	// command latency
+	for(i = 0; i < NB_COMMANDS; i++)
+	{
+		EMULATED_UNIT *unit = &units[next_rand() % nb_units];
+		unsigned long cmd_start;
+		int j;
+
+		// library sends commands after a reply frame, make sure the last
+		// frame seen by the unit is one (corpus also contains unknown frames)
+		for(j = 0; j < comfortzone_corpus.nb_frames; j++)
+		{
+			panel_step(unit);
+			if(unit->heatpump->process() == comfortzone_heatpump::PFT_REPLY)
+				break;
+		}
+
+		cmd_start = micros();
+
+		if(unit->heatpump->set_fan_speed(1 + (next_rand() % 3)) == false)
+		{
+			Serial.print("Command failed: ");
+			Serial.println(unit->heatpump->last_message);
+		}
+
+		latencies[i] = micros() - cmd_start;
+	}
+
+	qsort(latencies, NB_COMMANDS, sizeof(latencies[0]), compare_ulong);
+
+	Serial.print("Units: ");
+	Serial.print(nb_units);
+	Serial.print(" - decode: ");
+	Serial.print((float)nb_frames * 1000.0 / duration);
+	Serial.print(" frames/s - memory/unit: ");
+	Serial.print((int)(sizeof(EMULATED_UNIT) + sizeof(comfortzone_heatpump)));
+	Serial.print(" bytes - command latency: ");
+	print_percentile("p50=", latencies, NB_COMMANDS, 50);
+	print_percentile("p90=", latencies, NB_COMMANDS, 90);
+	print_percentile("p99=", latencies, NB_COMMANDS, 99);
+	print_percentile("max=", latencies, NB_COMMANDS, 100);
+	Serial.println("");
+
+	for(i = 0; i < nb_units; i++)
+		delete units[i].heatpump;
+
+	delete[] units;
+}
+
+void setup()
+{
+	unsigned int i;
+
+	Serial.begin(115200);
+
+	// let linux detect the new USB device
+	delay(1000);
+
+	if(comfortzone_corpus.nb_frames == 0)
+	{
+		Serial.println("No corpus available for this protocol");
+		return;
+	}
+
+	Serial.print("comfortzone_heatpump: ");
+	Serial.print((int)sizeof(comfortzone_heatpump));
+	Serial.print(" bytes, bus: ");
+	Serial.print((int)sizeof(MemoryRS485Interface));
+	Serial.println(" bytes");
+
+	for(i = 0; i < NB_FLEET_SIZES; i++)
+		simulate_fleet(fleet_sizes[i]);
+}
+
+void loop()
+{
+}
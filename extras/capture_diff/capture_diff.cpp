@@ -0,0 +1,220 @@
+// Capture diff tool
+//
+// Compare 2 captures of RS485 traffic register by register and report, for each register,
+// which byte offsets differ and how often. When the register is known, offsets are mapped
+// to field names of the matching R_REPLY_STATUS_* structure (see comfortzone_frame.h).
+//
+// Captures can be
+// - raw RS485 bytes (default)
+// - hex text (-x option), for example frames copied from comfortzone_decoder.cpp comments.
+//   Every 2-digit hex token is used, everything else is ignored.
+// Captures are streamed, file size does not matter.
+//
+// Register names are taken from the tables of the given protocol version (-p option, default is HP_PROTOCOL),
+// for example -p 180 for protocol 1.8.
+//
+// This is a host tool (linux, macOS, windows). Build example:
+//   g++ -O2 -I../.. -I<path to FastCRC> capture_diff.cpp ../../*.cpp <path to FastCRC>/FastCRCsw.cpp -o capture_diff
+//
+// Usage: capture_diff [-x] [-p protocol] reference_capture compared_capture
+
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdlib.h>
+
+#include "comfortzone_heatpump.h"
+#include "comfortzone_decoder.h"
+#include "comfortzone_frame_layout.h"
+#include "comfortzone_capture_diff.h"
+
+#define READ_BUFFER_SIZE 4096
+
+static int hex_value(int c)
+{
+	if((c >= '0') && (c <= '9'))
+		return c - '0';
+
+	c = toupper(c);
+	if((c >= 'A') && (c <= 'F'))
+		return c - 'A' + 10;
+
+	return -1;
+}
+
+// convert hex text into bytes. Only isolated 2-digit tokens are kept
+// input: text, #characters, state kept between calls (previous characters)
+// output: #bytes stored into output (always <= nb/2 + 1)
+static int hex_text_to_bytes(const char *text, int nb, int state[2], byte *output)
+{
+	int nb_out = 0;
+	int i;
+
+	// state[0] = #hex digits in current token (-1 = token is not a 2-digit hex number)
+	// state[1] = value of current token
+	for(i = 0; i < nb; i++)
+	{
+		int v = hex_value(text[i]);
+
+		if(v >= 0)
+		{
+			if(state[0] >= 0)
+			{
+				state[1] = (state[1] << 4) | v;
+				state[0]++;
+
+				if(state[0] > 2)
+					state[0] = -1;
+			}
+		}
+		else if(isalnum(text[i]) || (text[i] == '_'))
+		{
+			state[0] = -1;
+		}
+		else
+		{
+			if(state[0] == 2)
+				output[nb_out++] = state[1];
+
+			state[0] = 0;
+			state[1] = 0;
+		}
+	}
+
+	return nb_out;
+}
+
+static bool process_capture(comfortzone_capture_diff *diff, bool reference, const char *filename, bool hex_text)
+{
+	static char buffer[READ_BUFFER_SIZE];
+	static byte bytes[READ_BUFFER_SIZE / 2 + 1];
+	int state[2] = { 0, 0 };
+	FILE *f;
+	size_t nb;
+
+	f = fopen(filename, "rb");
+	if(f == NULL)
+	{
+		fprintf(stderr, "Unable to open %s\n", filename);
+		return false;
+	}
+
+	while((nb = fread(buffer, 1, sizeof(buffer), f)) > 0)
+	{
+		bool result;
+
+		if(hex_text)
+			result = diff->feed(reference, bytes, hex_text_to_bytes(buffer, nb, state, bytes));
+		else
+			result = diff->feed(reference, (byte *)buffer, nb);
+
+		if(result == false)
+			fprintf(stderr, "Too many registers, some frames are ignored\n");
+	}
+
+	// flush last token
+	if(hex_text)
+		diff->feed(reference, bytes, hex_text_to_bytes("\n", 1, state, bytes));
+
+	fclose(f);
+	return true;
+}
+
+static void print_register(uint16_t protocol, const CZ_DIFF_REGISTER *reg)
+{
+	const czdec::KNOWN_REGISTER *kr;
+	const CZ_FRAME_LAYOUT *layout = NULL;
+	int i;
+
+	kr = czdec::get_decoder_for_frame(protocol, (CZ_PACKET_HEADER *)reg->reference);
+
+	printf("%c", reg->cmd);
+	for(i = 0; i < 9; i++)
+		printf(" %02X", reg->reg_num[i]);
+
+	printf(" (0x%02X bytes) %s", reg->frame_size, (kr != NULL) ? kr->reg_name : "unknown register");
+
+	if(reg->cmd == 'r')
+		layout = czlayout::get_layout(kr, reg->frame_size);
+
+	if(layout != NULL)
+		printf(" [%s]", layout->name);
+
+	printf(": %u reference frame(s), %u compared frame(s)\n", reg->nb_reference_frames, reg->nb_compared_frames);
+
+	if(reg->nb_reference_frames == 0)
+	{
+		printf("\tnot in reference capture\n");
+		return;
+	}
+
+	if(reg->nb_compared_frames == 0)
+	{
+		printf("\tnot in compared capture\n");
+		return;
+	}
+
+	for(i = 0; i < reg->frame_size; i++)
+	{
+		if(reg->diff_count[i] == 0)
+			continue;
+
+		printf("\toffset 0x%02X: %u/%u differ", i, reg->diff_count[i], reg->nb_compared_frames);
+
+		if(layout != NULL)
+		{
+			const CZ_FRAME_FIELD *field = czlayout::get_field(layout, i);
+
+			if(field != NULL)
+				printf(" - %s+%d", field->name, i - field->offset);
+		}
+
+		if(comfortzone_capture_diff::is_volatile(reg, i))
+			printf(" (volatile in reference)");
+
+		printf("\n");
+	}
+}
+
+int main(int argc, char **argv)
+{
+	comfortzone_capture_diff *diff;
+	uint16_t protocol = HP_PROTOCOL;
+	bool hex_text = false;
+	int arg = 1;
+	int i;
+
+	while((arg < argc) && (argv[arg][0] == '-'))
+	{
+		if(!strcmp(argv[arg], "-x"))
+			hex_text = true;
+		else if((!strcmp(argv[arg], "-p")) && ((arg + 1) < argc))
+			protocol = atoi(argv[++arg]);
+		else
+			break;
+
+		arg++;
+	}
+
+	if(((argc - arg) != 2) || (czdec::get_protocol(protocol) == NULL))
+	{
+		fprintf(stderr, "Usage: %s [-x] [-p protocol] reference_capture compared_capture\n", argv[0]);
+		fprintf(stderr, "protocol: 160, 170, 180 or 221\n");
+		return 1;
+	}
+
+	diff = new comfortzone_capture_diff();
+
+	if((process_capture(diff, true, argv[arg], hex_text) == false)
+		|| (process_capture(diff, false, argv[arg + 1], hex_text) == false))
+	{
+		delete diff;
+		return 1;
+	}
+
+	for(i = 0; i < diff->get_nb_registers(); i++)
+		print_register(protocol, diff->get_register(i));
+
+	delete diff;
+	return 0;
+}
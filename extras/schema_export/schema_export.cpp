@@ -0,0 +1,163 @@
+// Schema export tool
+//
+// Print, as JSON, the registers known by a protocol version and the layout of their frames:
+// - register name, register number, index in the register table, craftability and
+//   r reply size (0 = any size, registers sharing a reg_num are told apart by reply size)
+// - for each known frame format: structure name, size and fields (see comfortzone_frame_layout.h)
+// - for each value copied into comfortzone_status: offset, width, scaling, unit and
+//   COMFORTZONE_STATUS member name (see czdec::STATUS_FIELD)
+// - the list of comfortzone_status fields (CZSF_* order, as used by get_status())
+//
+// Gateways and exporters can generate their mapping from this output instead of hard-coding it.
+//
+// Protocol version is given using -p option (default is HP_PROTOCOL), for example -p 180 for protocol 1.8.
+//
+// This is a host tool (linux, macOS, windows). Build example:
+//   g++ -O2 -I../.. -I<path to FastCRC> schema_export.cpp ../../*.cpp <path to FastCRC>/FastCRCsw.cpp -o schema_export
+//
+// Usage: schema_export [-p protocol]
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "comfortzone_heatpump.h"
+#include "comfortzone_decoder.h"
+#include "comfortzone_frame_layout.h"
+#include "comfortzone_status.h"
+
+// print a JSON string (NULL = null)
+static void print_string(const char *s)
+{
+	if(s == NULL)
+	{
+		printf("null");
+		return;
+	}
+
+	putchar('"');
+
+	for(; *s != '\0'; s++)
+	{
+		if((*s == '"') || (*s == '\\'))
+			printf("\\%c", *s);
+		else if((unsigned char)*s < 0x20)
+			printf("\\u%04x", *s);
+		else
+			putchar(*s);
+	}
+
+	putchar('"');
+}
+
+static void print_status_fields(const czdec::STATUS_FIELD *fields, int nb_fields)
+{
+	int i;
+
+	printf(",\n\t\t\t\t\t\"status_fields\": [");
+
+	for(i = 0; i < nb_fields; i++)
+	{
+		printf("%s\n\t\t\t\t\t\t{ \"field\": ", (i != 0) ? "," : "");
+		print_string(czstatus::get_field_name(fields[i].status_field));
+		printf(", \"name\": ");
+		print_string(fields[i].name);
+		printf(", \"offset\": %d, \"width\": %d, \"signed\": %s, \"bias\": %d, \"scale\": %u, \"unit\": ",
+					fields[i].offset, fields[i].width, fields[i].is_signed ? "true" : "false", fields[i].bias, fields[i].scale);
+		print_string(fields[i].unit);
+		printf(" }");
+	}
+
+	printf("\n\t\t\t\t\t]");
+}
+
+static void print_frames(const czdec::KNOWN_REGISTER *kr)
+{
+	const CZ_FRAME_LAYOUT *layout;
+	const czdec::STATUS_FIELD *fields;
+	int nb_fields;
+	int i;
+	int j;
+
+	printf(",\n\t\t\t\"frames\": [");
+
+	for(i = 0; (layout = czlayout::get_nth_layout(kr, i)) != NULL; i++)
+	{
+		printf("%s\n\t\t\t\t{\n\t\t\t\t\t\"layout\": ", (i != 0) ? "," : "");
+		print_string(layout->name);
+		printf(",\n\t\t\t\t\t\"size\": %d,\n\t\t\t\t\t\"fields\": [", layout->frame_size);
+
+		for(j = 0; j < layout->nb_fields; j++)
+		{
+			printf("%s\n\t\t\t\t\t\t{ \"name\": ", (j != 0) ? "," : "");
+			print_string(layout->fields[j].name);
+			printf(", \"offset\": %d, \"size\": %d }", layout->fields[j].offset, layout->fields[j].size);
+		}
+
+		printf("\n\t\t\t\t\t]");
+
+		fields = czdec::get_status_fields(kr, layout->frame_size, &nb_fields);
+		if(fields != NULL)
+			print_status_fields(fields, nb_fields);
+
+		printf("\n\t\t\t\t}");
+	}
+
+	printf("\n\t\t\t]");
+}
+
+int main(int argc, char **argv)
+{
+	const czdec::KNOWN_REGISTER *kr;
+	uint16_t protocol = HP_PROTOCOL;
+	int arg = 1;
+	int i;
+	int j;
+
+	while((arg < argc) && (argv[arg][0] == '-'))
+	{
+		if((!strcmp(argv[arg], "-p")) && ((arg + 1) < argc))
+			protocol = atoi(argv[++arg]);
+		else
+			break;
+
+		arg++;
+	}
+
+	if((arg != argc) || (czdec::get_protocol(protocol) == NULL))
+	{
+		fprintf(stderr, "Usage: %s [-p protocol]\n", argv[0]);
+		fprintf(stderr, "protocol: 160, 170, 180 or 221\n");
+		return 1;
+	}
+
+	printf("{\n\t\"protocol\": %u,\n\t\"registers\": [", protocol);
+
+	for(i = 0; (kr = czdec::get_register(protocol, i)) != NULL; i++)
+	{
+		printf("%s\n\t\t{\n\t\t\t\"index\": %d,\n\t\t\t\"name\": ", (i != 0) ? "," : "", i);
+		print_string(kr->reg_name);
+		printf(",\n\t\t\t\"reg_num\": \"");
+
+		for(j = 0; j < 9; j++)
+			printf("%s%02X", (j != 0) ? " " : "", kr->reg_num[j]);
+
+		printf("\",\n\t\t\t\"craftable\": %s", (kr->reg_cname != czcraft::KR_UNCRAFTABLE) ? "true" : "false");
+		printf(",\n\t\t\t\"reply_size\": %d", kr->reply_size);
+
+		print_frames(kr);
+
+		printf("\n\t\t}");
+	}
+
+	printf("\n\t],\n\t\"status_fields\": [");
+
+	for(i = 0; i < CZSF_NB_FIELDS; i++)
+	{
+		printf("%s\n\t\t", (i != 0) ? "," : "");
+		print_string(czstatus::get_field_name((COMFORTZONE_STATUS_FIELD)i));
+	}
+
+	printf("\n\t]\n}\n");
+	return 0;
+}
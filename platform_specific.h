@@ -37,6 +37,20 @@ inline unsigned long millis() {
 }
 #endif
 
+#if !defined(ARDUINO) && !defined(ESP_PLATFORM) && (defined(__unix__) || defined(__APPLE__))
+// host build (tools, simulation)
+#include <stdint.h>
+#include <time.h>
+
+inline unsigned long millis() {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (unsigned long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+#endif
+
 #ifndef NULL
 #define NULL 0
 #endif
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stddef.h>
+
 class RS485Interface {
 public:
     virtual void begin() = 0;
@@ -11,6 +13,79 @@ public:
     virtual void enable_sender_mode() = 0;
 };
 
+// RS485 bus emulated in memory (replay of captured frames, simulation, host builds)
+// Bytes given to feed() are returned by read_byte(). Bytes written by the library are
+// forwarded to the optional write hook (e.g. an emulated heatpump which may feed() a reply).
+#define MEMORY_RS485_BUFFER_SIZE 512
+
+class MemoryRS485Interface: public RS485Interface {
+public:
+    typedef void (*write_hook_t)(const void* data, int size, void *context);
+
+    MemoryRS485Interface() {}
+
+    void set_write_hook(write_hook_t hook, void *context) {
+        _write_hook = hook;
+        _write_context = context;
+    }
+
+    // queue bytes to be received by the library
+    // output: number of bytes queued (less than size if buffer is full)
+    int feed(const void* data, int size) {
+        const unsigned char *ptr = (const unsigned char *)data;
+        int i;
+
+        for(i = 0; i < size; i++) {
+            if(_rx_count == MEMORY_RS485_BUFFER_SIZE)
+                break;
+
+            _rx_buf[(_rx_head + _rx_count) % MEMORY_RS485_BUFFER_SIZE] = ptr[i];
+            _rx_count++;
+        }
+
+        return i;
+    }
+
+    void begin() {}
+
+    int available() {
+        return _rx_count;
+    }
+
+    int read_byte() {
+        int v;
+
+        if(_rx_count == 0)
+            return -1;
+
+        v = _rx_buf[_rx_head];
+        _rx_head = (_rx_head + 1) % MEMORY_RS485_BUFFER_SIZE;
+        _rx_count--;
+
+        return v;
+    }
+
+    int write_bytes(const void* data, int size) {
+        if(_write_hook != NULL)
+            _write_hook(data, size, _write_context);
+        return size;
+    }
+
+    void flush() {}
+
+    void enable_receiver_mode() {}
+
+    void enable_sender_mode() {}
+
+private:
+    unsigned char _rx_buf[MEMORY_RS485_BUFFER_SIZE];
+    int _rx_head = 0;
+    int _rx_count = 0;
+
+    write_hook_t _write_hook = NULL;
+    void *_write_context = NULL;
+};
+
 #ifdef ARDUINO
 
 #include <Arduino.h>